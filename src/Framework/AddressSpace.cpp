@@ -1,11 +1,13 @@
 #include <algorithm>
+#include <cstring>
 
 #include "Framework/AddressSpace.hpp"
 #include "Framework/BasicCPU.hpp"
 #include "Framework/BasicDevice.hpp"
 
 AddressSpace::AddressSpace(Address maximumAddress)
-    : myMaximumAddress(maximumAddress), rcache(3), wcache(3) { }
+    : myMaximumAddress(maximumAddress), rcache(3), wcache(3),
+      myCodeGeneration(0), myWriteLog(nullptr) { }
 
 AddressSpace::~AddressSpace() {
   for (auto *device : devices) delete device;
@@ -23,6 +25,8 @@ bool AddressSpace::AttachDevice(BasicDevice *device) {
     return false;
   }
   devices.push_back(device);
+  MapMemoryPages();
+  InvalidateCode();
   return true;
 }
 
@@ -44,6 +48,8 @@ bool AddressSpace::DetachDevice(size_t index) {
   }
   devices.erase(devices.begin() + index);
   delete device;
+  MapMemoryPages();
+  InvalidateCode();
   return true;
 }
 
@@ -54,11 +60,113 @@ void AddressSpace::Reset() {
   }
 }
 
+// Map every page that lies within a single device and doesn't overlap any
+// other device to the device's host memory, or note the device so it can be
+// asked for the memory when the page is first written
+void AddressSpace::MapMemoryPages() {
+  myPages.clear();
+  myWritePages.clear();
+  myPageDevices.clear();
+  for (auto *device : devices) {
+    size_t low = device->LowestAddress();
+    size_t first = (low + PAGE_MASK) >> PAGE_SHIFT;
+    size_t last = (size_t(device->HighestAddress()) + 1) >> PAGE_SHIFT;
+    for (size_t page = first; page < last; ++page) {
+      Address start = page << PAGE_SHIFT;
+      Address end = start + PAGE_MASK;
+      bool shared = std::any_of(
+          devices.begin(), devices.end(), [=](const BasicDevice *d) -> bool {
+            return d != device && d->LowestAddress() <= end &&
+                   d->HighestAddress() >= start;
+          });
+      if (shared) {
+        continue;
+      }
+      if (page >= myPages.size()) {
+        myPages.resize(page + 1, nullptr);
+        myWritePages.resize(page + 1, nullptr);
+        myPageDevices.resize(page + 1, nullptr);
+      }
+      myPages[page] = device->Memory(start, PAGE_MASK + 1, false);
+      myPageDevices[page] = device;
+    }
+  }
+}
+
+// Ask the device holding the page for memory to write to now that it's being
+// written.  Answers host memory for the width bytes at addr or nullptr
+Byte *AddressSpace::MapWriteMemory(Address addr, int width) {
+  size_t page = addr >> PAGE_SHIFT;
+  if (page >= myPageDevices.size() || myPageDevices[page] == nullptr ||
+      (addr & PAGE_MASK) > PAGE_MASK + 1 - width) {
+    return nullptr;
+  }
+  Address start = page << PAGE_SHIFT;
+  Byte *memory = myPageDevices[page]->Memory(start, PAGE_MASK + 1, true);
+  if (memory == nullptr) {
+    return nullptr;
+  }
+  myPages[page] = myWritePages[page] = memory;
+  return memory + (addr & PAGE_MASK);
+}
+
+// Mark every word the instruction at the given location overlaps, which is
+// one more than its length covers when it starts at an odd address
+void AddressSpace::MarkCode(Address addr, size_t length) {
+  size_t last = (size_t(addr) + length - 1) >> CODE_PAGE_SHIFT;
+  if (last >= myCodePages.size()) {
+    myCodePages.resize(last + 1);
+  }
+  for (size_t word = addr & ~1; word < size_t(addr) + length; word += 2) {
+    myCodePages[word >> CODE_PAGE_SHIFT] = true;
+    myCodeWords.insert(word);
+  }
+}
+
+// Check every word in the range for having been marked as code
+void AddressSpace::CheckCodeWords(Address addr, size_t length) {
+  if (length == 0) {
+    return;
+  }
+  size_t last = (size_t(addr) + length - 1) >> CODE_PAGE_SHIFT;
+  for (size_t page = addr >> CODE_PAGE_SHIFT;
+       page <= last && page < myCodePages.size(); ++page) {
+    if (!myCodePages[page]) {
+      continue;
+    }
+    size_t start = std::max<size_t>(page << CODE_PAGE_SHIFT, addr & ~1);
+    size_t end = std::min<size_t>((page + 1) << CODE_PAGE_SHIFT,
+                                  size_t(addr) + length);
+    for (size_t word = start; word < end; word += 2) {
+      if (myCodeWords.count(word) != 0) {
+        InvalidateCode();
+        return;
+      }
+    }
+  }
+}
+
+// Forget all of the code pages and let the CPUs know their decoded
+// instructions are stale
+void AddressSpace::InvalidateCode() {
+  myCodePages.clear();
+  myCodeWords.clear();
+  ++myCodeGeneration;
+}
+
 // Answers the number of attached devices
 size_t AddressSpace::NumberOfAttachedDevices() const {
   return devices.size();
 }
 
+// Append the statistics of each attached device to the list
+void AddressSpace::BuildStatisticalInformationList(
+    StatisticalInformationList &list) const {
+  for (auto *device : devices) {
+    device->BuildStatisticalInformationList(list);
+  }
+}
+
 // Get information about the indexed device. Answer true iff successful
 bool AddressSpace::GetDeviceInformation(
     size_t index, AddressSpace::DeviceInformation &info) const {
@@ -105,6 +213,11 @@ BasicDevice *AddressSpace::FindWriteDevice(Address address) {
 
 // Peek the given location.  Answers true iff successful
 bool AddressSpace::Peek(Address addr, Byte &c) {
+  if (const Byte *memory = FindReadMemory(addr, 1)) {
+    c = *memory;
+    return true;
+  }
+
   BasicDevice *d = FindReadDevice(addr);
 
   // Did we find a device
@@ -119,6 +232,11 @@ bool AddressSpace::Peek(Address addr, Byte &c) {
 
 // Poke the given location.  Answers true iff successful
 bool AddressSpace::Poke(Address addr, Byte c) {
+  if (Byte *memory = FindWriteMemory(addr, 1)) {
+    *memory = c;
+    return true;
+  }
+
   BasicDevice *d = FindWriteDevice(addr);
 
   // Did we find a device
@@ -127,7 +245,11 @@ bool AddressSpace::Poke(Address addr, Byte c) {
   }
 
   // Put the byte
+  CheckCodeWrite(addr);
   d->Poke(addr, c);
+  if (myWriteLog != nullptr) {
+    myWriteLog->push_back({addr, 1, nullptr, c});
+  }
   return true;
 }
 
@@ -141,6 +263,28 @@ bool IsMapped(const BasicDevice &device, Address address, int width) {
   }
   return true;
 }
+
+// Answers how many of the length locations from address the device maps
+// before the first one it doesn't, which must not be address itself
+size_t MappedLength(const BasicDevice &device, Address address,
+                    size_t length) {
+  size_t k = 1;
+  while (k < length && device.CheckMapped(address + k)) {
+    ++k;
+  }
+  return k;
+}
+}
+
+// Answers true iff reading the width bytes at addr has no side effects
+bool AddressSpace::PeekIsQuiet(Address addr, int width) {
+  if (FindReadMemory(addr, width) != nullptr) {
+    return true;
+  }
+  BasicDevice *d = FindReadDevice(addr);
+  return d != nullptr && IsMapped(*d, addr, width) &&
+         (d->Memory(addr, width, false) != nullptr ||
+          d->PeekIsQuiet(addr, width));
 }
 
 // Peek a location in the address space with size parameter. Answers true iff
@@ -159,9 +303,14 @@ bool AddressSpace::Peek(Address addr, unsigned long &data, int size) {
     return true;
   }
 
+  if (const Byte *memory = FindReadMemory(addr, width)) {
+    data = ReadBigEndian(memory, width);
+    return true;
+  }
+
   BasicDevice *d = FindReadDevice(addr);
   if (d != nullptr && IsMapped(*d, addr, width)) {
-    return !d->Peek(addr, data, size);
+    return d->Peek(addr, data, size);
   }
 
   if (size == WORD) {
@@ -204,16 +353,25 @@ bool AddressSpace::Poke(Address addr, unsigned long data, int size) {
   if (size == LONG) width = 4;
 
   if (size == BYTE) {
-    if (!Poke(addr, c)) {
-      return false;
-    }
-    data = c;
+    c = (Byte)data;
+    return Poke(addr, c);
+  }
+
+  if (Byte *memory = FindWriteMemory(addr, width)) {
+    WriteBigEndian(memory, data, width);
     return true;
   }
 
   BasicDevice *d = FindWriteDevice(addr);
   if (d != nullptr && IsMapped(*d, addr, width)) {
-    return d->Poke(addr, data, size);
+    CheckCodeWrite(addr, width);
+    if (!d->Poke(addr, data, size)) {
+      return false;
+    }
+    if (myWriteLog != nullptr) {
+      myWriteLog->push_back({addr, width, nullptr, data});
+    }
+    return true;
   }
 
   if (size == WORD) {
@@ -235,3 +393,70 @@ bool AddressSpace::Poke(Address addr, unsigned long data, int size) {
 
   return false;
 }
+
+// Peek a block of locations, a page or a device at a time.  Answers the
+// number of locations peeked
+size_t AddressSpace::ReadBlock(Address addr, Byte *data, size_t length) {
+  size_t done = 0;
+  while (done < length) {
+    Address address = addr + done;
+    size_t chunk = std::min<size_t>(length - done,
+                                    PAGE_MASK + 1 - (address & PAGE_MASK));
+    if (const Byte *memory = FindReadMemory(address, 1)) {
+      std::memcpy(data + done, memory, chunk);
+      done += chunk;
+      continue;
+    }
+
+    BasicDevice *d = FindReadDevice(address);
+    if (d == nullptr) {
+      break;  // Bus error.
+    }
+    chunk = MappedLength(*d, address, chunk);
+    d->ReadBlock(address, data + done, chunk);
+    done += chunk;
+  }
+  return done;
+}
+
+// Poke a block of locations, a page or a device at a time.  Answers the
+// number of locations poked
+size_t AddressSpace::WriteBlock(Address addr, const Byte *data,
+                                size_t length) {
+  size_t done = 0;
+  while (done < length) {
+    Address address = addr + done;
+    size_t chunk = std::min<size_t>(length - done,
+                                    PAGE_MASK + 1 - (address & PAGE_MASK));
+    Byte *memory = FindMemory(address, 1, myWritePages);
+    if (memory == nullptr) {
+      memory = MapWriteMemory(address, 1);
+    }
+    if (memory != nullptr) {
+      CheckCodeWrite(address, chunk);
+      std::memcpy(memory, data + done, chunk);
+      if (myWriteLog != nullptr) {
+        myWriteLog->push_back({address, static_cast<int>(chunk), memory, 0});
+      }
+      done += chunk;
+      continue;
+    }
+
+    BasicDevice *d = FindWriteDevice(address);
+    if (d == nullptr) {
+      break;  // Bus error.
+    }
+    chunk = MappedLength(*d, address, chunk);
+    CheckCodeWrite(address, chunk);
+    d->WriteBlock(address, data + done, chunk);
+    if (myWriteLog != nullptr) {
+      // A logged value only holds a few bytes, so log a byte at a time
+      for (size_t t = 0; t < chunk; ++t) {
+        myWriteLog->push_back({Address(address + t), 1, nullptr,
+                               data[done + t]});
+      }
+    }
+    done += chunk;
+  }
+  return done;
+}
@@ -7,11 +7,13 @@
 #define FRAMEWORK_ADDRESSSPACE_HPP_
 
 #include <string>
+#include <unordered_set>
 #include <vector>
 
 #include "Framework/Types.hpp"
 
 class BasicDevice;
+class StatisticalInformationList;
 
 // Size Constants
 enum {
@@ -20,6 +22,22 @@ enum {
   LONG,
 };
 
+// Returns the big endian value held in the width bytes of host memory.
+inline unsigned long ReadBigEndian(const Byte *memory, int width) {
+  unsigned long value = 0;
+  for (int k = 0; k < width; ++k) {
+    value = (value << 8) | memory[k];
+  }
+  return value;
+}
+
+// Puts the value into the width bytes of host memory, big endian.
+inline void WriteBigEndian(Byte *memory, unsigned long value, int width) {
+  for (int k = width - 1; k >= 0; --k, value >>= 8) {
+    memory[k] = (Byte)value;
+  }
+}
+
 class AddressSpace {
 public:
   // Used to retrieve information about attached devices.
@@ -29,6 +47,16 @@ public:
     size_t index;
   };
 
+  // A write made while writes are being logged.  A write to a memory page
+  // gives the host memory, which holds the bytes written until something
+  // writes there again, and a write to a device gives the value written.
+  struct Write {
+    Address address;
+    int width;
+    const Byte *memory;
+    unsigned long value;
+  };
+
 public:
   AddressSpace(Address maximumAddress);
   virtual ~AddressSpace();
@@ -64,7 +92,98 @@ public:
   // Pokes the given location.  Returns true iff successful.
   virtual bool Poke(Address addr, unsigned long d, int size);
 
+  // Peeks length bytes starting at the given location.  Returns the number
+  // peeked, which is less than length if a location isn't mapped.
+  size_t ReadBlock(Address addr, Byte *data, size_t length);
+
+  // Pokes length bytes starting at the given location.  Returns the number
+  // poked, which is less than length if a location isn't mapped.
+  size_t WriteBlock(Address addr, const Byte *data, size_t length);
+
+  // Returns true iff reading the width bytes at addr changes nothing, which
+  // holds for memory and for device registers the device says are quiet.
+  bool PeekIsQuiet(Address addr, int width);
+
+  // Returns host memory holding the width bytes at addr if they lie in a
+  // memory page, otherwise nullptr and they must be read with Peek.
+  const Byte *FindReadMemory(Address addr, int width) const {
+    return FindMemory(addr, width, myPages);
+  }
+
+  // Returns host memory holding the width bytes at addr if they lie in a
+  // memory page, otherwise nullptr and they must be written with Poke.
+  Byte *FindWriteMemory(Address addr, int width) {
+    Byte *memory = FindMemory(addr, width, myWritePages);
+    if (memory == nullptr) {
+      memory = MapWriteMemory(addr, width);
+    }
+    if (memory != nullptr) {
+      CheckCodeWrite(addr, width);
+      if (myWriteLog != nullptr) {
+        myWriteLog->push_back({addr, width, memory, 0});
+      }
+    }
+    return memory;
+  }
+
+  // Appends the writes made through FindWriteMemory, Poke and WriteBlock to
+  // the log from now on, or stops logging them given nullptr.
+  void LogWrites(std::vector<Write> *log) { myWriteLog = log; }
+
+  // Marks the length bytes at the given location as holding a decoded
+  // instruction.
+  void MarkCode(Address addr, size_t length = 2);
+
+  // Returns a count that changes whenever marked code may have been modified.
+  unsigned long CodeGeneration() const { return myCodeGeneration; }
+
+  // Appends the attached devices' statistics to the list.
+  void BuildStatisticalInformationList(StatisticalInformationList &list) const;
+
 private:
+  // Returns host memory from the page table holding the width bytes at addr
+  // or nullptr.
+  static Byte *FindMemory(Address addr, int width,
+                          const std::vector<Byte *> &pages) {
+    size_t page = addr >> PAGE_SHIFT;
+    if (page >= pages.size() || pages[page] == nullptr ||
+        (addr & PAGE_MASK) > PAGE_MASK + 1 - width) {
+      return nullptr;
+    }
+    return pages[page] + (addr & PAGE_MASK);
+  }
+
+  // Rebuilds the page table after the attached devices change.
+  void MapMemoryPages();
+
+  // Asks the device holding the page for memory to write the width bytes at
+  // addr to, which it may allocate.  Returns the memory or nullptr.
+  Byte *MapWriteMemory(Address addr, int width);
+
+  // Bumps the code generation if the address holds a marked opcode word.
+  void CheckCodeWrite(Address addr) {
+    size_t page = addr >> CODE_PAGE_SHIFT;
+    if (page < myCodePages.size() && myCodePages[page] &&
+        myCodeWords.count(addr & ~1) != 0) {
+      InvalidateCode();
+    }
+  }
+
+  // Bumps the code generation if the range overlaps a marked word.
+  void CheckCodeWrite(Address addr, size_t length) {
+    size_t first = addr >> CODE_PAGE_SHIFT;
+    size_t last = (size_t(addr) + length - 1) >> CODE_PAGE_SHIFT;
+    if (first < myCodePages.size() && (myCodePages[first] || last != first)) {
+      CheckCodeWords(addr, length);
+    }
+  }
+
+  // Checks every word the range overlaps for having been marked.
+  void CheckCodeWords(Address addr, size_t length);
+
+  // Forgets all marked pages and bumps the code generation.
+  void InvalidateCode();
+
   BasicDevice *FindCachedDevice(Address address,
                                 std::vector<BasicDevice *> &cache);
   BasicDevice *FindReadDevice(Address address);
@@ -79,6 +198,28 @@ private:
   // Device caches.
   std::vector<BasicDevice *> rcache;
   std::vector<BasicDevice *> wcache;
+
+  // Host memory to read and to write for each page of 2^PAGE_SHIFT bytes
+  // that lies entirely in one device's memory and no other device, otherwise
+  // nullptr, along with the device.  Pages are only mapped for writing once
+  // they're first written, since some devices don't allow it and others
+  // only set the memory aside then.
+  static constexpr int PAGE_SHIFT = 12;
+  static constexpr Address PAGE_MASK = (1 << PAGE_SHIFT) - 1;
+  std::vector<Byte *> myPages;
+  std::vector<Byte *> myWritePages;
+  std::vector<BasicDevice *> myPageDevices;
+
+  // Pages holding decoded instructions, in units of 2^CODE_PAGE_SHIFT bytes,
+  // and the (even) addresses of the words within them that hold decoded
+  // instructions.
+  static constexpr int CODE_PAGE_SHIFT = 8;
+  std::vector<bool> myCodePages;
+  std::unordered_set<Address> myCodeWords;
+  unsigned long myCodeGeneration;
+
+  // Where writes are logged, or nullptr.
+  std::vector<Write> *myWriteLog;
 };
 
 #endif  // FRAMEWORK_ADDRESSSPACE_HPP_
@@ -3,13 +3,31 @@
 #include "Framework/BasicCPU.hpp"
 
 BasicCPU::BasicCPU(const std::string &name, int granularity,
-                   std::vector<AddressSpace *> &addressSpaces,
+                   unsigned long clockRate,
                    const std::string &traceRecordFormat,
                    const std::string &defaultTraceRecordEntries)
-    : myAddressSpaces(addressSpaces),
+    : myEventHandler(myCycles, clockRate),
+      myCycles(0),
       myName(name),
       myGranularity(granularity),
+      myClockRate(clockRate),
       myExecutionTraceRecord(traceRecordFormat),
       myDefaultExecutionTraceEntries(defaultTraceRecordEntries) { }
 
 BasicCPU::~BasicCPU() { }
+
+// Answers the message describing why Execute stopped
+const char *BasicCPU::StopMessage(StopReason reason) {
+  switch (reason) {
+  case STOP_BREAKPOINT:
+    return "Execution stopped at a breakpoint!";
+  case STOP_BREAK:
+    return "Execution stopped: BREAK instruction";
+  case STOP_HALTED:
+    return "Execution stopped: CPU has halted";
+  case STOP_INTERRUPTED:
+    return "Execution Interrupted!";
+  default:
+    return "";
+  }
+}
@@ -5,6 +5,7 @@
 #ifndef FRAMEWORK_BASICCPU_HPP_
 #define FRAMEWORK_BASICCPU_HPP_
 
+#include <atomic>
 #include <string>
 #include <vector>
 
@@ -14,15 +15,43 @@
 
 class BasicCPU;
 class BasicDevice;
+class BreakpointList;
 class RegisterInformationList;
 class StatisticalInformationList;
 class AddressSpace;
 
 class BasicCPU {
+public:
+  // Reasons for Execute to return.
+  enum StopReason {
+    STOP_LIMIT,       // Executed the requested number of instructions
+    STOP_BREAKPOINT,  // Reached a breakpoint
+    STOP_BREAK,       // Executed a BREAK instruction
+    STOP_HALTED,      // The CPU has halted
+    STOP_INTERRUPTED, // The interrupt flag was set
+  };
+
+  // Conditions that end a call to Execute early.
+  struct StopConditions {
+    // Stops after an instruction that leaves the PC at one of these
+    // addresses, unless nullptr.
+    const BreakpointList *breakpoints;
+
+    // Stops after an instruction once this is set, unless nullptr.  Set by
+    // another thread, so it can stop the CPU early.
+    const std::atomic<bool> *interrupt;
+  };
+
+  // What a call to Execute did.
+  struct ExecuteResult {
+    StopReason reason;
+    size_t instructions;  // Number of instructions executed
+  };
+
 public:
   BasicCPU(const std::string &name,
            int granularity,
-           std::vector<AddressSpace *> &addressSpaces,
+           unsigned long clockRate,
            const std::string &traceRecordFormat,
            const std::string &defaultTraceRecordEntries);
   virtual ~BasicCPU();
@@ -33,6 +62,12 @@ public:
   // Returns the granularity of the microprocessor.
   unsigned int Granularity() const { return myGranularity; }
 
+  // Returns the number of clock cycles per second.
+  unsigned long ClockRate() const { return myClockRate; }
+
+  // Returns the number of clock cycles the CPU has run.
+  uint64_t Cycles() const { return myCycles; }
+
   // Returns a reference to my event handler.
   EventHandler &eventHandler() { return myEventHandler; };
 
@@ -55,6 +90,30 @@ public:
   // Executes the next instruction. Returns an error message or the empty string.
   virtual std::string ExecuteInstruction(std::string &traceRecord, bool trace) = 0;
 
+  // Executes up to maxInstructions instructions without tracing, stopping
+  // early when one of the stop conditions is met.
+  virtual ExecuteResult Execute(size_t maxInstructions,
+                                const StopConditions &stop) = 0;
+
+  // Returns the message describing why Execute stopped.
+  static const char *StopMessage(StopReason reason);
+
+  // Executes the next instruction for a trace recorder, which keeps less
+  // than a trace record.  Sets disassembled to whether the record would hold
+  // the instruction's disassembly and note to what it would hold after that.
+  // Returns STOP_BREAK or STOP_HALTED if the CPU stopped, else STOP_LIMIT.
+  virtual StopReason RecordInstruction(bool &disassembled,
+                                       std::string &note) = 0;
+
+  // Returns the registers in the order of the register list, setting count
+  // to how many there are.
+  virtual const Register *RegisterFile(size_t &count) = 0;
+
+  // Appends the disassembly of the instruction at the address to mnemonic,
+  // as a trace record shows it.
+  virtual void DisassembleInstruction(Address address,
+                                      std::string &mnemonic) = 0;
+
   // Handles an interrupt request from a device.
   virtual void InterruptRequest(BasicDevice *device, int level) = 0;
 
@@ -84,6 +143,9 @@ protected:
   // My event handler.
   EventHandler myEventHandler;
 
+  // Number of clock cycles the CPU has run.
+  uint64_t myCycles;
+
 private:
   // My name.
   const std::string myName;
@@ -91,6 +153,9 @@ private:
   // CPU address granularity in bytes.
   const unsigned int myGranularity;
 
+  // Clock cycles per second.
+  const unsigned long myClockRate;
+
   // Trace record format used by the ExecuteInstruction member function.
   std::string myExecutionTraceRecord;
 
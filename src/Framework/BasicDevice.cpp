@@ -76,3 +76,18 @@ bool BasicDevice::Poke(Address address, unsigned long data, int size) {
   }
   return true;
 }
+
+// Default ReadBlock implementation, for devices without a faster way.
+void BasicDevice::ReadBlock(Address address, Byte *data, size_t length) {
+  for (size_t k = 0; k < length; ++k) {
+    data[k] = Peek(address + k);
+  }
+}
+
+// Default WriteBlock implementation, for devices without a faster way.
+void BasicDevice::WriteBlock(Address address, const Byte *data,
+                             size_t length) {
+  for (size_t k = 0; k < length; ++k) {
+    Poke(address + k, data[k]);
+  }
+}
@@ -9,6 +9,7 @@
 #include "Framework/Event.hpp"
 
 class BasicCPU;
+class StatisticalInformationList;
 
 constexpr int AUTOVECTOR_INTERRUPT = -1;
 constexpr int SPURIOUS_INTERRUPT = -2;
@@ -45,6 +46,26 @@ public:
   // Puts data into the device.
   virtual bool Poke(Address address, unsigned long data, int size);
 
+  // Gets length bytes starting at the address from the device.
+  virtual void ReadBlock(Address address, Byte *data, size_t length);
+
+  // Puts length bytes starting at the address into the device.
+  virtual void WriteBlock(Address address, const Byte *data, size_t length);
+
+  // Returns host memory holding the length bytes starting at the address if
+  // they can be read, or written if write is true, directly, otherwise
+  // nullptr.  Memory that's only set aside once it's written is allocated
+  // iff write is true.
+  virtual Byte *Memory(Address, size_t, bool) { return nullptr; }
+
+  // Returns true iff reading the length bytes starting at the address
+  // changes nothing in the device, so they read the same until an event or
+  // a write changes them.
+  virtual bool PeekIsQuiet(Address, size_t) const { return false; }
+
+  // Appends the device's statistics, if it keeps any, to the list.
+  virtual void BuildStatisticalInformationList(StatisticalInformationList &) { }
+
   // Resets the device.
   virtual void Reset();
 
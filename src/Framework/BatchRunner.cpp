@@ -0,0 +1,229 @@
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <ostream>
+#include <sstream>
+
+#include "Framework/BasicCPU.hpp"
+#include "Framework/BasicDeviceRegistry.hpp"
+#include "Framework/BasicLoader.hpp"
+#include "Framework/BatchRunner.hpp"
+#include "Framework/RegInfo.hpp"
+#include "Framework/StatInfo.hpp"
+
+namespace {
+// Returns the string as a JSON string literal
+std::string Quote(const std::string &s) {
+  std::ostringstream out;
+  out << '"';
+  for (unsigned char c : s) {
+    if (c == '"' || c == '\\') {
+      out << '\\' << c;
+    } else if (c < 0x20) {
+      out << "\\u" << std::hex << std::setw(4) << std::setfill('0')
+          << static_cast<unsigned int>(c) << std::dec;
+    } else {
+      out << c;
+    }
+  }
+  out << '"';
+  return out.str();
+}
+
+// Names the exit statuses in the report
+const char *StatusName(int status) {
+  switch (status) {
+  case BatchRunner::EXIT_BREAK:
+    return "break";
+  case BatchRunner::EXIT_HALTED:
+    return "halted";
+  case BatchRunner::EXIT_INSTRUCTIONS:
+    return "instructions";
+  case BatchRunner::EXIT_CYCLES:
+    return "cycles";
+  case BatchRunner::EXIT_SECONDS:
+    return "seconds";
+  default:
+    return "error";
+  }
+}
+}  // namespace
+
+BatchRunner::BatchRunner(BasicCPU &cpu, BasicDeviceRegistry &registry,
+                         BasicLoader &loader)
+    : myCPU(cpu), myDeviceRegistry(registry), myLoader(loader) {}
+
+int BatchRunner::Run(const std::string &setup, const std::string &program,
+                     const Limits &limits, std::ostream &out) {
+  std::string message = Setup(setup);
+  if (message.empty())
+    message = myLoader.Load(program, 0);
+
+  int status = EXIT_ERROR;
+  uint64_t instructions = 0;
+  uint64_t startCycles = myCPU.Cycles();
+  std::chrono::steady_clock::time_point start =
+      std::chrono::steady_clock::now();
+  double seconds = 0;
+
+  if (message.empty()) {
+    myCPU.Reset();
+    startCycles = myCPU.Cycles();
+
+    // Breakpoints don't mean anything without a user to hand control to
+    const BasicCPU::StopConditions stop = {nullptr};
+    for (;;) {
+      size_t count = CHUNK;
+      if (limits.instructions != 0) {
+        if (instructions >= limits.instructions) {
+          status = EXIT_INSTRUCTIONS;
+          break;
+        }
+        count = std::min<uint64_t>(count, limits.instructions - instructions);
+      }
+      if (limits.cycles != 0) {
+        uint64_t cycles = myCPU.Cycles() - startCycles;
+        if (cycles >= limits.cycles) {
+          status = EXIT_CYCLES;
+          break;
+        }
+        // Run about half the instructions the cycles left are good for at
+        // the rate so far, so the run ends at the instruction reaching it
+        if (instructions == 0) {
+          count = 1;
+        } else {
+          uint64_t rate = cycles / instructions + 1;
+          count = std::min<uint64_t>(count,
+                                     (limits.cycles - cycles) / (2 * rate) + 1);
+        }
+      }
+      if (limits.seconds != 0) {
+        seconds = std::chrono::duration<double>(
+                      std::chrono::steady_clock::now() - start).count();
+        if (seconds >= limits.seconds) {
+          status = EXIT_SECONDS;
+          break;
+        }
+      }
+
+      BasicCPU::ExecuteResult result = myCPU.Execute(count, stop);
+      instructions += result.instructions;
+      if (result.reason == BasicCPU::STOP_BREAK) {
+        status = EXIT_BREAK;
+      } else if (result.reason == BasicCPU::STOP_HALTED) {
+        status = EXIT_HALTED;
+      } else {
+        continue;
+      }
+      message = BasicCPU::StopMessage(result.reason);
+      break;
+    }
+    if (status == EXIT_INSTRUCTIONS)
+      message = "Instruction limit reached";
+    else if (status == EXIT_CYCLES)
+      message = "Clock cycle limit reached";
+    else if (status == EXIT_SECONDS)
+      message = "Time limit reached";
+  }
+  seconds = std::chrono::duration<double>(
+                std::chrono::steady_clock::now() - start).count();
+
+  out << "{\n"
+      << "  \"status\": " << Quote(StatusName(status)) << ",\n"
+      << "  \"exit\": " << status << ",\n"
+      << "  \"message\": " << Quote(message) << ",\n"
+      << "  \"instructions\": " << instructions << ",\n"
+      << "  \"cycles\": " << myCPU.Cycles() - startCycles << ",\n"
+      << "  \"seconds\": " << std::fixed << std::setprecision(6) << seconds
+      << ",\n";
+
+  out << "  \"registers\": {";
+  RegisterInformationList registers(myCPU);
+  for (size_t t = 0; t < registers.NumberOfElements(); ++t) {
+    RegisterInformation info;
+    registers.Element(t, info);
+    out << (t == 0 ? "\n" : ",\n") << "    " << Quote(info.Name()) << ": "
+        << Quote(info.HexValue());
+  }
+  out << "\n  },\n";
+
+  out << "  \"statistics\": [";
+  StatisticalInformationList statistics(myCPU);
+  for (size_t t = 0; t < statistics.NumberOfElements(); ++t) {
+    StatisticInformation info;
+    statistics.Element(t, info);
+    out << (t == 0 ? "\n" : ",\n") << "    " << Quote(info.Statistic());
+  }
+  out << "\n  ]\n}" << std::endl;
+
+  return status;
+}
+
+std::string BatchRunner::Setup(const std::string &filename) {
+  std::ifstream file(filename);
+  if (!file)
+    return "Couldn't open the setup file " + filename;
+
+  std::string line;
+  if (!std::getline(file, line) || line != "BSVC Simulator Setup File")
+    return filename + " isn't a BSVC setup file";
+
+  while (std::getline(file, line)) {
+    std::istringstream in(line);
+    std::string keyword;
+    char c;
+    if (!(in >> keyword))
+      continue;
+    in >> c;
+    std::string value;
+    std::getline(in, value);
+    // The value runs to the brace matching the opening one
+    size_t end = value.find_last_of('}');
+    if (c != '{' || end == std::string::npos)
+      return "Invalid setup file line: " + line;
+    value.erase(end);
+
+    if (keyword == "SIMULATOR") {
+      if (value != "sim" + myCPU.Name())
+        return "The setup file is for " + value + ", not sim" + myCPU.Name();
+    } else if (keyword == "COMMAND") {
+      std::istringstream command(value);
+      std::string name;
+      command >> name;
+      if (name != "AttachDevice")
+        return "Unsupported setup file command: " + name;
+      std::string args;
+      std::getline(command, args);
+      std::string error = AttachDevice(args);
+      if (!error.empty())
+        return error;
+    }
+  }
+  return "";
+}
+
+std::string BatchRunner::AttachDevice(const std::string &args) {
+  std::istringstream in(args);
+  std::string name;
+  std::string deviceArgs;
+  size_t addressSpace;
+  char c;
+
+  in >> addressSpace >> name >> c;
+  in.unsetf(std::ios::skipws);
+
+  if (!in || c != '{')
+    return "Invalid arguments: AttachDevice" + args;
+  std::getline(in, deviceArgs, '}');
+  if (!in)
+    return "Invalid arguments: AttachDevice" + args;
+  if (addressSpace >= myCPU.NumberOfAddressSpaces())
+    return "Invalid address space: AttachDevice" + args;
+
+  BasicDevice *device;
+  if (!myDeviceRegistry.Create(name, deviceArgs, myCPU, device))
+    return "Couldn't create the device: AttachDevice" + args;
+  myCPU.addressSpace(addressSpace).AttachDevice(device);
+  return "";
+}
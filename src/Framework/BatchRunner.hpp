@@ -0,0 +1,63 @@
+//
+// Runs a program without a user interface: attaches the devices a BSVC
+// setup file lists, loads the program, runs it until it stops or a limit
+// is reached and reports the outcome, registers and statistics as JSON.
+// Meant for regression runs driven by scripts.
+//
+
+#ifndef FRAMEWORK_BATCHRUNNER_HPP_
+#define FRAMEWORK_BATCHRUNNER_HPP_
+
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+
+class BasicCPU;
+class BasicDeviceRegistry;
+class BasicLoader;
+
+class BatchRunner {
+public:
+  // Exit statuses, one for each way a run can end.
+  enum Status {
+    EXIT_BREAK = 0,         // Executed a BREAK instruction
+    EXIT_ERROR = 1,         // The setup or program couldn't be loaded
+    EXIT_HALTED = 2,        // The CPU halted
+    EXIT_INSTRUCTIONS = 3,  // Reached the instruction limit
+    EXIT_CYCLES = 4,        // Reached the clock cycle limit
+    EXIT_SECONDS = 5,       // Reached the wall clock limit
+  };
+
+  // Limits on a run, zero meaning none.
+  struct Limits {
+    Limits() : instructions(0), cycles(0), seconds(0) { }
+    uint64_t instructions;
+    uint64_t cycles;
+    double seconds;
+  };
+
+  BatchRunner(BasicCPU &cpu, BasicDeviceRegistry &registry,
+              BasicLoader &loader);
+
+  // Sets up the simulator from the setup file, runs the program within
+  // the limits and writes the report.  Returns the exit status.
+  int Run(const std::string &setup, const std::string &program,
+          const Limits &limits, std::ostream &out);
+
+private:
+  // Instructions run between looks at the clock cycle and wall clock limits.
+  static const size_t CHUNK = 4096;
+
+  // Performs the commands in the setup file, returns an error message or
+  // the empty string.
+  std::string Setup(const std::string &filename);
+
+  // Performs an "AttachDevice space name {args}" command from a setup file.
+  std::string AttachDevice(const std::string &args);
+
+  BasicCPU &myCPU;
+  BasicDeviceRegistry &myDeviceRegistry;
+  BasicLoader &myLoader;
+};
+
+#endif  // FRAMEWORK_BATCHRUNNER_HPP_
@@ -0,0 +1,332 @@
+#include <cstdio>
+#include <istream>
+#include <ostream>
+#include <vector>
+
+#include "Framework/AddressSpace.hpp"
+#include "Framework/BasicCPU.hpp"
+#include "Framework/BasicLoader.hpp"
+#include "Framework/BinaryProtocol.hpp"
+#include "Framework/BreakpointList.hpp"
+#include "Framework/RegInfo.hpp"
+#include "Framework/StatInfo.hpp"
+
+namespace {
+// Appends a little endian integer of the given number of bytes
+void Put(std::string &s, uint64_t value, size_t bytes) {
+  for (size_t t = 0; t < bytes; ++t)
+    s += static_cast<char>((value >> (8 * t)) & 0xff);
+}
+
+// Gets a little endian integer of the given number of bytes
+uint64_t Get(const char *p, size_t bytes) {
+  uint64_t value = 0;
+  for (size_t t = 0; t < bytes; ++t)
+    value |= uint64_t(static_cast<unsigned char>(p[t])) << (8 * t);
+  return value;
+}
+}  // namespace
+
+class BinaryProtocol::Reader {
+public:
+  Reader(const char *data, size_t length) : myData(data), myLeft(length) {}
+
+  // Gets an integer of the given number of bytes, returns false if the
+  // payload is too short.
+  template <class T>
+  bool Get(T &value, size_t bytes) {
+    if (myLeft < bytes)
+      return false;
+    value = static_cast<T>(::Get(myData, bytes));
+    myData += bytes;
+    myLeft -= bytes;
+    return true;
+  }
+
+  // Gets the rest of the payload
+  std::string Rest() {
+    std::string rest(myData, myLeft);
+    myData += myLeft;
+    myLeft = 0;
+    return rest;
+  }
+
+  // Returns true iff the whole payload has been read
+  bool Finished() const { return myLeft == 0; }
+
+private:
+  const char *myData;
+  size_t myLeft;
+};
+
+BinaryProtocol::BinaryProtocol(BasicCPU &cpu, BreakpointList &breakpoints,
+                               BasicLoader &loader, std::istream &in,
+                               std::ostream &out)
+    : myCPU(cpu), myBreakpoints(breakpoints), myLoader(loader), myInput(in),
+      myOutput(out), myDone(false) {}
+
+std::string BinaryProtocol::Serve() {
+  std::vector<char> message;
+  while (!myDone) {
+    char header[4];
+    if (!myInput.read(header, sizeof(header)))
+      return "Connection closed";
+    size_t length = ::Get(header, sizeof(header));
+    if (length > MAXIMUM_MESSAGE)
+      return "Message too long";
+    message.resize(length);
+    if (!myInput.read(message.data(), length))
+      return "Connection closed";
+
+    // Handle each request, stopping at the first one that's cut short
+    std::string reply;
+    size_t position = 0;
+    while (position < length && !myDone) {
+      size_t left = length - position;
+      size_t size = left < 5 ? 0 : ::Get(&message[position + 1], 4);
+      if (left < 5 || size > left - 5) {
+        reply += static_cast<char>(INVALID_ARGUMENTS);
+        Put(reply, 0, 4);
+        break;
+      }
+      unsigned int request = static_cast<unsigned char>(message[position]);
+      Reader payload(&message[position + 5], size);
+      position += 5 + size;
+      HandleRequest(request, payload, reply);
+    }
+
+    std::string frame;
+    Put(frame, reply.size(), 4);
+    myOutput.write(frame.data(), frame.size());
+    myOutput.write(reply.data(), reply.size());
+    myOutput.flush();
+  }
+  return "";
+}
+
+void BinaryProtocol::HandleRequest(unsigned int request, Reader &payload,
+                                   std::string &reply) {
+  std::string result;
+  Status status = OK;
+  Address address;
+
+  switch (request) {
+  case END:
+    myDone = true;
+    break;
+  case READ_MEMORY:
+    status = ReadMemory(payload, result);
+    break;
+  case WRITE_MEMORY:
+    status = WriteMemory(payload, result);
+    break;
+  case REGISTER_NAMES:
+    status = ReadRegisters(result, true);
+    break;
+  case READ_REGISTERS:
+    status = ReadRegisters(result, false);
+    break;
+  case WRITE_REGISTER:
+    status = WriteRegister(payload, result);
+    break;
+  case ADD_BREAKPOINT:
+    if (!payload.Get(address, 4))
+      status = INVALID_ARGUMENTS;
+    else
+      myBreakpoints.Add(address);
+    break;
+  case DELETE_BREAKPOINT:
+    if (!payload.Get(address, 4)) {
+      status = INVALID_ARGUMENTS;
+    } else if (!myBreakpoints.Delete(address)) {
+      status = FAILED;
+      result = "Couldn't delete breakpoint!";
+    }
+    break;
+  case STEP:
+    status = Step(payload, result);
+    break;
+  case RUN:
+    status = Run(payload, result);
+    break;
+  case RESET:
+    myCPU.Reset();
+    break;
+  case STATISTICS: {
+    StatisticalInformationList list(myCPU);
+    for (size_t t = 0; t < list.NumberOfElements(); ++t) {
+      StatisticInformation info;
+      list.Element(t, info);
+      result += info.Statistic() + '\n';
+    }
+    break;
+  }
+  case LOAD_PROGRAM:
+    status = LoadProgram(payload, result);
+    break;
+  default:
+    status = UNKNOWN_REQUEST;
+    result = "Unknown request!";
+    break;
+  }
+  if (status == INVALID_ARGUMENTS)
+    result = "Invalid arguments!";
+
+  reply += static_cast<char>(status);
+  Put(reply, result.size(), 4);
+  reply += result;
+}
+
+// Reads a block of memory, noting the locations that aren't mapped
+BinaryProtocol::Status BinaryProtocol::ReadMemory(Reader &payload,
+                                                  std::string &reply) {
+  size_t space;
+  Address address;
+  size_t length;
+  if (!payload.Get(space, 1) || !payload.Get(address, 4) ||
+      !payload.Get(length, 4) || !payload.Finished() ||
+      length > MAXIMUM_READ) {
+    return INVALID_ARGUMENTS;
+  }
+  if (space >= myCPU.NumberOfAddressSpaces()) {
+    reply = "Invalid address space!";
+    return FAILED;
+  }
+
+  std::vector<Byte> block(length);
+  std::string mapped((length + 7) / 8, static_cast<char>(0xff));
+  for (size_t done = 0; done < length; ++done) {
+    done += myCPU.addressSpace(space).ReadBlock(address + done, &block[done],
+                                                length - done);
+    if (done < length) {
+      block[done] = 0;
+      mapped[done / 8] &= ~(1 << (done % 8));
+    }
+  }
+  if (length % 8 != 0)
+    mapped.back() &= (1 << (length % 8)) - 1;
+  reply.assign(block.begin(), block.end());
+  reply += mapped;
+  return OK;
+}
+
+// Writes a block of memory, carrying on past locations that aren't mapped
+BinaryProtocol::Status BinaryProtocol::WriteMemory(Reader &payload,
+                                                   std::string &reply) {
+  size_t space;
+  Address address;
+  if (!payload.Get(space, 1) || !payload.Get(address, 4))
+    return INVALID_ARGUMENTS;
+  if (space >= myCPU.NumberOfAddressSpaces()) {
+    reply = "Invalid address space!";
+    return FAILED;
+  }
+
+  std::string data = payload.Rest();
+  const Byte *bytes = reinterpret_cast<const Byte *>(data.data());
+  size_t written = 0;
+  for (size_t done = 0; done < data.size(); ++done) {
+    size_t count = myCPU.addressSpace(space).WriteBlock(
+        address + done, bytes + done, data.size() - done);
+    written += count;
+    done += count;
+  }
+  Put(reply, written, 4);
+  return OK;
+}
+
+// Lists the registers' names or values
+BinaryProtocol::Status BinaryProtocol::ReadRegisters(std::string &reply,
+                                                     bool names) {
+  RegisterInformationList list(myCPU);
+  for (size_t t = 0; t < list.NumberOfElements(); ++t) {
+    RegisterInformation info;
+    list.Element(t, info);
+    if (names) {
+      reply += info.Name();
+      reply += '\0';
+    } else {
+      Put(reply, std::stoull(info.HexValue(), nullptr, 16), 8);
+    }
+  }
+  return OK;
+}
+
+BinaryProtocol::Status BinaryProtocol::WriteRegister(Reader &payload,
+                                                     std::string &reply) {
+  size_t index;
+  uint64_t value;
+  if (!payload.Get(index, 1) || !payload.Get(value, 8) || !payload.Finished())
+    return INVALID_ARGUMENTS;
+
+  RegisterInformationList list(myCPU);
+  RegisterInformation info;
+  if (!list.Element(index, info)) {
+    reply = "Invalid register name!";
+    return FAILED;
+  }
+  char hex[17];
+  snprintf(hex, sizeof(hex), "%llx", static_cast<unsigned long long>(value));
+  myCPU.SetRegister(info.Name(), hex);
+  return OK;
+}
+
+// Executes some instructions without stopping at breakpoints, listing the
+// address of each one if asked to
+BinaryProtocol::Status BinaryProtocol::Step(Reader &payload,
+                                            std::string &reply) {
+  size_t count;
+  unsigned int trace;
+  if (!payload.Get(count, 4) || !payload.Get(trace, 1) || !payload.Finished())
+    return INVALID_ARGUMENTS;
+
+  const BasicCPU::StopConditions stop = {nullptr};
+  BasicCPU::ExecuteResult result = {BasicCPU::STOP_LIMIT, 0};
+  std::string addresses;
+  if (trace) {
+    while (result.instructions < count) {
+      Address pc = myCPU.ValueOfProgramCounter();
+      BasicCPU::ExecuteResult one = myCPU.Execute(1, stop);
+      if (one.instructions != 0)
+        Put(addresses, pc, 4);
+      result.instructions += one.instructions;
+      result.reason = one.reason;
+      if (one.reason != BasicCPU::STOP_LIMIT)
+        break;
+    }
+  } else if (count != 0) {
+    result = myCPU.Execute(count, stop);
+  }
+  Put(reply, result.reason, 1);
+  Put(reply, result.instructions, 4);
+  reply += addresses;
+  return OK;
+}
+
+BinaryProtocol::Status BinaryProtocol::Run(Reader &payload,
+                                           std::string &reply) {
+  size_t limit;
+  if (!payload.Get(limit, 4) || !payload.Finished())
+    return INVALID_ARGUMENTS;
+
+  const BasicCPU::StopConditions stop = {&myBreakpoints};
+  BasicCPU::ExecuteResult result = {BasicCPU::STOP_LIMIT, 0};
+  if (limit != 0)
+    result = myCPU.Execute(limit, stop);
+  Put(reply, result.reason, 1);
+  Put(reply, result.instructions, 4);
+  return OK;
+}
+
+BinaryProtocol::Status BinaryProtocol::LoadProgram(Reader &payload,
+                                                   std::string &reply) {
+  size_t space;
+  if (!payload.Get(space, 1))
+    return INVALID_ARGUMENTS;
+  if (space >= myCPU.NumberOfAddressSpaces()) {
+    reply = "Invalid address space!";
+    return FAILED;
+  }
+  reply = myLoader.Load(payload.Rest(), space);
+  return reply.empty() ? OK : FAILED;
+}
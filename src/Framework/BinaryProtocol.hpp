@@ -0,0 +1,117 @@
+//
+// Serves a binary framed control protocol on the user interface streams, so
+// automation can batch many requests in one round trip and move memory in
+// bulk instead of paying for a line of text for each command and value.
+//
+// Every message, in both directions, is a 32-bit length followed by that
+// many bytes holding a sequence of records.  A request record is a one byte
+// request code, a 32-bit payload length and the payload; the reply message
+// has a record for each request, in order, made of a one byte status, a
+// 32-bit payload length and the payload.  A failed request's payload is an
+// error message.  Integers are little endian and addresses are in bytes.
+//
+//   Request            Payload                     Reply payload
+//   END                -                           -
+//   READ_MEMORY        space:8 address:32 length:32
+//                                                  the bytes, then a bit
+//                                                  for each set iff mapped
+//   WRITE_MEMORY       space:8 address:32 bytes    count written:32
+//   REGISTER_NAMES     -                           names, each ending in 0
+//   READ_REGISTERS     -                           value:64 for each
+//   WRITE_REGISTER     index:8 value:64            -
+//   ADD_BREAKPOINT     address:32                  -
+//   DELETE_BREAKPOINT  address:32                  -
+//   STEP               count:32 trace:8            reason:8 count:32 and,
+//                                                  if tracing, the PC:32
+//                                                  of each instruction
+//   RUN                limit:32                    reason:8 count:32
+//   RESET              -                           -
+//   STATISTICS         -                           lines, each ending in \n
+//   LOAD_PROGRAM       space:8 filename            -
+//
+// STEP ignores breakpoints, RUN stops at them and after limit instructions.
+// Reasons are BasicCPU::StopReason values.  Registers are numbered in the
+// order of the CPU's register list.  The session ends after the message
+// with an END request, which returns the streams to the text commands.
+//
+
+#ifndef FRAMEWORK_BINARYPROTOCOL_HPP_
+#define FRAMEWORK_BINARYPROTOCOL_HPP_
+
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+
+class BasicCPU;
+class BasicLoader;
+class BreakpointList;
+
+class BinaryProtocol {
+public:
+  // Request codes.
+  enum Request {
+    END = 0,
+    READ_MEMORY = 1,
+    WRITE_MEMORY = 2,
+    REGISTER_NAMES = 3,
+    READ_REGISTERS = 4,
+    WRITE_REGISTER = 5,
+    ADD_BREAKPOINT = 6,
+    DELETE_BREAKPOINT = 7,
+    STEP = 8,
+    RUN = 9,
+    RESET = 10,
+    STATISTICS = 11,
+    LOAD_PROGRAM = 12,
+  };
+
+  // Reply statuses.
+  enum Status {
+    OK = 0,
+    UNKNOWN_REQUEST = 1,
+    INVALID_ARGUMENTS = 2,
+    FAILED = 3,
+  };
+
+  BinaryProtocol(BasicCPU &cpu, BreakpointList &breakpoints,
+                 BasicLoader &loader, std::istream &in, std::ostream &out);
+
+  // Handles messages until one ends the session.  Returns an error message
+  // or the empty string.
+  std::string Serve();
+
+private:
+  // Longest message accepted, in bytes.
+  static const size_t MAXIMUM_MESSAGE = 1 << 24;
+
+  // Longest memory range a request may read, in bytes.
+  static const size_t MAXIMUM_READ = 1 << 22;
+
+  // Walks through the payload of a request.
+  class Reader;
+
+  // Handles the request, appending its reply to the message.  Sets myDone
+  // if it ends the session.
+  void HandleRequest(unsigned int request, Reader &payload,
+                     std::string &reply);
+
+  // Handlers for the requests, returning the reply status.
+  Status ReadMemory(Reader &payload, std::string &reply);
+  Status WriteMemory(Reader &payload, std::string &reply);
+  Status ReadRegisters(std::string &reply, bool names);
+  Status WriteRegister(Reader &payload, std::string &reply);
+  Status Step(Reader &payload, std::string &reply);
+  Status Run(Reader &payload, std::string &reply);
+  Status LoadProgram(Reader &payload, std::string &reply);
+
+  BasicCPU &myCPU;
+  BreakpointList &myBreakpoints;
+  BasicLoader &myLoader;
+  std::istream &myInput;
+  std::ostream &myOutput;
+
+  // Set when the session is over
+  bool myDone;
+};
+
+#endif  // FRAMEWORK_BINARYPROTOCOL_HPP_
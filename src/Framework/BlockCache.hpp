@@ -0,0 +1,141 @@
+//
+// Caches predecoded instructions grouped into basic blocks so a CPU can
+// run straight through a block without refetching and redecoding opcodes
+// or refetching their extension words.
+// Blocks that run often are handed to an optional specializer which may
+// replace their handlers with specialized versions.
+//
+
+#ifndef FRAMEWORK_BLOCKCACHE_HPP_
+#define FRAMEWORK_BLOCKCACHE_HPP_
+
+#include <cstddef>
+#include <cstring>
+#include <unordered_map>
+#include <vector>
+
+#include "Framework/Types.hpp"
+
+template <class Handler, size_t OperandBytes>
+class BlockCache {
+public:
+  // A predecoded instruction.
+  struct Entry {
+    Address address;
+    unsigned int opcode;
+    Handler execute;
+
+    // Clock cycles the instruction takes, not counting data dependent ones.
+    unsigned int cycles;
+
+    // Specialized handler for untraced execution or nullptr.
+    Handler specialized;
+
+    // The bytes of the instruction after its opcode word, as many of them
+    // as could be read.
+    size_t length;
+    Byte operands[OperandBytes];
+  };
+
+  // Returns a specialized handler for the instruction or nullptr.
+  typedef Handler (*Specializer)(unsigned int opcode, Handler execute);
+
+  // Number of times a block has to be entered before it's specialized.
+  static const unsigned long HOT_BLOCK_RUNS = 16;
+
+  BlockCache()
+      : myBlock(nullptr), myNext(0), myOpen(false), myGeneration(0),
+        mySpecializer(nullptr) { }
+
+  // Sets the specializer used for hot blocks, nullptr disables it.
+  void SetSpecializer(Specializer specializer) {
+    mySpecializer = specializer;
+    Flush();
+  }
+
+  // Returns the cached instruction at the given address or nullptr.  The
+  // cache is flushed first if the code generation has changed.
+  const Entry *Find(Address address, unsigned long generation) {
+    if (generation != myGeneration) {
+      Flush();
+      myGeneration = generation;
+    }
+
+    // Fast path: the next instruction of the current block.
+    if (myBlock != nullptr && myNext < myBlock->entries.size() &&
+        myBlock->entries[myNext].address == address) {
+      return &myBlock->entries[myNext++];
+    }
+
+    // Start of some other block we've already seen.
+    auto it = myBlocks.find(address);
+    if (it != myBlocks.end()) {
+      myBlock = &it->second;
+      myNext = 1;
+      myOpen = false;
+      if (++myBlock->runs == HOT_BLOCK_RUNS && mySpecializer != nullptr) {
+        for (Entry &entry : myBlock->entries)
+          entry.specialized = mySpecializer(entry.opcode, entry.execute);
+      }
+      return &myBlock->entries.front();
+    }
+
+    // Extend the current block only if we just fell off its end.
+    myOpen = myBlock != nullptr && myNext == myBlock->entries.size() && myOpen;
+    return nullptr;
+  }
+
+  // Adds a decoded instruction after a failed Find for the same address,
+  // given the length bytes after its opcode word.  Blocks are closed by
+  // instructions that may transfer control.
+  const Entry *Insert(Address address, unsigned int opcode, Handler execute,
+                      unsigned int cycles, bool endsBlock,
+                      const Byte *operands, size_t length) {
+    if (!myOpen) {
+      myBlock = &myBlocks[address];
+    }
+    Handler specialized = nullptr;
+    if (myBlock->runs >= HOT_BLOCK_RUNS && mySpecializer != nullptr)
+      specialized = mySpecializer(opcode, execute);
+    myBlock->entries.push_back(
+        Entry{address, opcode, execute, cycles, specialized, length, {}});
+    std::memcpy(myBlock->entries.back().operands, operands, length);
+    myNext = myBlock->entries.size();
+    myOpen = !endsBlock;
+    return &myBlock->entries.back();
+  }
+
+  // Discards all of the cached blocks.
+  void Flush() {
+    myBlocks.clear();
+    myBlock = nullptr;
+    myNext = 0;
+    myOpen = false;
+  }
+
+private:
+  // A basic block and the number of times it has been entered.
+  struct Block {
+    Block() : runs(0) { }
+    std::vector<Entry> entries;
+    unsigned long runs;
+  };
+
+  // Blocks indexed by the address of their first instruction.
+  std::unordered_map<Address, Block> myBlocks;
+
+  // Block being executed and the index of its next instruction.
+  Block *myBlock;
+  size_t myNext;
+
+  // True iff the current block can still be extended.
+  bool myOpen;
+
+  // Code generation of the address space the blocks were decoded from.
+  unsigned long myGeneration;
+
+  // Specializer for hot blocks or nullptr.
+  Specializer mySpecializer;
+};
+
+#endif  // FRAMEWORK_BLOCKCACHE_HPP_
@@ -8,6 +8,8 @@
 #include <iterator>
 #include <set>
 
+#include "Framework/Types.hpp"
+
 class BreakpointList {
 public:
   // Adds a break point to the list.
@@ -36,6 +38,11 @@ public:
     return true;
   }
 
+  // Returns true iff there are no breakpoints.
+  bool Empty() const {
+    return breakpoints.empty();
+  }
+
   // Returns true iff the given address is a breakpoint.
   bool Check(Address address) const {
     return breakpoints.find(address) != breakpoints.end();
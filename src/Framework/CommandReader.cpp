@@ -0,0 +1,94 @@
+#include <cerrno>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+
+#include "Framework/CommandReader.hpp"
+
+CommandReader::CommandReader(int descriptor)
+    : myDescriptor(descriptor), myWakeRead(-1), myWakeWrite(-1), myEnd(false),
+      myArrived(false) {
+  int ids[2];
+  if (pipe(ids) == 0) {
+    myWakeRead = ids[0];
+    myWakeWrite = ids[1];
+    fcntl(myWakeRead, F_SETFD, 1);
+    fcntl(myWakeWrite, F_SETFD, 1);
+    myThread = std::thread(&CommandReader::Run, this);
+  }
+}
+
+CommandReader::~CommandReader() {
+  if (myThread.joinable()) {
+    char c = 0;
+    if (write(myWakeWrite, &c, 1) < 0) {
+      // Nothing else writes to the pipe, so this can't happen
+    }
+    myThread.join();
+  }
+  if (myWakeRead != -1) {
+    close(myWakeRead);
+    close(myWakeWrite);
+  }
+}
+
+CommandReader::int_type CommandReader::underflow() {
+  if (gptr() < egptr())
+    return traits_type::to_int_type(*gptr());
+
+  // Without a thread read the descriptor here
+  if (!myThread.joinable()) {
+    myBuffer.resize(READ_SIZE);
+    ssize_t count;
+    do {
+      count = read(myDescriptor, &myBuffer[0], myBuffer.size());
+    } while (count < 0 && errno == EINTR);
+    if (count <= 0)
+      return traits_type::eof();
+    myBuffer.resize(count);
+  } else {
+    std::unique_lock<std::mutex> lock(myMutex);
+    myReady.wait(lock, [this] { return !myPending.empty() || myEnd; });
+    if (myPending.empty())
+      return traits_type::eof();
+    myBuffer.swap(myPending);
+    myPending.clear();
+    myArrived.store(false);
+  }
+  setg(&myBuffer[0], &myBuffer[0], &myBuffer[0] + myBuffer.size());
+  return traits_type::to_int_type(*gptr());
+}
+
+void CommandReader::Run() {
+  char buffer[READ_SIZE];
+  for (;;) {
+    struct pollfd fds[2] = {{myDescriptor, POLLIN, 0},
+                            {myWakeRead, POLLIN, 0}};
+    int ready = poll(fds, 2, -1);
+    if (ready < 0 && errno == EINTR)
+      continue;
+    // Only the destructor writes the wake pipe and it reads nothing more
+    if (ready >= 0 && fds[1].revents != 0)
+      return;
+
+    ssize_t count = -1;
+    if (ready >= 0) {
+      count = read(myDescriptor, buffer, sizeof(buffer));
+      if (count < 0 && (errno == EINTR || errno == EAGAIN))
+        continue;
+    }
+
+    // A failed poll or read ends the input like end of file, so a reader
+    // waiting in underflow() sees it rather than blocking forever
+    std::lock_guard<std::mutex> lock(myMutex);
+    if (count > 0)
+      myPending.append(buffer, count);
+    else
+      myEnd = true;
+    myArrived.store(true);
+    myReady.notify_one();
+    if (myEnd)
+      return;
+  }
+}
@@ -0,0 +1,68 @@
+//
+// Reads the user interface's commands on a background thread, so a running
+// CPU can notice that one has arrived by looking at a flag instead of asking
+// the operating system every so often.  The commands are read back through
+// this stream buffer, as lines or as binary messages.
+//
+
+#ifndef FRAMEWORK_COMMANDREADER_HPP_
+#define FRAMEWORK_COMMANDREADER_HPP_
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <streambuf>
+#include <string>
+#include <thread>
+
+class CommandReader : public std::streambuf {
+public:
+  // Starts reading the descriptor.
+  explicit CommandReader(int descriptor);
+
+  // Stops the thread, dropping anything it hasn't been asked for.
+  ~CommandReader();
+
+  CommandReader(const CommandReader &) = delete;
+  CommandReader &operator=(const CommandReader &) = delete;
+
+  // Set whenever input arrives and until it's all been taken into the
+  // stream buffer, or for good once the input has ended.
+  const std::atomic<bool> &Arrived() const { return myArrived; }
+
+  // Returns true iff there's input that hasn't been read yet.
+  bool Waiting() { return gptr() < egptr() || myArrived.load(); }
+
+protected:
+  // Waits for input and makes it the stream buffer's contents.
+  int_type underflow() override;
+
+private:
+  // Most bytes read from the descriptor at a time.
+  static const size_t READ_SIZE = 4096;
+
+  // Body of the reading thread.
+  void Run();
+
+  const int myDescriptor;
+
+  // Pipe the destructor writes to so the thread stops polling
+  int myWakeRead;
+  int myWakeWrite;
+
+  // Bytes read by the thread and not taken by underflow yet, and whether
+  // the input has ended, guarded by myMutex
+  std::mutex myMutex;
+  std::condition_variable myReady;
+  std::string myPending;
+  bool myEnd;
+
+  std::atomic<bool> myArrived;
+
+  // The bytes the stream is reading
+  std::string myBuffer;
+
+  std::thread myThread;
+};
+
+#endif  // FRAMEWORK_COMMANDREADER_HPP_
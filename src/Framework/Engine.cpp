@@ -0,0 +1,57 @@
+#include <memory>
+#include <ostream>
+#include <sstream>
+
+#include "Framework/BasicCPU.hpp"
+#include "Framework/BasicLoader.hpp"
+#include "Framework/Engine.hpp"
+
+Engine::Engine(const CPUFactory &newCPU, BasicDeviceRegistry &registry,
+               const LoaderFactory &newLoader, size_t threads)
+    : myNewCPU(newCPU), myDeviceRegistry(registry), myNewLoader(newLoader),
+      myPool(threads) { }
+
+// Queue the job, answering where its result will appear
+std::future<EngineResult> Engine::Submit(const EngineJob &job) {
+  // The pool wants copyable tasks but packaged tasks can only be moved
+  auto task = std::make_shared<std::packaged_task<EngineResult()>>(
+      [this, job]() { return Run(job); });
+  auto result = task->get_future();
+  myPool.Submit([task]() { (*task)(); });
+  return result;
+}
+
+// Build the machine and run the job on it, keeping the report
+EngineResult Engine::Run(const EngineJob &job) const {
+  std::unique_ptr<BasicCPU> cpu(myNewCPU());
+  std::unique_ptr<BasicLoader> loader(myNewLoader(*cpu));
+  BatchRunner runner(*cpu, myDeviceRegistry, *loader);
+
+  std::ostringstream report;
+  EngineResult result;
+  result.status = runner.Run(job.setup, job.program, job.limits, report);
+  result.report = report.str();
+  return result;
+}
+
+// Run the jobs, printing each report once it and the ones before are done
+int Engine::RunAll(const std::vector<EngineJob> &jobs, std::ostream &out) {
+  std::vector<std::future<EngineResult>> results;
+  for (const auto &job : jobs)
+    results.push_back(Submit(job));
+
+  int status = BatchRunner::EXIT_BREAK;
+  out << "[";
+  for (size_t t = 0; t < results.size(); ++t) {
+    EngineResult result = results[t].get();
+    if (status == BatchRunner::EXIT_BREAK)
+      status = result.status;
+
+    // Drop the report's newline so the separator follows its brace
+    if (!result.report.empty() && result.report.back() == '\n')
+      result.report.pop_back();
+    out << (t == 0 ? "\n" : ",\n") << result.report;
+  }
+  out << "\n]" << std::endl;
+  return status;
+}
@@ -0,0 +1,79 @@
+//
+// Runs many independent simulated machines in one process.  Each job
+// names a setup file and a program, as the -run option does, and gets a
+// machine of its own built from scratch on one of the engine's worker
+// threads, run by a BatchRunner until it stops or reaches its limits and
+// then torn down again, so jobs share nothing but the read only tables of
+// the simulator.
+//
+
+#ifndef FRAMEWORK_ENGINE_HPP_
+#define FRAMEWORK_ENGINE_HPP_
+
+#include <cstddef>
+#include <functional>
+#include <future>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+#include "Framework/BatchRunner.hpp"
+#include "Framework/ThreadPool.hpp"
+
+class BasicCPU;
+class BasicDeviceRegistry;
+class BasicLoader;
+
+// A program to run and the setup of the machine to run it on.
+struct EngineJob {
+  std::string setup;
+  std::string program;
+  BatchRunner::Limits limits;
+};
+
+// What running a job did.
+struct EngineResult {
+  // One of BatchRunner's exit statuses.
+  int status;
+
+  // The JSON report BatchRunner wrote for the run.
+  std::string report;
+};
+
+class Engine {
+public:
+  // Creates a new CPU with its address spaces but no devices.
+  typedef std::function<BasicCPU *()> CPUFactory;
+
+  // Creates a loader for the CPU.
+  typedef std::function<BasicLoader *(BasicCPU &)> LoaderFactory;
+
+  // The registry is shared by all of the threads, so its Create must not
+  // change it.  The number of threads is one per host core if zero.
+  Engine(const CPUFactory &newCPU, BasicDeviceRegistry &registry,
+         const LoaderFactory &newLoader, size_t threads);
+
+  // Returns the number of jobs that can run at once.
+  size_t NumberOfThreads() const { return myPool.NumberOfThreads(); }
+
+  // Queues the job to run on a worker thread.
+  std::future<EngineResult> Submit(const EngineJob &job);
+
+  // Builds and runs the job on the calling thread.
+  EngineResult Run(const EngineJob &job) const;
+
+  // Runs the jobs on the worker threads and writes their reports, in the
+  // order of the jobs, as a JSON array.  Returns the exit status of the
+  // first job which didn't end with a BREAK instruction, or EXIT_BREAK.
+  int RunAll(const std::vector<EngineJob> &jobs, std::ostream &out);
+
+private:
+  const CPUFactory myNewCPU;
+  BasicDeviceRegistry &myDeviceRegistry;
+  const LoaderFactory myNewLoader;
+
+  // Destroyed first so no job outlives the rest of the engine.
+  ThreadPool myPool;
+};
+
+#endif  // FRAMEWORK_ENGINE_HPP_
@@ -1,71 +1,129 @@
 #include <algorithm>
-#include <ctime>
+#include <functional>
+#include <thread>
 
 #include "Framework/Event.hpp"
-#include "Framework/Time.hpp"
 
-EventHandler::EventHandler() : myIterations(0), myNSPerCheck(1000) {
-  myOldTime = Time::seconds();
-}
+EventHandler::EventHandler(const uint64_t &cycles, unsigned long clockRate)
+    : myCancelled(0), mySequence(0), myCycles(cycles),
+      myDeadline(NEVER),
+      myClockRate(clockRate), myPacing(false), myPaceCycles(0) { }
+
+EventBase::EventBase(EventHandler &handler)
+    : myEventHandler(handler), myEventOwner(handler.Register()) { }
 
 EventBase::~EventBase() {
   // Remove any events in the EventHandler for this object
   myEventHandler.Remove(this);
+  myEventHandler.Release(myEventOwner);
+}
+
+// Returns a new owner number for an object.
+size_t EventHandler::Register() {
+  if (!myFreeOwners.empty()) {
+    const size_t owner = myFreeOwners.back();
+    myFreeOwners.pop_back();
+    return owner;
+  }
+  myOwners.push_back(Owner{0, 0});
+  return myOwners.size() - 1;
+}
+
+// Makes the owner number of an object whose events have been removed free
+// for another.  Removing them started a new generation, so events of the
+// old object still in the heap are never taken for the new one's.
+void EventHandler::Release(size_t owner) {
+  myFreeOwners.push_back(owner);
 }
 
 // Checks for a expired events.
 void EventHandler::Check() {
-  myIterations = std::max<decltype(myIterations)>(myIterations + 1, 1);
-  auto now = Time::seconds();
-  if (now > myOldTime) {
-    constexpr NanoSeconds NS_PER_SECOND{1000000000L};
-    NanoSeconds delta_ns = (now - myOldTime) * NS_PER_SECOND;
-    myNSPerCheck = std::max<NanoSeconds>(delta_ns / myIterations, 1);
-    myOldTime = now;
-    myIterations = 0;
-  }
-  if (myEvents.empty()) {
-    return;
-  }
-  std::vector<Event> runnables;
-  auto nsec = myNSPerCheck;
-  do {
-    runnables.clear();
-    auto it = myEvents.begin();
-    for (; it != myEvents.end() && it->delta_time <= nsec; ++it) {
-      nsec -= it->delta_time;
-      runnables.push_back(*it);
-    }
-    myEvents.erase(myEvents.begin(), it);
-    if (!myEvents.empty()) {
-      myEvents[0].delta_time -= nsec;
+  if (myPacing)
+    WaitForRealTime();
+
+  // Dispatch the events that are due, including any they add which are
+  // also due by now
+  while (!myEvents.empty() && myEvents.front().time <= myCycles) {
+    std::pop_heap(myEvents.begin(), myEvents.end(), std::greater<Event>());
+    Event event = myEvents.back();
+    myEvents.pop_back();
+
+    Owner &owner = myOwners[event.owner];
+    if (event.generation != owner.generation) {
+      --myCancelled;
+      continue;
     }
-    for (auto event : runnables) { event.Dispatch(); }
-  } while (!runnables.empty());
+    --owner.pending;
+    event.Dispatch();
+  }
+
+  // Come back when the next event is due
+  myDeadline = NEVER;
+  if (myPacing)
+    myDeadline = myCycles + myClockRate * PACE_INTERVAL / 1000;
+  if (!myEvents.empty())
+    myDeadline = std::min(myDeadline, myEvents.front().time);
 }
 
 // Adds an event to the event list.
 void EventHandler::Add(EventBase *object, int data, void *pointer, USeconds etime) {
-  Event event{object, data, pointer, etime};
-  event.delta_time = etime * 1000;  // Time in nanoseconds.
-  NanoSeconds adelta = 0;
-  auto it = myEvents.begin();
-  for (; it != myEvents.end(); ++it) {
-    if (etime < (adelta + it->delta_time)) { break; }
-    adelta += it->delta_time;
-  }
-  event.delta_time -= adelta;
-  if (it != myEvents.end()) {
-    it->delta_time -= event.delta_time;
+  Owner &owner = myOwners[object->myEventOwner];
+  ++owner.pending;
+
+  // Round up to whole cycles so the event is never early
+  const uint64_t delay = static_cast<uint64_t>(std::max<USeconds>(etime, 0));
+  const uint64_t time = myCycles + (delay * myClockRate + 999999) / 1000000;
+  myEvents.push_back(Event(object, object->myEventOwner, owner.generation, data,
+                           pointer, time, mySequence++));
+  std::push_heap(myEvents.begin(), myEvents.end(), std::greater<Event>());
+  myDeadline = std::min(myDeadline, time);
+}
+
+// Sets whether simulated time is kept from running ahead of real time.
+void EventHandler::Pace(bool enable) {
+  myPacing = enable;
+  myPaceStart = std::chrono::steady_clock::now();
+  myPaceCycles = myCycles;
+  myDeadline = myCycles;
+}
+
+// Waits until real time catches up with simulated time.
+void EventHandler::WaitForRealTime() {
+  const std::chrono::microseconds simulated(
+      (myCycles - myPaceCycles) * 1000000 / myClockRate);
+  const auto now = std::chrono::steady_clock::now();
+  const auto real = now - myPaceStart;
+
+  // Start over if we've fallen well behind, when the host is too slow or the
+  // CPU hasn't been running, rather than rushing to catch up
+  if (real > simulated + std::chrono::milliseconds(PACE_SLIP)) {
+    myPaceStart = now;
+    myPaceCycles = myCycles;
+  } else if (simulated > real) {
+    std::this_thread::sleep_for(simulated - real);
   }
-  myEvents.insert(it, event);
 }
 
 // Removes events for the given object.
 void EventHandler::Remove(EventBase *object) {
+  Owner &owner = myOwners[object->myEventOwner];
+  myCancelled += owner.pending;
+  owner.pending = 0;
+  ++owner.generation;
+
+  // Don't let cancelled events make up most of the heap
+  if (myCancelled > myEvents.size() / 2)
+    Compact();
+}
+
+// Drops cancelled events from the heap.
+void EventHandler::Compact() {
   auto end = std::remove_if(myEvents.begin(), myEvents.end(),
-                           [object](Event &event) {
-                             return event.Owner() == object;
-                           });
+                            [this](const Event &event) {
+                              return event.generation !=
+                                     myOwners[event.owner].generation;
+                            });
   myEvents.erase(end, myEvents.end());
+  std::make_heap(myEvents.begin(), myEvents.end(), std::greater<Event>());
+  myCancelled = 0;
 }
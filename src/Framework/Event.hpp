@@ -1,12 +1,16 @@
 //
 // Maintains a queue of events requested by EventBase derived objects.
+// Time is simulated: it is counted in the clock cycles of the CPU which
+// owns the handler, so events happen at the same point in a program every
+// time it's run.  Simulated time can optionally be kept from running ahead
+// of real time.
 //
 
 #ifndef FRAMEWORK_EVENT_HPP_
 #define FRAMEWORK_EVENT_HPP_
 
+#include <chrono>
 #include <cstdint>
-#include <ctime>
 #include <vector>
 
 #include "Framework/Types.hpp"
@@ -17,24 +21,45 @@ class EventHandler;
 // events with the event handler.
 class EventBase {
 public:
-  EventBase(EventHandler &handler) : myEventHandler(handler) { }
+  EventBase(EventHandler &handler);
   virtual ~EventBase();
 
   // Called when a registered event is dispatched.
   virtual void EventCallback(int data, void *pointer) = 0;
 
 private:
+  friend class EventHandler;
+
   EventHandler &myEventHandler;
+
+  // Number the event handler knows me by.
+  const size_t myEventOwner;
 };
 
 class EventHandler {
 public:
-  // Constructor
-  EventHandler();
+  // Deadline when nothing is due.
+  static constexpr uint64_t NEVER = UINT64_MAX;
+
+  // Counts time with the cycle counter of a CPU clocked at clockRate Hz.
+  EventHandler(const uint64_t &cycles, unsigned long clockRate);
+
+  // Checks for expired events once the next one is due.
+  void Advance() {
+    if (myCycles >= myDeadline)
+      Check();
+  }
 
   // Checks for expired events.
   void Check();
 
+  // Returns the cycle count at which Check next needs to be called, which
+  // is NEVER if no events are pending.
+  uint64_t Deadline() const { return myDeadline; }
+
+  // Sets whether simulated time is kept from running ahead of real time.
+  void Pace(bool enable);
+
   // Adds an event to the event list.
   void Add(EventBase *object, int data, void *pointer, USeconds time);
 
@@ -42,43 +67,95 @@ public:
   void Remove(EventBase *object);
 
 private:
+  friend class EventBase;
+
+  // Milliseconds of simulated time between checks while pacing, and how
+  // far behind real time it may fall before pacing starts over.
+  static constexpr uint64_t PACE_INTERVAL = 1;
+  static constexpr uint64_t PACE_SLIP = 100;
+
+  // Returns a new owner number for an object.
+  size_t Register();
+
+  // Frees the owner number of an object which is going away.
+  void Release(size_t owner);
+
+  // Waits until real time catches up with simulated time.
+  void WaitForRealTime();
+
   class Event {
   public:
-    Event(EventBase *o, int d, void *p, USeconds t)
-        : total_time(t), object(o), pointer(p), data(d) { }
+    Event(EventBase *o, size_t n, uint32_t g, int d, void *p, uint64_t t,
+          uint64_t s)
+        : time(t), sequence(s), object(o), owner(n), generation(g),
+          pointer(p), data(d) { }
 
     // Dispatches the event by calling the object's callback routine.
     void Dispatch() { object->EventCallback(data, pointer); }
 
-    // Returns the owning object.
-    EventBase *Owner() { return object; }
+    // Answers true iff the event is due after the other one, events due at
+    // the same time being dispatched in the order they were added.
+    bool operator>(const Event &other) const {
+      return time > other.time ||
+             (time == other.time && sequence > other.sequence);
+    }
 
-    // Total amount of time to wait before the event.
-    NanoSeconds total_time;
+    // Cycle the event is due.
+    uint64_t time;
 
-    // Time left before the event occurs.
-    NanoSeconds delta_time;
+    // Order the event was added in.
+    uint64_t sequence;
 
-  private:
-    // The object that owns this event.
+    // The object that owns this event, its number and the generation it
+    // was in when the event was added.
     EventBase *object;
+    size_t owner;
+    uint32_t generation;
 
+  private:
     // Data to be passed to the callback method.
     void *pointer;
     int data;
   };
 
-  // Linked list of events.
+  // What is known about each object that registers events.  Removing an
+  // object's events only starts a new generation, the events of older
+  // generations being discarded as they reach the top of the heap.
+  struct Owner {
+    uint32_t generation;
+    size_t pending;  // Events in the heap from the current generation
+  };
+
+  // Drops cancelled events from the heap.
+  void Compact();
+
+  // Binary min-heap of events ordered by the time they're due.
   std::vector<Event> myEvents;
 
-  // Number of calls since last second.
-  std::uint64_t myIterations;
+  // Indexed by owner number.
+  std::vector<Owner> myOwners;
+
+  // Owner numbers of objects which have gone away, free for new ones.
+  std::vector<size_t> myFreeOwners;
+
+  // Number of cancelled events still in the heap.
+  size_t myCancelled;
+
+  // Number of events added so far.
+  uint64_t mySequence;
+
+  // Cycles the CPU has run and the number at which Check should next be
+  // called.
+  const uint64_t &myCycles;
+  uint64_t myDeadline;
 
-  // Last second Check() was called.
-  std::time_t myOldTime;
+  // CPU clock cycles per second.
+  const unsigned long myClockRate;
 
-  // Average nanoseconds per call to Check.
-  NanoSeconds myNSPerCheck;
+  // Set while pacing, along with the real and simulated time it started.
+  bool myPacing;
+  std::chrono::steady_clock::time_point myPaceStart;
+  uint64_t myPaceCycles;
 };
 
 #endif  // FRAMEWORK_EVENT_HPP_
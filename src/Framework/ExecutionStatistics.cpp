@@ -0,0 +1,102 @@
+#include <algorithm>
+#include <iomanip>
+#include <map>
+#include <sstream>
+#include <string>
+#include <utility>
+
+#include "Framework/ExecutionStatistics.hpp"
+#include "Framework/StatInfo.hpp"
+#include "Framework/Tools.hpp"
+
+namespace {
+
+// Returns the count padded into a column followed by its share of total
+std::string CountAndShare(uint64_t count, uint64_t total) {
+  std::ostringstream oss;
+  oss << std::setw(12) << count << "  " << std::fixed << std::setprecision(2)
+      << std::setw(6) << (100.0 * count / total) << "%";
+  return oss.str();
+}
+}
+
+ExecutionStatistics::ExecutionStatistics() : myOpcodeCounts(65536) { Clear(); }
+
+// Clear all of the counters
+void ExecutionStatistics::Clear() {
+  std::fill(myOpcodeCounts.begin(), myOpcodeCounts.end(), 0);
+  myExceptions = 0;
+  myInterrupts = 0;
+  myBusErrors = 0;
+  myAddressErrors = 0;
+  myRunInstructions = 0;
+  myRunTime = 0;
+}
+
+// Append the statistics to the list
+void ExecutionStatistics::Build(StatisticalInformationList &list,
+                                const NameFunction &name) const {
+  // Total the opcodes by instruction and find the hottest ones
+  uint64_t instructions = 0;
+  std::map<std::string, uint64_t> mix;
+  std::vector<std::pair<uint64_t, unsigned int>> opcodes;
+  for (unsigned int opcode = 0; opcode < myOpcodeCounts.size(); ++opcode) {
+    const uint64_t count = myOpcodeCounts[opcode];
+    if (count != 0) {
+      instructions += count;
+      mix[name(opcode)] += count;
+      opcodes.push_back(std::make_pair(count, opcode));
+    }
+  }
+
+  list.Append("Instructions Executed: " + std::to_string(instructions));
+  list.Append("Exceptions Taken: " + std::to_string(myExceptions));
+  list.Append("Interrupts Taken: " + std::to_string(myInterrupts));
+  list.Append("Bus Errors: " + std::to_string(myBusErrors));
+  list.Append("Address Errors: " + std::to_string(myAddressErrors));
+  if (myRunTime > 0) {
+    std::ostringstream oss;
+    oss << "Host MIPS: " << std::fixed << std::setprecision(2)
+        << (1000.0 * myRunInstructions / myRunTime);
+    list.Append(oss.str());
+  }
+
+  if (instructions == 0)
+    return;
+
+  // Instructions by the number of times they were executed
+  std::vector<std::pair<uint64_t, std::string>> sorted;
+  for (const auto &entry : mix)
+    sorted.push_back(std::make_pair(entry.second, entry.first));
+  std::stable_sort(sorted.begin(), sorted.end(),
+                   [](const std::pair<uint64_t, std::string> &a,
+                      const std::pair<uint64_t, std::string> &b) {
+                     return a.first > b.first;
+                   });
+
+  list.Append("Instruction Mix:");
+  for (const auto &entry : sorted) {
+    std::ostringstream oss;
+    oss << "  " << std::left << std::setw(10) << entry.second << std::right
+        << CountAndShare(entry.first, instructions);
+    list.Append(oss.str());
+  }
+
+  // The most executed opcodes
+  const size_t hot = std::min(HOT_OPCODES, opcodes.size());
+  std::partial_sort(opcodes.begin(), opcodes.begin() + hot, opcodes.end(),
+                    [](const std::pair<uint64_t, unsigned int> &a,
+                       const std::pair<uint64_t, unsigned int> &b) {
+                      return a.first > b.first ||
+                             (a.first == b.first && a.second < b.second);
+                    });
+
+  list.Append("Hot Opcodes:");
+  for (size_t t = 0; t < hot; ++t) {
+    std::ostringstream oss;
+    oss << "  " << IntToString(opcodes[t].second, 4) << " " << std::left
+        << std::setw(10) << name(opcodes[t].second) << std::right
+        << CountAndShare(opcodes[t].first, instructions);
+    list.Append(oss.str());
+  }
+}
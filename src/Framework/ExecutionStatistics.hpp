@@ -0,0 +1,74 @@
+//
+// Counts what a CPU executes so the statistics list can show the
+// instruction mix, the hottest opcodes and how fast the simulator runs.
+//
+
+#ifndef FRAMEWORK_EXECUTIONSTATISTICS_HPP_
+#define FRAMEWORK_EXECUTIONSTATISTICS_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include "Framework/Types.hpp"
+
+class StatisticalInformationList;
+
+class ExecutionStatistics {
+public:
+  // Returns the name of the instruction an opcode decodes to.
+  typedef std::function<const char *(unsigned int opcode)> NameFunction;
+
+  // Number of the most executed opcodes that are listed.
+  static const size_t HOT_OPCODES = 16;
+
+  ExecutionStatistics();
+
+  // Counts an execution of the opcode.
+  void CountInstruction(unsigned int opcode) { ++myOpcodeCounts[opcode]; }
+
+  // Counts a number of executions of the opcode.
+  void CountInstruction(unsigned int opcode, uint64_t times) {
+    myOpcodeCounts[opcode] += times;
+  }
+
+  // Counts an exception, other than bus and address errors, being taken.
+  void CountException() { ++myExceptions; }
+
+  // Counts an interrupt being taken.
+  void CountInterrupt() { ++myInterrupts; }
+
+  // Counts a bus error.
+  void CountBusError() { ++myBusErrors; }
+
+  // Counts an address error.
+  void CountAddressError() { ++myAddressErrors; }
+
+  // Counts a run of instructions which took the given host time.
+  void CountRun(size_t instructions, NanoSeconds time) {
+    myRunInstructions += instructions;
+    myRunTime += time;
+  }
+
+  // Clears all of the counters.
+  void Clear();
+
+  // Appends the statistics to the list using name for the instructions.
+  void Build(StatisticalInformationList &list, const NameFunction &name) const;
+
+private:
+  // Number of times each opcode has been executed.
+  std::vector<uint64_t> myOpcodeCounts;
+
+  uint64_t myExceptions;
+  uint64_t myInterrupts;
+  uint64_t myBusErrors;
+  uint64_t myAddressErrors;
+
+  // Instructions executed by runs and the host time they took.
+  uint64_t myRunInstructions;
+  NanoSeconds myRunTime;
+};
+
+#endif  // FRAMEWORK_EXECUTIONSTATISTICS_HPP_
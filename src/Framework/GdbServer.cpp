@@ -0,0 +1,543 @@
+#include <cstring>
+
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <unistd.h>
+
+#include "Framework/AddressSpace.hpp"
+#include "Framework/BasicCPU.hpp"
+#include "Framework/BreakpointList.hpp"
+#include "Framework/GdbServer.hpp"
+#include "Framework/RegInfo.hpp"
+#include "Framework/Tools.hpp"
+
+namespace {
+// Number of registers in GDB's m68k layout: D0-D7, A0-A7, SR and PC.  The
+// floating point ones that follow are left out, GDB treats them as
+// unavailable.
+const unsigned int NUMBER_OF_REGISTERS = 18;
+const unsigned int SP_REGISTER = 15;
+const unsigned int SR_REGISTER = 16;
+const unsigned int PC_REGISTER = 17;
+
+// Supervisor bit of the status register
+const unsigned int SR_SUPERVISOR = 0x2000;
+
+// GDB's numbers for the signals stop replies report
+const int SIGNAL_INT = 2;
+const int SIGNAL_TRAP = 5;
+const int SIGNAL_BUS = 10;
+
+const char HEX_DIGITS[] = "0123456789abcdef";
+
+int HexDigit(char c) {
+  if (c >= '0' && c <= '9')
+    return c - '0';
+  if (c >= 'a' && c <= 'f')
+    return c - 'a' + 10;
+  if (c >= 'A' && c <= 'F')
+    return c - 'A' + 10;
+  return -1;
+}
+
+// Parses the hex number at the start of text, which is left after it.
+// Returns false if there isn't one.
+bool ParseHex(const char *&text, unsigned long &value) {
+  const char *start = text;
+  value = 0;
+  for (int digit; (digit = HexDigit(*text)) >= 0; ++text)
+    value = (value << 4) | digit;
+  return text != start;
+}
+
+// Parses "address,length" followed by the separator or the end of text.
+bool ParseRange(const char *&text, Address &address, size_t &length,
+                char separator) {
+  unsigned long a, l;
+  if (!ParseHex(text, a) || *text++ != ',' || !ParseHex(text, l) ||
+      *text != separator) {
+    return false;
+  }
+  if (separator != '\0')
+    ++text;
+  address = a;
+  length = l;
+  return true;
+}
+
+void AppendHex(std::string &text, unsigned long value, int digits) {
+  for (int shift = (digits - 1) * 4; shift >= 0; shift -= 4)
+    text += HEX_DIGITS[(value >> shift) & 15];
+}
+
+std::string StopReply(int signal) {
+  std::string reply = "S";
+  AppendHex(reply, signal, 2);
+  return reply;
+}
+}  // namespace
+
+GdbServer::GdbServer(BasicCPU &cpu, BreakpointList &breakpoints)
+    : myCPU(cpu), myBreakpoints(breakpoints), myClient(-1),
+      myAcknowledge(true), myDone(false) { }
+
+GdbServer::~GdbServer() {
+  if (myClient != -1)
+    close(myClient);
+}
+
+std::string GdbServer::Serve(int port, bool anyHost) {
+  int server = socket(AF_INET, SOCK_STREAM, 0);
+  if (server < 0)
+    return "Couldn't create a socket!";
+  int on = 1;
+  setsockopt(server, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+
+  struct sockaddr_in addr;
+  std::memset(&addr, 0, sizeof(addr));
+  addr.sin_family = AF_INET;
+  addr.sin_addr.s_addr = htonl(anyHost ? INADDR_ANY : INADDR_LOOPBACK);
+  addr.sin_port = htons(port);
+  if (bind(server, (struct sockaddr *)&addr, sizeof(addr)) < 0 ||
+      listen(server, 1) < 0) {
+    close(server);
+    return "Couldn't listen on port " + std::to_string(port) + "!";
+  }
+  myClient = accept(server, nullptr, nullptr);
+  close(server);
+  if (myClient < 0)
+    return "Couldn't accept a connection!";
+
+  // Packets are small and each one waits for an answer
+  setsockopt(myClient, IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on));
+
+  myInput.clear();
+  myAcknowledge = true;
+  myDone = false;
+  std::string packet;
+  while (!myDone && ReceivePacket(packet)) {
+    std::string reply = HandlePacket(packet);
+    if (packet != "k" && !SendPacket(reply))
+      break;
+    if (packet == "QStartNoAckMode")
+      myAcknowledge = false;
+  }
+
+  // Watchpoints only exist for the debugger, breakpoints stay in the list
+  myWatchpoints.clear();
+
+  close(myClient);
+  myClient = -1;
+  return "";
+}
+
+bool GdbServer::ReceiveInput(bool wait) {
+  struct pollfd fd = {myClient, POLLIN, 0};
+  if (poll(&fd, 1, wait ? -1 : 0) <= 0)
+    return true;
+  char buffer[4096];
+  ssize_t count = recv(myClient, buffer, sizeof(buffer), 0);
+  if (count <= 0)
+    return false;
+  myInput.append(buffer, count);
+  return true;
+}
+
+bool GdbServer::ReceivePacket(std::string &packet) {
+  for (;;) {
+    // Throw away acknowledgements, resending the last packet if asked to
+    size_t start = 0;
+    while (start < myInput.size() && myInput[start] != '$') {
+      if (myInput[start] == '\x03') {
+        myInput.erase(0, start + 1);
+        packet = "\x03";
+        return true;
+      }
+      if (myInput[start] == '-' && myAcknowledge)
+        send(myClient, myLastPacket.data(), myLastPacket.size(), 0);
+      ++start;
+    }
+    myInput.erase(0, start);
+
+    // A packet is "$data#cc", where cc is the sum of the data's bytes
+    size_t end = myInput.find('#');
+    if (end != std::string::npos && end + 2 < myInput.size()) {
+      packet = myInput.substr(1, end - 1);
+      int high = HexDigit(myInput[end + 1]);
+      int low = HexDigit(myInput[end + 2]);
+      myInput.erase(0, end + 3);
+
+      unsigned int sum = 0;
+      for (char c : packet)
+        sum += static_cast<unsigned char>(c);
+      bool good = (high >= 0 && low >= 0 &&
+                   ((high << 4) | low) == static_cast<int>(sum & 0xff));
+      if (!myAcknowledge)
+        return true;
+      send(myClient, good ? "+" : "-", 1, 0);
+      if (good)
+        return true;
+      continue;
+    }
+    if (myInput.size() > 2 * PACKET_SIZE)
+      myInput.clear();
+    if (!ReceiveInput(true))
+      return false;
+  }
+}
+
+bool GdbServer::SendPacket(const std::string &packet) {
+  unsigned int sum = 0;
+  for (char c : packet)
+    sum += static_cast<unsigned char>(c);
+  myLastPacket = "$" + packet + "#";
+  AppendHex(myLastPacket, sum & 0xff, 2);
+
+  const char *data = myLastPacket.data();
+  size_t left = myLastPacket.size();
+  while (left != 0) {
+    ssize_t count = send(myClient, data, left, 0);
+    if (count <= 0)
+      return false;
+    data += count;
+    left -= count;
+  }
+  return true;
+}
+
+std::string GdbServer::HandlePacket(const std::string &packet) {
+  if (packet.empty())
+    return "";
+  const std::string args = packet.substr(1);
+
+  switch (packet[0]) {
+  case '\x03':
+    return StopReply(SIGNAL_INT);
+  case '?':
+    return StopReply(SIGNAL_TRAP);
+  case 'g':
+    return ReadRegisters();
+  case 'G':
+    return WriteRegisters(args);
+  case 'p':
+    return ReadRegister(args);
+  case 'P':
+    return WriteRegister(args);
+  case 'm':
+    return ReadMemory(args);
+  case 'M':
+    return WriteMemory(args, false);
+  case 'X':
+    return WriteMemory(args, true);
+  case 'Z':
+    return SetBreakpoint(args, true);
+  case 'z':
+    return SetBreakpoint(args, false);
+  case 'c':
+  case 's':
+    Continue(args);
+    return Resume(packet[0] == 's');
+  case 'C':
+  case 'S': {
+    // The signal to deliver is ignored, only the address matters
+    size_t semicolon = args.find(';');
+    if (semicolon != std::string::npos)
+      Continue(args.substr(semicolon + 1));
+    return Resume(packet[0] == 'S');
+  }
+  case 'H':
+  case 'T':
+    return "OK";
+  case 'D':
+    myDone = true;
+    return "OK";
+  case 'k':
+    myDone = true;
+    return "";
+  }
+
+  if (packet == "vCont?")
+    return "vCont;c;C;s;S";
+  if (packet.compare(0, 6, "vCont;") == 0) {
+    // There's one thread, so the first action is the one for it
+    char action = packet[6];
+    if (action == 'c' || action == 'C')
+      return Resume(false);
+    if (action == 's' || action == 'S')
+      return Resume(true);
+    return "E01";
+  }
+  if (packet.compare(0, 10, "qSupported") == 0) {
+    std::string reply = "PacketSize=";
+    AppendHex(reply, PACKET_SIZE, 4);
+    return reply + ";QStartNoAckMode+;vContSupported+";
+  }
+  if (packet == "QStartNoAckMode")
+    return "OK";
+  if (packet == "qAttached")
+    return "1";
+  if (packet == "qC")
+    return "QC1";
+  if (packet == "qfThreadInfo")
+    return "m1";
+  if (packet == "qsThreadInfo")
+    return "l";
+  if (packet == "qOffsets")
+    return "Text=0;Data=0;Bss=0";
+
+  // An empty reply tells the debugger the packet isn't supported
+  return "";
+}
+
+std::string GdbServer::RegisterName(unsigned int n, unsigned int sr) const {
+  static const char *const names[NUMBER_OF_REGISTERS] = {
+      "D0", "D1", "D2", "D3", "D4", "D5", "D6", "D7", "A0",
+      "A1", "A2", "A3", "A4", "A5", "A6", "A7", "SR", "PC"};
+  if (n >= NUMBER_OF_REGISTERS)
+    return "";
+  if (n == SP_REGISTER && (sr & SR_SUPERVISOR))
+    return "A7'";
+  return names[n];
+}
+
+void GdbServer::RegisterValues(std::vector<unsigned int> &values) {
+  RegisterInformationList list(myCPU);
+  std::vector<std::string> hex(NUMBER_OF_REGISTERS + 1);
+  for (size_t k = 0; k < list.NumberOfElements(); ++k) {
+    RegisterInformation info;
+    list.Element(k, info);
+    for (unsigned int n = 0; n < NUMBER_OF_REGISTERS; ++n) {
+      if (info.Name() == RegisterName(n, 0))
+        hex[n] = info.HexValue();
+    }
+    if (info.Name() == "A7'")
+      hex[NUMBER_OF_REGISTERS] = info.HexValue();
+  }
+
+  values.resize(NUMBER_OF_REGISTERS);
+  for (unsigned int n = 0; n < NUMBER_OF_REGISTERS; ++n)
+    values[n] = StringToInt(hex[n]);
+  if (values[SR_REGISTER] & SR_SUPERVISOR)
+    values[SP_REGISTER] = StringToInt(hex[NUMBER_OF_REGISTERS]);
+}
+
+std::string GdbServer::ReadRegisters() {
+  std::vector<unsigned int> values;
+  RegisterValues(values);
+  std::string reply;
+  for (unsigned int value : values)
+    AppendHex(reply, value, 8);
+  return reply;
+}
+
+std::string GdbServer::WriteRegisters(const std::string &args) {
+  if (args.size() < NUMBER_OF_REGISTERS * 8)
+    return "E01";
+
+  // Set the status register first since it decides which A7 the stack
+  // pointer is
+  const unsigned int order[NUMBER_OF_REGISTERS] = {
+      SR_REGISTER, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14,
+      SP_REGISTER, PC_REGISTER};
+  unsigned int sr = StringToInt(args.substr(SR_REGISTER * 8, 8));
+  for (unsigned int n : order)
+    myCPU.SetRegister(RegisterName(n, sr), args.substr(n * 8, 8));
+  return "OK";
+}
+
+std::string GdbServer::ReadRegister(const std::string &args) {
+  const char *text = args.c_str();
+  unsigned long n;
+  if (!ParseHex(text, n))
+    return "E01";
+
+  // Registers GDB expects but the CPU doesn't have read as unavailable
+  if (n >= NUMBER_OF_REGISTERS)
+    return "xxxxxxxx";
+  std::vector<unsigned int> values;
+  RegisterValues(values);
+  std::string reply;
+  AppendHex(reply, values[n], 8);
+  return reply;
+}
+
+std::string GdbServer::WriteRegister(const std::string &args) {
+  const char *text = args.c_str();
+  unsigned long n, value;
+  if (!ParseHex(text, n) || *text++ != '=' || !ParseHex(text, value))
+    return "E01";
+  if (n >= NUMBER_OF_REGISTERS)
+    return "OK";
+
+  std::vector<unsigned int> values;
+  RegisterValues(values);
+  myCPU.SetRegister(RegisterName(n, values[SR_REGISTER]),
+                    IntToString(value, 8));
+  return "OK";
+}
+
+std::string GdbServer::ReadMemory(const std::string &args) {
+  const char *text = args.c_str();
+  Address address;
+  size_t length;
+  if (!ParseRange(text, address, length, '\0'))
+    return "E01";
+  if (length > PACKET_SIZE / 2)
+    length = PACKET_SIZE / 2;
+
+  // Send what could be read, an error only if that's nothing
+  std::vector<Byte> block(length);
+  size_t count = myCPU.addressSpace(0).ReadBlock(address, block.data(), length);
+  if (count == 0 && length != 0)
+    return "E01";
+  std::string reply;
+  reply.reserve(2 * count);
+  for (size_t k = 0; k < count; ++k)
+    AppendHex(reply, block[k], 2);
+  return reply;
+}
+
+std::string GdbServer::WriteMemory(const std::string &args, bool binary) {
+  const char *text = args.c_str();
+  Address address;
+  size_t length;
+  if (!ParseRange(text, address, length, ':'))
+    return "E01";
+
+  std::vector<Byte> block;
+  block.reserve(length);
+  const char *end = args.c_str() + args.size();
+  if (binary) {
+    // 0x7d escapes the next byte, which is xored with 0x20
+    for (; text < end; ++text) {
+      if (*text == '}' && text + 1 < end)
+        block.push_back(*++text ^ 0x20);
+      else
+        block.push_back(*text);
+    }
+  } else {
+    for (; text + 1 < end; text += 2) {
+      int high = HexDigit(text[0]), low = HexDigit(text[1]);
+      if (high < 0 || low < 0)
+        return "E01";
+      block.push_back((high << 4) | low);
+    }
+  }
+  if (block.size() != length)
+    return "E01";
+  if (myCPU.addressSpace(0).WriteBlock(address, block.data(), length) !=
+      length) {
+    return "E01";
+  }
+  return "OK";
+}
+
+std::string GdbServer::SetBreakpoint(const std::string &args, bool insert) {
+  // Arguments are "type,address,kind" where kind is the instruction size
+  // for breakpoints and the number of bytes watched for watchpoints
+  const char *text = args.c_str();
+  unsigned long type, address, length;
+  if (!ParseHex(text, type) || *text++ != ',' || !ParseHex(text, address) ||
+      *text++ != ',' || !ParseHex(text, length)) {
+    return "E01";
+  }
+
+  switch (type) {
+  case 0: // Software breakpoint
+  case 1: // Hardware breakpoint
+    if (insert)
+      myBreakpoints.Add(address);
+    else
+      myBreakpoints.Delete(address);
+    return "OK";
+
+  case 2: // Write watchpoint
+    if (length == 0 || length > WATCH_LENGTH)
+      return "E01";
+    for (auto watch = myWatchpoints.begin(); watch != myWatchpoints.end();
+         ++watch) {
+      if (watch->address == address && watch->value.size() == length) {
+        if (!insert)
+          myWatchpoints.erase(watch);
+        return "OK";
+      }
+    }
+    if (insert) {
+      Watchpoint watch;
+      watch.address = address;
+      watch.value.resize(length);
+      myCPU.addressSpace(0).ReadBlock(address, watch.value.data(), length);
+      myWatchpoints.push_back(watch);
+    }
+    return "OK";
+  }
+
+  // Read and access watchpoints can't be seen without trapping reads
+  return "";
+}
+
+void GdbServer::Continue(const std::string &args) {
+  const char *text = args.c_str();
+  unsigned long address;
+  if (ParseHex(text, address))
+    myCPU.SetRegister("PC", IntToString(address, 8));
+}
+
+bool GdbServer::WatchpointHit(Address &address) {
+  bool hit = false;
+  std::vector<Byte> now;
+  for (Watchpoint &watch : myWatchpoints) {
+    now.resize(watch.value.size());
+    myCPU.addressSpace(0).ReadBlock(watch.address, now.data(), now.size());
+    if (now != watch.value) {
+      watch.value.swap(now);
+      if (!hit)
+        address = watch.address;
+      hit = true;
+    }
+  }
+  return hit;
+}
+
+std::string GdbServer::Resume(bool step) {
+  const BasicCPU::StopConditions none = {nullptr};
+  const BasicCPU::StopConditions stop = {&myBreakpoints};
+
+  // Watched memory is compared after every instruction, otherwise the CPU
+  // runs a chunk at a time between looks for an interrupt
+  for (;;) {
+    BasicCPU::ExecuteResult result;
+    if (step || !myWatchpoints.empty()) {
+      result = myCPU.Execute(1, step ? none : stop);
+    } else {
+      result = myCPU.Execute(CHUNK, stop);
+    }
+
+    Address address;
+    if (!myWatchpoints.empty() && WatchpointHit(address)) {
+      std::string reply = "T";
+      AppendHex(reply, SIGNAL_TRAP, 2);
+      reply += "watch:";
+      AppendHex(reply, address, 8);
+      return reply + ";";
+    }
+    if (result.reason == BasicCPU::STOP_HALTED)
+      return StopReply(SIGNAL_BUS);
+    if (step || result.reason != BasicCPU::STOP_LIMIT)
+      return StopReply(SIGNAL_TRAP);
+
+    // Stop if the debugger interrupts us or goes away
+    if (!ReceiveInput(false)) {
+      myDone = true;
+      return StopReply(SIGNAL_INT);
+    }
+    size_t interrupt = myInput.find('\x03');
+    if (interrupt != std::string::npos) {
+      myInput.erase(interrupt, 1);
+      return StopReply(SIGNAL_INT);
+    }
+  }
+}
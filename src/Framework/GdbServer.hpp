@@ -0,0 +1,112 @@
+//
+// Serves the GDB remote serial protocol over TCP, so a debugger controls
+// the simulated CPU directly instead of talking to a stub running on it.
+// Registers are reached through the CPU's register list, memory through its
+// first address space and breakpoints through the list the user interface
+// uses, so nothing the debugger does costs the program any cycles.
+//
+
+#ifndef FRAMEWORK_GDBSERVER_HPP_
+#define FRAMEWORK_GDBSERVER_HPP_
+
+#include <string>
+#include <vector>
+
+#include "Framework/Types.hpp"
+
+class BasicCPU;
+class BreakpointList;
+
+class GdbServer {
+public:
+  GdbServer(BasicCPU &cpu, BreakpointList &breakpoints);
+  ~GdbServer();
+
+  GdbServer(const GdbServer &) = delete;
+  GdbServer &operator=(const GdbServer &) = delete;
+
+  // Waits for a debugger to connect to the TCP port and serves it until it
+  // detaches, kills the program or goes away.  Only debuggers on this host
+  // may connect unless anyHost is true, since whoever connects can do as
+  // they please with the simulator.  Returns an error message or the empty
+  // string.
+  std::string Serve(int port, bool anyHost = false);
+
+private:
+  // Largest packet the debugger may send, in bytes.
+  static const size_t PACKET_SIZE = 0x4000;
+
+  // Instructions run between checks for an interrupt from the debugger.
+  static const size_t CHUNK = 1024;
+
+  // Longest range a watchpoint may cover, in bytes.
+  static const size_t WATCH_LENGTH = 256;
+
+  // A range of memory watched for writes and what it last held.
+  struct Watchpoint {
+    Address address;
+    std::vector<Byte> value;
+  };
+
+  // Gets the next packet from the debugger, acknowledging it.  An interrupt
+  // arriving while the CPU is stopped is returned as "\x03".  Returns false
+  // once the connection is closed.
+  bool ReceivePacket(std::string &packet);
+
+  // Sends the packet, returns false if the connection is closed.
+  bool SendPacket(const std::string &packet);
+
+  // Reads whatever has arrived from the debugger into myInput, waiting for
+  // it iff wait is true.  Returns false once the connection is closed.
+  bool ReceiveInput(bool wait);
+
+  // Returns the reply to the packet, setting myDone if it ends the session.
+  std::string HandlePacket(const std::string &packet);
+
+  // Handlers for the packets which take arguments.
+  std::string ReadRegisters();
+  std::string WriteRegisters(const std::string &args);
+  std::string ReadRegister(const std::string &args);
+  std::string WriteRegister(const std::string &args);
+  std::string ReadMemory(const std::string &args);
+  std::string WriteMemory(const std::string &args, bool binary);
+  std::string SetBreakpoint(const std::string &args, bool insert);
+
+  // Moves the PC to the address resumption packets may give.
+  void Continue(const std::string &args);
+
+  // Returns the register list name of the GDB register number, n, which is
+  // empty if there isn't one.  The stack pointer depends on the mode.
+  std::string RegisterName(unsigned int n, unsigned int sr) const;
+
+  // Gets the value of each of the CPU's registers.
+  void RegisterValues(std::vector<unsigned int> &values);
+
+  // Runs the CPU, one instruction if step is true, and returns the stop
+  // reply to send once it stops.
+  std::string Resume(bool step);
+
+  // Returns true iff a watched range has changed, giving its address.
+  bool WatchpointHit(Address &address);
+
+  BasicCPU &myCPU;
+  BreakpointList &myBreakpoints;
+  std::vector<Watchpoint> myWatchpoints;
+
+  // Connection to the debugger, or -1
+  int myClient;
+
+  // Bytes received but not handled yet
+  std::string myInput;
+
+  // Last packet sent, in case the debugger asks for it again
+  std::string myLastPacket;
+
+  // Cleared once the debugger turns off acknowledgements
+  bool myAcknowledge;
+
+  // Set when the session is over
+  bool myDone;
+};
+
+#endif  // FRAMEWORK_GDBSERVER_HPP_
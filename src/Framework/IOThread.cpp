@@ -0,0 +1,269 @@
+#include <cerrno>
+#include <chrono>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+
+#include "Framework/IOThread.hpp"
+
+IOThread::IOThread()
+    : myWakeRead(-1), myWakeWrite(-1), mySleeping(false), myStopping(false) {
+}
+
+IOThread::~IOThread() {
+  if (myThread.joinable()) {
+    myStopping.store(true);
+    Byte c = 0;
+    if (write(myWakeWrite, &c, 1) < 0) {
+      // The pipe is full, so the thread is going to wake up anyway
+    }
+    myThread.join();
+  }
+  if (myWakeRead != -1) {
+    close(myWakeRead);
+    close(myWakeWrite);
+  }
+}
+
+int IOThread::AddChannel(int read, int write) {
+  // The thread must never block, it has other descriptors to look after
+  if (read != -1)
+    fcntl(read, F_SETFL, fcntl(read, F_GETFL) | O_NONBLOCK);
+  if (write != -1)
+    fcntl(write, F_SETFL, fcntl(write, F_GETFL) | O_NONBLOCK);
+  myChannels.push_back(std::unique_ptr<Channel>(new Channel(read, write)));
+  return myChannels.size() - 1;
+}
+
+bool IOThread::Start() {
+  int ids[2];
+  if (pipe(ids))
+    return false;
+  myWakeRead = ids[0];
+  myWakeWrite = ids[1];
+  for (int id : ids) {
+    if (fcntl(id, F_SETFL, O_NONBLOCK) == -1 || fcntl(id, F_SETFD, 1) == -1)
+      return false;
+  }
+  myThread = std::thread(&IOThread::Run, this);
+  return true;
+}
+
+bool IOThread::Receive(int channel, Byte &c) {
+  RingBuffer<Byte, BUFFER_SIZE> &input = myChannels[channel]->input;
+  bool full = input.Size() == input.Capacity();
+  if (!input.Pop(c))
+    return false;
+
+  // The thread stops reading a channel while there's no room for more
+  if (full)
+    Wake();
+  return true;
+}
+
+bool IOThread::Finished(int channel) const {
+  const Channel &c = *myChannels[channel];
+  return c.closed.load() && c.input.Empty();
+}
+
+bool IOThread::Transmit(int channel, Byte c) {
+  Channel &ch = *myChannels[channel];
+  while (!ch.output.Push(c)) {
+    if (ch.failed.load())
+      return false;
+    ch.released.store(ch.pushed);
+    Wake();
+    std::this_thread::sleep_for(std::chrono::microseconds(100));
+  }
+  ++ch.pushed;
+
+  // Buffered channels only wake the thread for whole lines or big pieces
+  if (!ch.buffered || c == '\n' || ch.output.Size() >= BUFFER_SIZE / 2) {
+    ch.released.store(ch.pushed);
+    Wake();
+  }
+  return !ch.failed.load();
+}
+
+void IOThread::Wake() {
+  // Pairs with the fence in Run so either the thread sees the new bytes
+  // before it sleeps or it's seen to be sleeping here
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (mySleeping.exchange(false)) {
+    Byte c = 0;
+    if (write(myWakeWrite, &c, 1) < 0) {
+      // A full pipe wakes the thread just as well
+    }
+  }
+}
+
+bool IOThread::OutputWaiting() const {
+  for (const auto &channel : myChannels) {
+    if (channel->failed.load())
+      continue;
+    if (channel->buffered ? channel->released.load() > channel->drained
+                          : !channel->output.Empty()) {
+      return true;
+    }
+  }
+  return false;
+}
+
+size_t IOThread::Releasable(Channel &channel, bool stopping, int &timeout) {
+  size_t waiting = channel.output.Size();
+  if (!channel.buffered || stopping || waiting == 0)
+    return waiting;
+  size_t released = channel.released.load();
+  if (released > channel.drained)
+    return released - channel.drained;
+
+  // Nothing's been released, so hold the unfinished line back for a while
+  std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+  if (!channel.holding) {
+    channel.holding = true;
+    channel.held = now;
+  }
+  int left = HOLD_TIMEOUT -
+             std::chrono::duration_cast<std::chrono::milliseconds>(
+                 now - channel.held).count();
+  if (left <= 0)
+    return waiting;
+  if (timeout < 0 || left < timeout)
+    timeout = left;
+  return 0;
+}
+
+// Read as much as the channel's input ring has room for
+void IOThread::Fill(Channel &channel) {
+  for (;;) {
+    size_t length;
+    Byte *span = channel.input.WriteSpan(length);
+    if (length == 0)
+      return;
+    ssize_t count = read(channel.read, span, length);
+    if (count > 0) {
+      channel.input.Commit(count);
+      if (static_cast<size_t>(count) < length)
+        return;
+    } else if (count < 0 && (errno == EAGAIN || errno == EINTR)) {
+      return;
+    } else {
+      channel.closed.store(true);
+      return;
+    }
+  }
+}
+
+// Write up to limit bytes of the channel's output ring, as many as the
+// descriptor takes
+void IOThread::Drain(Channel &channel, size_t limit, bool &wrote) {
+  while (limit != 0) {
+    size_t length;
+    const Byte *span = channel.output.ReadSpan(length);
+    if (length == 0)
+      return;
+    if (length > limit)
+      length = limit;
+    ssize_t count = write(channel.write, span, length);
+    if (count > 0) {
+      channel.output.Consume(count);
+      channel.drained += count;
+      channel.holding = false;
+      limit -= count;
+      wrote = true;
+      if (static_cast<size_t>(count) < length)
+        return;
+    } else if (count < 0 && (errno == EAGAIN || errno == EINTR)) {
+      return;
+    } else {
+      channel.failed.store(true);
+      return;
+    }
+  }
+}
+
+void IOThread::Run() {
+  std::vector<struct pollfd> fds;
+  std::vector<Channel *> owners;
+  std::vector<size_t> limits;
+  bool linger = false;
+
+  for (;;) {
+    bool stopping = myStopping.load();
+
+    fds.clear();
+    owners.clear();
+    limits.clear();
+    fds.push_back({myWakeRead, POLLIN, 0});
+    owners.push_back(nullptr);
+    limits.push_back(0);
+    bool output = false;
+    int timeout = -1;
+    for (const auto &channel : myChannels) {
+      if (!stopping && !channel->closed.load() &&
+          channel->input.Size() < channel->input.Capacity()) {
+        fds.push_back({channel->read, POLLIN, 0});
+        owners.push_back(channel.get());
+        limits.push_back(0);
+      }
+      if (!channel->failed.load()) {
+        size_t limit = Releasable(*channel, stopping, timeout);
+        if (limit != 0) {
+          fds.push_back({channel->write, POLLOUT, 0});
+          owners.push_back(channel.get());
+          limits.push_back(limit);
+          output = true;
+        }
+      }
+    }
+    if (stopping && !output)
+      return;
+
+    if (stopping) {
+      timeout = FLUSH_TIMEOUT;
+    } else if (linger) {
+      if (timeout < 0 || timeout > LINGER_TIMEOUT)
+        timeout = LINGER_TIMEOUT;
+    } else {
+      // Look at the output again once a Transmit is sure to wake us
+      mySleeping.store(true);
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+      if (!output && (OutputWaiting() || myStopping.load())) {
+        mySleeping.store(false);
+        continue;
+      }
+    }
+
+    int ready = poll(fds.data(), fds.size(), timeout);
+    mySleeping.store(false);
+    if (ready < 0 && errno != EINTR) {
+      // Nothing is going to move the bytes any more, so say so rather than
+      // leave Transmit waiting for room and Receive for input forever
+      for (const auto &channel : myChannels) {
+        channel->closed.store(true);
+        channel->failed.store(true);
+      }
+      return;
+    }
+    if (ready == 0 && stopping)
+      return;
+    linger = false;
+    if (ready <= 0)
+      continue;
+
+    if (fds[0].revents & POLLIN) {
+      Byte junk[64];
+      while (read(myWakeRead, junk, sizeof(junk)) > 0) {
+      }
+    }
+    for (size_t i = 1; i < fds.size(); ++i) {
+      if (fds[i].revents == 0)
+        continue;
+      if (fds[i].events & POLLIN)
+        Fill(*owners[i]);
+      else
+        Drain(*owners[i], limits[i], linger);
+    }
+  }
+}
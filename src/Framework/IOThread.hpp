@@ -0,0 +1,129 @@
+//
+// Moves bytes between a device's host file descriptors and ring buffers on
+// a background thread.  The simulation thread only touches the rings, so
+// it never makes a system call for a character; the I/O thread sleeps in
+// poll() until a descriptor is ready or it's woken because there's output.
+//
+
+#ifndef FRAMEWORK_IOTHREAD_HPP_
+#define FRAMEWORK_IOTHREAD_HPP_
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "Framework/RingBuffer.hpp"
+#include "Framework/Types.hpp"
+
+class IOThread {
+public:
+  // Number of bytes buffered in each direction of a channel.
+  static const size_t BUFFER_SIZE = 4096;
+
+  IOThread();
+
+  // Writes out what's left to transmit, giving up after FLUSH_TIMEOUT if
+  // nobody is reading it, and then stops the thread.
+  ~IOThread();
+
+  IOThread(const IOThread &) = delete;
+  IOThread &operator=(const IOThread &) = delete;
+
+  // Adds a channel receiving from one descriptor and transmitting to the
+  // other, either of which may be -1, and returns its number.  Channels
+  // must all be added before the thread is started.
+  int AddChannel(int read, int write);
+
+  // Makes the channel hold its output back until a line is complete, half
+  // its buffer is used or HOLD_TIMEOUT has passed, so bulk output is written
+  // in a few large pieces.  Must be called before the thread is started.
+  void Buffer(int channel) { myChannels[channel]->buffered = true; }
+
+  // Starts the thread, returns false if it can't be.
+  bool Start();
+
+  // Gets the oldest byte received by the channel, returns false if there
+  // isn't one.
+  bool Receive(int channel, Byte &c);
+
+  // Returns true iff the channel won't receive any more bytes, either
+  // because its descriptor reached end of file or it doesn't have one.
+  bool Finished(int channel) const;
+
+  // Queues the byte to be transmitted by the channel, waiting for room if
+  // its buffer is full.  Returns false if the channel can't transmit.
+  bool Transmit(int channel, Byte c);
+
+private:
+  // Milliseconds the thread keeps watching for more output after writing
+  // some, so a stream of characters doesn't need a wake up for each.
+  static const int LINGER_TIMEOUT = 1;
+
+  // Milliseconds to wait for output to drain when stopping.
+  static const int FLUSH_TIMEOUT = 1000;
+
+  // Milliseconds a buffered channel may hold back an unfinished line.
+  static const int HOLD_TIMEOUT = 10;
+
+  struct Channel {
+    Channel(int r, int w)
+        : read(r), write(w), closed(r == -1), failed(w == -1),
+          buffered(false), pushed(0), released(0), drained(0),
+          holding(false) { }
+    int read;
+    int write;
+    RingBuffer<Byte, BUFFER_SIZE> input;
+    RingBuffer<Byte, BUFFER_SIZE> output;
+
+    // Set by the thread when the descriptor can't be used any more
+    std::atomic<bool> closed;
+    std::atomic<bool> failed;
+
+    // Output of buffered channels is only written up to released, apart
+    // from lines held back too long.  The simulation thread counts the
+    // bytes pushed and releases them, the thread counts those drained and
+    // when it started holding some back.
+    bool buffered;
+    size_t pushed;
+    std::atomic<size_t> released;
+    size_t drained;
+    bool holding;
+    std::chrono::steady_clock::time_point held;
+  };
+
+  // Body of the I/O thread.
+  void Run();
+
+  // Returns the number of output bytes the channel may write now, and
+  // shortens the timeout to when the ones it's holding back are due.
+  size_t Releasable(Channel &channel, bool stopping, int &timeout);
+
+  // Moves bytes between the channel's descriptors and rings, writing no
+  // more than limit.
+  void Fill(Channel &channel);
+  void Drain(Channel &channel, size_t limit, bool &wrote);
+
+  // Returns true iff some channel has output it may write.
+  bool OutputWaiting() const;
+
+  // Wakes the thread if it's sleeping with nothing to do.
+  void Wake();
+
+  std::vector<std::unique_ptr<Channel>> myChannels;
+
+  // Pipe the simulation thread writes to so poll() returns
+  int myWakeRead;
+  int myWakeWrite;
+
+  // Set while the thread is, or is about to be, waiting without a timeout
+  std::atomic<bool> mySleeping;
+
+  // Set when the thread should flush its output and finish
+  std::atomic<bool> myStopping;
+
+  std::thread myThread;
+};
+
+#endif  // FRAMEWORK_IOTHREAD_HPP_
@@ -1,4 +1,3 @@
-#include <sys/time.h>
 #include <sys/types.h>
 #include <unistd.h>
 
@@ -7,16 +6,20 @@
 #include <iostream>
 #include <sstream>
 #include <string>
+#include <vector>
 
 #include "Framework/Interface.hpp"
 #include "Framework/BasicCPU.hpp"
 #include "Framework/AddressSpace.hpp"
 #include "Framework/BasicDeviceRegistry.hpp"
 #include "Framework/BasicLoader.hpp"
+#include "Framework/BinaryProtocol.hpp"
 #include "Framework/BreakpointList.hpp"
+#include "Framework/GdbServer.hpp"
 #include "Framework/StatInfo.hpp"
 #include "Framework/RegInfo.hpp"
 #include "Framework/Tools.hpp"
+#include "Framework/TraceRecorder.hpp"
 
 // Simulator's main loop: gets a command from the UI, parses and executes it.
 void Interface::CommandLoop() {
@@ -27,7 +30,7 @@ void Interface::CommandLoop() {
     do {
       std::getline(myInputStream, command);
     } while (command == "NOP");
-    if (command == "Exit") {
+    if (command == "Exit" || !myInputStream) {
       break;
     }
     // For some version of iostream we have to have a little padding :-(
@@ -48,6 +51,15 @@ void Interface::ExecuteCommand(const std::string &command) {
   myOutputStream << "ERROR: Unknown command!" << std::endl;
 }
 
+// Checks the command against the queries
+bool Interface::IsQuery(const std::string &command) const {
+  for (const char **query = ourQueries; *query != nullptr; ++query) {
+    if (command.find(*query) == 0)
+      return true;
+  }
+  return false;
+}
+
 // The user interface command table
 Interface::CommandTable Interface::ourCommandTable[] = {
     {"AddBreakpoint", &Interface::AddBreakpoint},
@@ -73,17 +85,26 @@ Interface::CommandTable Interface::ourCommandTable[] = {
     {"ListStatistics", &Interface::ListStatistics},
     {"LoadProgram", &Interface::LoadProgram},
     {"ProgramCounterValue", &Interface::ProgramCounterValue},
+    {"RecordTrace", &Interface::RecordTrace},
     {"Reset", &Interface::Reset},
     {"Run", &Interface::Run},
+    {"ServeBinary", &Interface::ServeBinary},
+    {"ServeGdb", &Interface::ServeGdb},
     {"SetMemory", &Interface::SetMemory},
     {"SetRegister", &Interface::SetRegister},
     {"Step", &Interface::Step}};
 
+// The commands answered while running
+const char *Interface::ourQueries[] = {
+    "ListBreakpoints", "ListMemory", "ListRegisters", "ListRegisterValue",
+    "ListStatistics", "ProgramCounterValue", nullptr};
+
 Interface::Interface(BasicCPU &cpu, BasicDeviceRegistry &registry,
                      BasicLoader &loader)
     : myNumberOfCommands(sizeof(ourCommandTable) / sizeof(CommandTable)),
       myCPU(cpu), myDeviceRegistry(registry), myLoader(loader),
-      myInputStream(std::cin), myOutputStream(std::cout),
+      myCommandReader(0), myCommandStream(&myCommandReader),
+      myInputStream(myCommandStream), myOutputStream(std::cout),
       myBreakpointList(*new BreakpointList) {}
 
 // Prints the value of the program counter.
@@ -323,11 +344,22 @@ void Interface::FillMemoryBlock(const std::string &args) {
     return;
   }
 
-  for (size_t i = 0; i < length; ++i) {
-    Address addr = (address + i) * myCPU.Granularity();
-    for (size_t t = 0; t < myCPU.Granularity(); ++t) {
-      myCPU.addressSpace(addressSpace)
-          .Poke(addr + t, StringToInt(std::string(value, t * 2, 2)));
+  // Repeat the value through a buffer and write it a buffer at a time
+  const size_t granularity = myCPU.Granularity();
+  std::vector<Byte> block((length < FILL_WORDS ? length : FILL_WORDS) *
+                          granularity);
+  for (size_t k = 0; k < block.size(); ++k) {
+    block[k] = StringToInt(std::string(value, (k % granularity) * 2, 2));
+  }
+  for (size_t i = 0; i < length; i += FILL_WORDS) {
+    size_t bytes = ((length - i < FILL_WORDS) ? length - i : FILL_WORDS) *
+                   granularity;
+
+    // Carry on past any locations that aren't mapped
+    for (size_t done = 0; done < bytes; ++done) {
+      done += myCPU.addressSpace(addressSpace)
+                  .WriteBlock((address + i) * granularity + done,
+                              &block[done], bytes - done);
     }
   }
 }
@@ -418,20 +450,33 @@ void Interface::ListMemory(const std::string &args) {
     myOutputStream << "ERROR: Invalid address space!" << std::endl;
     return;
   }
+
+  // Read the whole block at once, noting the locations that aren't mapped
+  const size_t granularity = myCPU.Granularity();
+  std::vector<Byte> block(size_t(length) * granularity);
+  std::vector<bool> mapped(block.size(), true);
+  for (size_t done = 0; done < block.size(); ++done) {
+    done += myCPU.addressSpace(addressSpace)
+                .ReadBlock(address * granularity + done, &block[done],
+                           block.size() - done);
+    if (done < block.size())
+      mapped[done] = false;
+  }
+
   size_t numberOfWords = 0;
   for (size_t t = 0; t < length; ++t) {
-    for (size_t s = 0; s < myCPU.Granularity(); ++s) {
-      Byte value;
-      if (myCPU.addressSpace(addressSpace)
-              .Peek((address + t) * myCPU.Granularity() + s, value)) {
-        line += IntToString(value, 2);
+    for (size_t s = 0; s < granularity; ++s) {
+      if (mapped[t * granularity + s]) {
+        static const char digits[] = "0123456789abcdef";
+        line += digits[block[t * granularity + s] >> 4];
+        line += digits[block[t * granularity + s] & 15];
       } else {
         line += "xx";
       }
     }
     ++numberOfWords;
     if (numberOfWords >= wordsPerLine) {
-      myOutputStream << line << std::endl;
+      myOutputStream << line << '\n';
       numberOfWords = 0;
       line = "";
     } else {
@@ -488,48 +533,91 @@ void Interface::Run(const std::string &args) {
   }
 
   std::getline(in, name, '}');
+  RunUntilStopped(nullptr);
+}
 
-  // Run until something stops us.
-  for (size_t steps = 0;; ++steps) {
-    std::string traceRecord;
-    const std::string &message = myCPU.ExecuteInstruction(traceRecord, false);
-    if (!message.empty()) {
-      if (message[0] == '.') {
-        myOutputStream << message.substr(1) << std::flush;
-      } else {
-        myOutputStream << "Execution stopped: " << message << std::endl;
+// Perform the RecordTrace command
+void Interface::RecordTrace(const std::string &args) {
+  std::istringstream in(args);
+  std::string filename;
+  char c;
+
+  in >> c;
+  in.unsetf(std::ios::skipws);
+  if (c != '{') {
+    myOutputStream << "ERROR: Invalid arguments!" << std::endl;
+    return;
+  }
+  std::getline(in, filename, '}');
+
+  TraceRecorder recorder(myCPU);
+  std::string message = recorder.Open(filename);
+  if (message.empty()) {
+    RunUntilStopped(&recorder);
+    message = recorder.Close();
+  }
+  if (!message.empty()) {
+    myOutputStream << "ERROR: " << message << std::endl;
+  }
+}
+
+// Runs until something stops us, recording a trace if given a recorder.
+// Input arriving stops the CPU at once: queries are answered, ending with
+// "Running!", and the run carries on, anything else ends it.
+void Interface::RunUntilStopped(TraceRecorder *recorder) {
+  const BasicCPU::StopConditions stop = {&myBreakpointList,
+                                         &myCommandReader.Arrived()};
+  for (;;) {
+    if (myCommandReader.Waiting()) {
+      std::string command;
+      std::getline(myInputStream, command);
+      if (!myInputStream || !IsQuery(command)) {
+        myOutputStream << "Execution Interrupted!" << std::endl;
         break;
       }
-    } else if (myBreakpointList.Check(myCPU.ValueOfProgramCounter())) {
-      myOutputStream << "Execution stopped at a breakpoint!" << std::endl;
+      ExecuteCommand(command + " ");
+      myOutputStream << "Running!" << std::endl;
+      continue;
+    }
+    BasicCPU::ExecuteResult result = recorder != nullptr
+                                         ? recorder->Record(1024, stop)
+                                         : myCPU.Execute(1024, stop);
+    if (result.reason != BasicCPU::STOP_LIMIT &&
+        result.reason != BasicCPU::STOP_INTERRUPTED) {
+      myOutputStream << BasicCPU::StopMessage(result.reason) << std::endl;
       break;
     }
-    // Poll for input every 1024 steps
-    else if ((steps & 0x03FF) == 0) {
-      fd_set rfds;
-      struct timeval tv;
-      int retval;
-
-      // We're going to poll STDIN to see if any input is available
-      FD_ZERO(&rfds);
-      FD_SET(0, &rfds);
+  }
+}
 
-      // Don't wait at all
-      tv.tv_sec = 0;
-      tv.tv_usec = 0;
+// Switches to the binary protocol until a message ends its session.
+void Interface::ServeBinary(const std::string &) {
+  BinaryProtocol protocol(myCPU, myBreakpointList, myLoader, myInputStream,
+                          myOutputStream);
+  const std::string &message = protocol.Serve();
+  if (!message.empty()) {
+    myOutputStream << "ERROR: " << message << std::endl;
+  }
+}
 
-      retval = select(1, &rfds, NULL, NULL, &tv);
+// Lets a debugger connected to the TCP port control the CPU until it's done.
+// The debugger must be on this host unless the port is followed by "any".
+void Interface::ServeGdb(const std::string &args) {
+  std::istringstream in(args);
+  int port;
+  std::string hosts;
 
-      // Stop running if data is ready to be read
-      if (retval == 1) {
-        // Read the "StopRunning" Command
-        std::string dummy;
-        std::getline(myInputStream, dummy);
+  in >> std::dec >> port;
 
-        myOutputStream << "Execution Interrupted!" << std::endl;
-        break;
-      }
-    }
+  // Make sure we were able to read the arguments
+  if (!in || ((in >> hosts) && hosts != "any")) {
+    myOutputStream << "ERROR: Invalid arguments!" << std::endl;
+    return;
+  }
+  GdbServer server(myCPU, myBreakpointList);
+  const std::string &message = server.Serve(port, hosts == "any");
+  if (!message.empty()) {
+    myOutputStream << "ERROR: " << message << std::endl;
   }
 }
 
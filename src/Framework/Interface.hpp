@@ -8,10 +8,13 @@
 
 #include <iostream>
 
+#include "Framework/CommandReader.hpp"
+
 class BasicCPU;
 class BasicDeviceRegistry;
 class BasicLoader;
 class BreakpointList;
+class TraceRecorder;
 
 class Interface {
 public:
@@ -30,6 +33,12 @@ private:
   // Table of commands.
   static CommandTable ourCommandTable[];
 
+  // Commands that only look at the simulator, answered while it runs.
+  static const char *ourQueries[];
+
+  // Most words FillMemoryBlock writes at a time.
+  static const size_t FILL_WORDS = 4096;
+
   // Indicates the number of commands in the command table.
   const unsigned int myNumberOfCommands;
 
@@ -42,6 +51,10 @@ private:
   // Reference to the loader.
   BasicLoader &myLoader;
 
+  // Reads the UI's commands as they arrive, while the CPU runs.
+  CommandReader myCommandReader;
+  std::istream myCommandStream;
+
   // Reference to the input stream used to get information from the UI.
   std::istream &myInputStream;
 
@@ -54,6 +67,13 @@ private:
   // Execute the given command.
   void ExecuteCommand(const std::string &command);
 
+  // Returns true iff the command is one of the queries.
+  bool IsQuery(const std::string &command) const;
+
+  // Runs the CPU until something stops it, recording a trace if given a
+  // recorder.
+  void RunUntilStopped(TraceRecorder *recorder);
+
   // Member funtion for each of the commands.
   void AddBreakpoint(const std::string &args);
   void AttachDevice(const std::string &args);
@@ -77,8 +97,11 @@ private:
   void ListStatistics(const std::string &args);
   void LoadProgram(const std::string &args);
   void ProgramCounterValue(const std::string &args);
+  void RecordTrace(const std::string &args);
   void Reset(const std::string &args);
   void Run(const std::string &args);
+  void ServeBinary(const std::string &args);
+  void ServeGdb(const std::string &args);
   void SetRegister(const std::string &args);
   void SetMemory(const std::string &args);
   void Step(const std::string &args);
@@ -0,0 +1,86 @@
+//
+// Keeps track of the interrupts devices have requested from a CPU with
+// seven levels of interrupts.  A bitmap records which levels have requests
+// waiting and the highest of them is kept up to date as requests come and
+// go, so the CPU can see whether there's anything to service with a single
+// compare.  Requests at the same level are serviced in the order they were
+// made.
+//
+
+#ifndef FRAMEWORK_INTERRUPTCONTROLLER_HPP_
+#define FRAMEWORK_INTERRUPTCONTROLLER_HPP_
+
+#include <cstddef>
+#include <vector>
+
+class BasicDevice;
+
+class InterruptController {
+public:
+  // Number of interrupt levels, level 0 meaning no interrupt.
+  static const int LEVELS = 7;
+
+  InterruptController() : myPending(0), myHighest(0) { }
+
+  // Records a request from the device at the given level, from 1 to LEVELS.
+  void Request(BasicDevice *device, int level) {
+    Requests &requests = myRequests[level - 1];
+    requests.devices.push_back(device);
+    myPending |= 1u << level;
+    if (level > myHighest)
+      myHighest = level;
+  }
+
+  // Returns the highest level with a request waiting, or 0 if none are.
+  int Highest() const { return myHighest; }
+
+  // Returns the device which made the oldest request at the level.
+  BasicDevice *Device(int level) const {
+    const Requests &requests = myRequests[level - 1];
+    return requests.devices[requests.next];
+  }
+
+  // Removes the oldest request at the level once it's been serviced.
+  void Acknowledge(int level) {
+    Requests &requests = myRequests[level - 1];
+    if (++requests.next < requests.devices.size()) {
+      // A level which never runs dry would grow without bound, so drop the
+      // serviced requests once they're at least half of them.  Moving the
+      // rest down costs no more than the requests dropped.
+      if (requests.next >= COMPACT_REQUESTS &&
+          2 * requests.next >= requests.devices.size()) {
+        requests.devices.erase(requests.devices.begin(),
+                               requests.devices.begin() + requests.next);
+        requests.next = 0;
+      }
+      return;
+    }
+
+    // Keep the storage so requests don't allocate once things settle down
+    requests.devices.clear();
+    requests.next = 0;
+    myPending &= ~(1u << level);
+    myHighest = 0;
+    for (unsigned int pending = myPending >> 1; pending != 0; pending >>= 1)
+      ++myHighest;
+  }
+
+private:
+  // Serviced requests kept at a level before they're dropped.
+  static const size_t COMPACT_REQUESTS = 64;
+
+  // Requests waiting at one level, oldest first from next.
+  struct Requests {
+    Requests() : next(0) { }
+    std::vector<BasicDevice *> devices;
+    size_t next;
+  };
+
+  Requests myRequests[LEVELS];
+
+  // Bit n is set iff level n has requests waiting.
+  unsigned int myPending;
+  int myHighest;
+};
+
+#endif  // FRAMEWORK_INTERRUPTCONTROLLER_HPP_
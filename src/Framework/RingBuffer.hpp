@@ -0,0 +1,106 @@
+//
+// A fixed size queue passing items from exactly one producer thread to
+// exactly one consumer thread without locks.  Each side only writes its own
+// index, so neither ever waits for the other; a full or empty buffer is
+// simply reported back to the caller.
+//
+
+#ifndef FRAMEWORK_RINGBUFFER_HPP_
+#define FRAMEWORK_RINGBUFFER_HPP_
+
+#include <atomic>
+#include <cstddef>
+
+template <class T, size_t CAPACITY>
+class RingBuffer {
+  static_assert(CAPACITY != 0 && (CAPACITY & (CAPACITY - 1)) == 0,
+                "RingBuffer capacity must be a power of two");
+
+public:
+  RingBuffer() : myHead(0), myTail(0) { }
+
+  RingBuffer(const RingBuffer &) = delete;
+  RingBuffer &operator=(const RingBuffer &) = delete;
+
+  // Returns the number of items the buffer can hold.
+  static size_t Capacity() { return CAPACITY; }
+
+  // Returns the number of items waiting.  Either side may call this, the
+  // answer is only exact for the side calling.
+  size_t Size() const {
+    return myTail.load(std::memory_order_acquire) -
+           myHead.load(std::memory_order_acquire);
+  }
+
+  bool Empty() const { return Size() == 0; }
+
+  // Producer: appends the item, returns false if the buffer is full.
+  bool Push(const T &item) {
+    size_t tail = myTail.load(std::memory_order_relaxed);
+    if (tail - myHead.load(std::memory_order_acquire) == CAPACITY)
+      return false;
+    myItems[tail & MASK] = item;
+    myTail.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Producer: returns the free slots which directly follow the last item,
+  // which may be fewer than are free in all when the buffer wraps.
+  T *WriteSpan(size_t &length) {
+    size_t tail = myTail.load(std::memory_order_relaxed);
+    size_t free = CAPACITY - (tail - myHead.load(std::memory_order_acquire));
+    size_t index = tail & MASK;
+    length = (free < CAPACITY - index) ? free : CAPACITY - index;
+    return myItems + index;
+  }
+
+  // Producer: makes the first length slots of the write span items.
+  void Commit(size_t length) {
+    myTail.store(myTail.load(std::memory_order_relaxed) + length,
+                 std::memory_order_release);
+  }
+
+  // Consumer: removes the oldest item, returns false if there isn't one.
+  bool Pop(T &item) {
+    size_t head = myHead.load(std::memory_order_relaxed);
+    if (myTail.load(std::memory_order_acquire) == head)
+      return false;
+    item = myItems[head & MASK];
+    myHead.store(head + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Consumer: returns the oldest items which lie next to each other, which
+  // may be fewer than are waiting in all when the buffer wraps.
+  const T *ReadSpan(size_t &length) const {
+    size_t head = myHead.load(std::memory_order_relaxed);
+    size_t used = myTail.load(std::memory_order_acquire) - head;
+    size_t index = head & MASK;
+    length = (used < CAPACITY - index) ? used : CAPACITY - index;
+    return myItems + index;
+  }
+
+  // Consumer: removes the first length items of the read span.
+  void Consume(size_t length) {
+    myHead.store(myHead.load(std::memory_order_relaxed) + length,
+                 std::memory_order_release);
+  }
+
+private:
+  static const size_t MASK = CAPACITY - 1;
+
+  // Size of the padding which keeps the indices on separate cache lines.
+  static const size_t CACHE_LINE = 64;
+
+  // Count of items ever removed, only written by the consumer
+  std::atomic<size_t> myHead;
+  char myHeadPadding[CACHE_LINE - sizeof(std::atomic<size_t>)];
+
+  // Count of items ever added, only written by the producer
+  std::atomic<size_t> myTail;
+  char myTailPadding[CACHE_LINE - sizeof(std::atomic<size_t>)];
+
+  T myItems[CAPACITY];
+};
+
+#endif  // FRAMEWORK_RINGBUFFER_HPP_
@@ -1,8 +1,12 @@
+#include "Framework/AddressSpace.hpp"
 #include "Framework/BasicCPU.hpp"
 #include "Framework/StatInfo.hpp"
 
 StatisticalInformationList::StatisticalInformationList(BasicCPU &cpu) {
   cpu.BuildStatisticalInformationList(*this);
+  for (size_t t = 0; t < cpu.NumberOfAddressSpaces(); ++t) {
+    cpu.addressSpace(t).BuildStatisticalInformationList(*this);
+  }
 }
 
 StatisticalInformationList::~StatisticalInformationList() {
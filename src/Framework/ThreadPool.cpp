@@ -0,0 +1,46 @@
+#include <algorithm>
+#include <utility>
+
+#include "Framework/ThreadPool.hpp"
+
+ThreadPool::ThreadPool(size_t threads) : myStopping(false) {
+  if (threads == 0)
+    threads = std::max(1u, std::thread::hardware_concurrency());
+  for (size_t t = 0; t < threads; ++t)
+    myThreads.push_back(std::thread(&ThreadPool::Worker, this));
+}
+
+ThreadPool::~ThreadPool() {
+  {
+    std::lock_guard<std::mutex> lock(myMutex);
+    myStopping = true;
+  }
+  myCondition.notify_all();
+  for (auto &thread : myThreads)
+    thread.join();
+}
+
+// Queue the task for the next free thread
+void ThreadPool::Submit(std::function<void()> task) {
+  {
+    std::lock_guard<std::mutex> lock(myMutex);
+    myTasks.push_back(std::move(task));
+  }
+  myCondition.notify_one();
+}
+
+// Run queued tasks, leaving once the pool is stopping and the queue is empty
+void ThreadPool::Worker() {
+  for (;;) {
+    std::function<void()> task;
+    {
+      std::unique_lock<std::mutex> lock(myMutex);
+      myCondition.wait(lock, [this] { return myStopping || !myTasks.empty(); });
+      if (myTasks.empty())
+        return;
+      task = std::move(myTasks.front());
+      myTasks.pop_front();
+    }
+    task();
+  }
+}
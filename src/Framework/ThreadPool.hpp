@@ -0,0 +1,53 @@
+//
+// A fixed set of worker threads which run queued tasks in the order they
+// were submitted.
+//
+
+#ifndef FRAMEWORK_THREADPOOL_HPP_
+#define FRAMEWORK_THREADPOOL_HPP_
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class ThreadPool {
+public:
+  // Starts the number of threads, or one per host core if it is zero.
+  explicit ThreadPool(size_t threads);
+
+  // Runs the tasks still queued and then stops the threads.
+  ~ThreadPool();
+
+  ThreadPool(const ThreadPool &) = delete;
+  ThreadPool &operator=(const ThreadPool &) = delete;
+
+  // Returns the number of worker threads.
+  size_t NumberOfThreads() const { return myThreads.size(); }
+
+  // Queues a task to be run by one of the threads.
+  void Submit(std::function<void()> task);
+
+private:
+  // Runs tasks until the pool is destroyed.
+  void Worker();
+
+  // Guards the task queue and the stopping flag.
+  std::mutex myMutex;
+
+  // Signalled when a task is queued or the pool is stopping.
+  std::condition_variable myCondition;
+
+  // Tasks waiting for a thread.
+  std::deque<std::function<void()>> myTasks;
+
+  // Set when the threads should finish.
+  bool myStopping;
+
+  std::vector<std::thread> myThreads;
+};
+
+#endif  // FRAMEWORK_THREADPOOL_HPP_
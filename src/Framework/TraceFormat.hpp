@@ -0,0 +1,172 @@
+//
+// The compact binary execution trace written by TraceRecorder and read back
+// by TraceReader.
+//
+// A trace starts with MAGIC, the CPU's name and the names of the registers
+// it records.  Blocks of records follow, each after a header holding the
+// number of its first instruction (counting from 0), its number of
+// instructions, the length of its records in bytes and the registers before
+// its first instruction, so a reader can skip to any block and replay it
+// without the ones before.  The block header's integers are little endian
+// and of fixed width; all other integers are varints of seven bits a byte,
+// low bits first, with signed ones zigzag encoded.  Strings are a length
+// followed by that many bytes.
+//
+// Each instruction's record is a flags byte followed by the parts it says
+// are there, in this order:
+//
+//   CODE       Bytes at the instruction's address, as a string.  Given the
+//              first time the address is reached in a block.
+//   REGISTERS  Mask of the registers the instruction changed, a byte for each
+//              eight registers with the lowest numbered in the low bit of the
+//              first, then the signed change to each, lowest numbered first.
+//   WRITES     Number of writes, then for each the signed distance of its
+//              address from the block's previous write and the bytes written,
+//              as a string.
+//   NOTE       What the instruction's trace record holds after its
+//              disassembly, as a string.
+//
+// DISASSEMBLED is set if the trace record holds the instruction's
+// disassembly.  The instruction's address is the PC before it.
+//
+
+#ifndef FRAMEWORK_TRACEFORMAT_HPP_
+#define FRAMEWORK_TRACEFORMAT_HPP_
+
+#include <cstdint>
+#include <string>
+
+namespace TraceFormat {
+// Identifies a trace file.
+const char MAGIC[] = "BSVCTRACE1";
+const size_t MAGIC_LENGTH = sizeof(MAGIC) - 1;
+
+// Record flags.
+enum {
+  CODE = 1,
+  REGISTERS = 2,
+  WRITES = 4,
+  NOTE = 8,
+  DISASSEMBLED = 16,
+};
+
+// Bytes in a block header before its registers.
+const size_t BLOCK_HEADER = 16;
+
+// Appends a little endian integer of the given number of bytes.
+inline void PutFixed(std::string &s, uint64_t value, size_t bytes) {
+  for (size_t t = 0; t < bytes; ++t)
+    s += static_cast<char>((value >> (8 * t)) & 0xff);
+}
+
+// Gets a little endian integer of the given number of bytes.
+inline uint64_t GetFixed(const char *p, size_t bytes) {
+  uint64_t value = 0;
+  for (size_t t = 0; t < bytes; ++t)
+    value |= uint64_t(static_cast<unsigned char>(p[t])) << (8 * t);
+  return value;
+}
+
+// Most bytes a varint takes.
+const size_t MAXIMUM_VARINT = 10;
+
+// Most registers a trace may record, one for each bit of a record's mask.
+const size_t MAXIMUM_REGISTERS = 64;
+
+// Puts an unsigned varint at p, returning where it ends.
+inline char *PutVarint(char *p, uint64_t value) {
+  while (value >= 0x80) {
+    *p++ = static_cast<char>((value & 0x7f) | 0x80);
+    value >>= 7;
+  }
+  *p++ = static_cast<char>(value);
+  return p;
+}
+
+// Puts a signed varint at p, returning where it ends.
+inline char *PutSigned(char *p, int64_t value) {
+  return PutVarint(
+      p, (static_cast<uint64_t>(value) << 1) ^ (value < 0 ? ~0ull : 0));
+}
+
+// Appends an unsigned varint.
+inline void PutVarint(std::string &s, uint64_t value) {
+  char buffer[MAXIMUM_VARINT];
+  s.append(buffer, PutVarint(buffer, value) - buffer);
+}
+
+// Appends a string.
+inline void PutString(std::string &s, const void *data, size_t length) {
+  PutVarint(s, length);
+  s.append(static_cast<const char *>(data), length);
+}
+
+// Reads the integers and strings of a record or header, noting if it tries
+// to read past the end.
+class Decoder {
+public:
+  Decoder(const char *data, size_t length)
+      : myStart(data), myData(data), myEnd(data + length), myFailed(false) {}
+
+  // Gets an unsigned varint.
+  uint64_t Varint() {
+    uint64_t value = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+      if (myData == myEnd) {
+        myFailed = true;
+        return 0;
+      }
+      unsigned char c = *myData++;
+      value |= uint64_t(c & 0x7f) << shift;
+      if ((c & 0x80) == 0)
+        return value;
+    }
+    myFailed = true;
+    return 0;
+  }
+
+  // Gets a signed varint.
+  int64_t Signed() {
+    uint64_t value = Varint();
+    return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+  }
+
+  // Gets a byte.
+  unsigned int Octet() {
+    if (myData == myEnd) {
+      myFailed = true;
+      return 0;
+    }
+    return static_cast<unsigned char>(*myData++);
+  }
+
+  // Gets a string, returning where its bytes are and setting length.
+  const char *String(size_t &length) {
+    length = Varint();
+    if (length > size_t(myEnd - myData)) {
+      myFailed = true;
+      length = 0;
+    }
+    const char *data = myData;
+    myData += length;
+    return data;
+  }
+
+  // Returns the number of bytes read.
+  size_t Used() const { return myData - myStart; }
+
+  // Returns true iff everything has been read.
+  bool Finished() const { return myData == myEnd; }
+
+  // Returns true iff a read went past the end.
+  bool Failed() const { return myFailed; }
+
+private:
+  const char *myStart;
+  const char *myData;
+  const char *myEnd;
+  bool myFailed;
+};
+}  // namespace TraceFormat
+
+#endif  // FRAMEWORK_TRACEFORMAT_HPP_
@@ -0,0 +1,197 @@
+#include <algorithm>
+#include <sstream>
+
+#include "Framework/AddressSpace.hpp"
+#include "Framework/BasicCPU.hpp"
+#include "Framework/BasicDeviceRegistry.hpp"
+#include "Framework/Tools.hpp"
+#include "Framework/TraceFormat.hpp"
+#include "Framework/TraceReader.hpp"
+
+using namespace TraceFormat;
+
+namespace {
+// Most bytes a trace's header, before its first block, may take
+const size_t MAXIMUM_HEADER = 4096;
+
+const char CORRUPT[] = "The trace file is corrupt";
+}  // namespace
+
+TraceReader::TraceReader(BasicCPU &cpu, BasicDeviceRegistry &registry)
+    : myCPU(cpu), myRegistry(registry), myPCIndex(0), myBlock(0),
+      myPosition(0), myNext(0), myLastWrite(0) {}
+
+std::string TraceReader::Open(const std::string &filename) {
+  myFile.open(filename, std::ios::binary);
+  if (!myFile)
+    return "Couldn't open the trace file " + filename;
+
+  // Read the names of the CPU and its registers
+  std::string header(MAXIMUM_HEADER, '\0');
+  myFile.read(&header[0], header.size());
+  header.resize(myFile.gcount());
+  myFile.clear();
+  if (header.compare(0, MAGIC_LENGTH, MAGIC) != 0)
+    return filename + " isn't a trace file";
+
+  Decoder in(header.data() + MAGIC_LENGTH, header.size() - MAGIC_LENGTH);
+  size_t length;
+  const char *name = in.String(length);
+  if (in.Failed())
+    return CORRUPT;
+  if (std::string(name, length) != myCPU.Name())
+    return "The trace was recorded on a " + std::string(name, length);
+  size_t count = in.Varint();
+  if (count > MAXIMUM_REGISTERS)
+    return CORRUPT;
+  for (size_t t = 0; t < count && !in.Failed(); ++t) {
+    name = in.String(length);
+    myNames.push_back(std::string(name, length));
+  }
+  myPCIndex =
+      std::find(myNames.begin(), myNames.end(), "PC") - myNames.begin();
+  if (in.Failed() || myPCIndex == myNames.size())
+    return CORRUPT;
+  myRegisters.resize(count);
+
+  // Find the blocks from their headers
+  const size_t blockHeader = BLOCK_HEADER + 4 * count;
+  std::streamoff offset = MAGIC_LENGTH + in.Used();
+  uint64_t next = 0;
+  char fixed[BLOCK_HEADER];
+  for (;;) {
+    myFile.seekg(offset);
+    if (!myFile.read(fixed, sizeof(fixed)))
+      break;
+    Block block = {GetFixed(fixed, 8), GetFixed(fixed + 8, 4), offset,
+                   static_cast<size_t>(GetFixed(fixed + 12, 4))};
+    if (block.first != next || block.count == 0)
+      return CORRUPT;
+    myBlocks.push_back(block);
+    next += block.count;
+    offset += blockHeader + block.length;
+  }
+  if (myFile.gcount() != 0)
+    return "The trace file is truncated";
+  myFile.clear();
+  myBlock = myBlocks.size();
+
+  // Give the first address space memory to hold the code
+  AddressSpace &space = myCPU.addressSpace(0);
+  std::ostringstream args;
+  args << "BaseAddress = 0 Size = " << std::hex
+       << uint64_t(space.MaximumAddress()) + 1;
+  BasicDevice *device;
+  if (!myRegistry.Create("SparseRAM", args.str(), myCPU, device))
+    return "Couldn't create memory for the trace";
+  space.AttachDevice(device);
+  return "";
+}
+
+uint64_t TraceReader::Instructions() const {
+  if (myBlocks.empty())
+    return 0;
+  return myBlocks.back().first + myBlocks.back().count;
+}
+
+std::string TraceReader::Render(uint64_t instruction, std::string &record) {
+  if (instruction >= Instructions())
+    return "The trace only has " + std::to_string(Instructions()) +
+           " instructions";
+
+  // Replay the block holding the instruction up to it, from its start unless
+  // it's already been replayed that far
+  auto after = std::upper_bound(
+      myBlocks.begin(), myBlocks.end(), instruction,
+      [](uint64_t n, const Block &block) { return n < block.first; });
+  size_t index = after - myBlocks.begin() - 1;
+  if (index != myBlock || instruction < myNext) {
+    std::string message = LoadBlock(index);
+    if (!message.empty())
+      return message;
+  }
+  while (myNext < instruction) {
+    if (!Replay(nullptr))
+      return CORRUPT;
+  }
+  return Replay(&record) ? "" : CORRUPT;
+}
+
+std::string TraceReader::LoadBlock(size_t index) {
+  const Block &block = myBlocks[index];
+  std::string header(BLOCK_HEADER + 4 * myRegisters.size(), '\0');
+  myRecords.resize(block.length);
+  myFile.seekg(block.offset);
+  if (!myFile.read(&header[0], header.size()) ||
+      !myFile.read(&myRecords[0], myRecords.size())) {
+    myFile.clear();
+    myBlock = myBlocks.size();
+    return "The trace file is truncated";
+  }
+
+  for (size_t t = 0; t < myRegisters.size(); ++t)
+    myRegisters[t] = GetFixed(&header[BLOCK_HEADER + 4 * t], 4);
+  myBlock = index;
+  myPosition = 0;
+  myNext = block.first;
+  myLastWrite = 0;
+  return "";
+}
+
+bool TraceReader::Replay(std::string *record) {
+  Decoder in(myRecords.data() + myPosition, myRecords.size() - myPosition);
+  AddressSpace &space = myCPU.addressSpace(0);
+  const unsigned int flags = in.Octet();
+  const Address pc = myRegisters[myPCIndex];
+  const char *data;
+  size_t length;
+
+  if (flags & CODE) {
+    data = in.String(length);
+    space.WriteBlock(pc, reinterpret_cast<const Byte *>(data), length);
+  }
+
+  // Disassemble the instruction before it changes anything
+  std::string mnemonic;
+  if (record != nullptr && (flags & DISASSEMBLED)) {
+    for (size_t t = 0; t < myNames.size(); ++t)
+      myCPU.SetRegister(myNames[t], IntToString(myRegisters[t], 8));
+    myCPU.DisassembleInstruction(pc, mnemonic);
+  }
+
+  if (flags & REGISTERS) {
+    uint64_t changed = 0;
+    for (size_t t = 0; t < myRegisters.size(); t += 8)
+      changed |= uint64_t(in.Octet()) << t;
+    for (size_t t = 0; t < myRegisters.size(); ++t) {
+      if ((changed >> t) & 1)
+        myRegisters[t] += static_cast<Register>(in.Signed());
+    }
+  }
+
+  if (flags & WRITES) {
+    uint64_t count = in.Varint();
+    for (uint64_t t = 0; t < count && !in.Failed(); ++t) {
+      myLastWrite += static_cast<Address>(in.Signed());
+      data = in.String(length);
+      space.WriteBlock(myLastWrite, reinterpret_cast<const Byte *>(data),
+                       length);
+    }
+  }
+
+  std::string note;
+  if (flags & NOTE) {
+    data = in.String(length);
+    note.assign(data, length);
+  }
+
+  if (in.Failed())
+    return false;
+  myPosition += in.Used();
+  ++myNext;
+  if (record != nullptr) {
+    *record = "{InstructionAddress " + IntToString(pc, 8) + "} " + mnemonic +
+              note;
+  }
+  return true;
+}
@@ -0,0 +1,80 @@
+//
+// Reads an execution trace written by TraceRecorder, turning any of its
+// instructions back into the trace record Step would have given for it.
+// Only the block holding the instruction is replayed, so seeking anywhere
+// in a long trace is quick.
+//
+
+#ifndef FRAMEWORK_TRACEREADER_HPP_
+#define FRAMEWORK_TRACEREADER_HPP_
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "Framework/Types.hpp"
+
+class BasicCPU;
+class BasicDeviceRegistry;
+
+class TraceReader {
+public:
+  // Renders trace records with the CPU, which must be a fresh one of the
+  // kind the trace was recorded on.  Its first address space is given over
+  // to memory holding the code the trace has reached.
+  TraceReader(BasicCPU &cpu, BasicDeviceRegistry &registry);
+
+  TraceReader(const TraceReader &) = delete;
+  TraceReader &operator=(const TraceReader &) = delete;
+
+  // Opens the trace file and finds its blocks.  Returns an error message or
+  // the empty string.
+  std::string Open(const std::string &filename);
+
+  // Returns the number of instructions in the trace.
+  uint64_t Instructions() const;
+
+  // Sets record to the trace record of the numbered instruction, counting
+  // from 0.  Returns an error message or the empty string.
+  std::string Render(uint64_t instruction, std::string &record);
+
+private:
+  // Where a block lies in the file.
+  struct Block {
+    uint64_t first;
+    uint64_t count;
+    std::streamoff offset;
+    size_t length;
+  };
+
+  // Reads in the indexed block.  Returns an error message or the empty
+  // string.
+  std::string LoadBlock(size_t index);
+
+  // Replays the next instruction of the loaded block, rendering its trace
+  // record unless given nullptr.  Returns false if the record is corrupt.
+  bool Replay(std::string *record);
+
+  BasicCPU &myCPU;
+  BasicDeviceRegistry &myRegistry;
+  std::ifstream myFile;
+
+  // Names of the registers recorded, and which one is the PC
+  std::vector<std::string> myNames;
+  size_t myPCIndex;
+
+  std::vector<Block> myBlocks;
+
+  // The loaded block, its records, where the next one starts, the number of
+  // the next instruction and the registers before it, and the address of
+  // the last write replayed
+  size_t myBlock;
+  std::string myRecords;
+  size_t myPosition;
+  uint64_t myNext;
+  std::vector<Register> myRegisters;
+  Address myLastWrite;
+};
+
+#endif  // FRAMEWORK_TRACEREADER_HPP_
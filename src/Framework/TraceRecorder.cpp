@@ -0,0 +1,196 @@
+#include <cstring>
+
+#include "Framework/BreakpointList.hpp"
+#include "Framework/RegInfo.hpp"
+#include "Framework/TraceFormat.hpp"
+#include "Framework/TraceRecorder.hpp"
+
+using namespace TraceFormat;
+
+TraceRecorder::TraceRecorder(BasicCPU &cpu)
+    : myCPU(cpu), mySpace(cpu.addressSpace(0)), myInstructions(0),
+      myBlockFirst(0), myBlockLength(0), myLastWrite(0),
+      myCodeSeen(CODE_SLOTS, ~uint64_t(0)) {}
+
+TraceRecorder::~TraceRecorder() {
+  if (myFile.is_open())
+    Close();
+}
+
+std::string TraceRecorder::Open(const std::string &filename) {
+  myFile.open(filename, std::ios::binary | std::ios::trunc);
+  if (!myFile)
+    return "Couldn't open the trace file " + filename;
+
+  size_t count;
+  const Register *registers = myCPU.RegisterFile(count);
+  if (count > MAXIMUM_REGISTERS)
+    return "The CPU has too many registers to trace";
+  RegisterInformationList list(myCPU);
+  std::string header(MAGIC, MAGIC_LENGTH);
+  PutString(header, myCPU.Name().data(), myCPU.Name().size());
+  PutVarint(header, count);
+  for (size_t t = 0; t < count; ++t) {
+    RegisterInformation info;
+    list.Element(t, info);
+    PutString(header, info.Name().data(), info.Name().size());
+  }
+  myFile.write(header.data(), header.size());
+
+  myInstructions = 0;
+  myRegisters.assign(registers, registers + count);
+  FinishBlock();
+  return "";
+}
+
+BasicCPU::ExecuteResult TraceRecorder::Record(
+    size_t maxInstructions, const BasicCPU::StopConditions &stop) {
+  BasicCPU::ExecuteResult result = {BasicCPU::STOP_LIMIT, 0};
+
+  // There's no need to look for breakpoints if there aren't any
+  const BreakpointList *breakpoints = stop.breakpoints;
+  if (breakpoints != nullptr && breakpoints->Empty())
+    breakpoints = nullptr;
+  const std::atomic<bool> *interrupt = stop.interrupt;
+
+  std::string note;
+  mySpace.LogWrites(&myWrites);
+  while (result.instructions < maxInstructions) {
+    if (myInstructions - myBlockFirst == BLOCK_INSTRUCTIONS)
+      FinishBlock();
+
+    // Keep the code the first time the block reaches its address, before
+    // the instruction can change it
+    const Address pc = myCPU.ValueOfProgramCounter();
+    Byte code[CODE_BYTES];
+    size_t codeLength = 0;
+    uint64_t &seen = myCodeSeen[(pc >> 1) % CODE_SLOTS];
+    if (seen != pc) {
+      seen = pc;
+      codeLength = mySpace.ReadBlock(pc, code, CODE_BYTES);
+    }
+
+    bool disassembled;
+    myWrites.clear();
+    BasicCPU::StopReason reason = myCPU.RecordInstruction(disassembled, note);
+    AppendRecord(code, codeLength, disassembled, note);
+    ++result.instructions;
+
+    if (reason != BasicCPU::STOP_LIMIT) {
+      result.reason = reason;
+      break;
+    }
+    if (breakpoints != nullptr &&
+        breakpoints->Check(myCPU.ValueOfProgramCounter())) {
+      result.reason = BasicCPU::STOP_BREAKPOINT;
+      break;
+    }
+    if (interrupt != nullptr && interrupt->load(std::memory_order_relaxed)) {
+      result.reason = BasicCPU::STOP_INTERRUPTED;
+      break;
+    }
+  }
+  mySpace.LogWrites(nullptr);
+  return result;
+}
+
+std::string TraceRecorder::Close() {
+  FinishBlock();
+  bool written = myFile.good();
+  myFile.close();
+  return written ? "" : "Couldn't write the trace file";
+}
+
+void TraceRecorder::AppendRecord(const Byte *code, size_t codeLength,
+                                 bool disassembled, const std::string &note) {
+  // The changes to the registers are signed 32-bit values, five bytes at most
+  const size_t recordAt = myBlockLength;
+  char *p = Reserve(1 + MAXIMUM_VARINT + CODE_BYTES + MAXIMUM_REGISTERS / 8 +
+                    5 * MAXIMUM_REGISTERS) + 1;
+  unsigned int flags = disassembled ? DISASSEMBLED : 0;
+
+  if (codeLength != 0) {
+    flags |= CODE;
+    p = PutVarint(p, codeLength);
+    std::memcpy(p, code, codeLength);
+    p += codeLength;
+  }
+
+  // Put the changes to the registers after room for their mask, setting its
+  // bits as they're found
+  size_t count;
+  const Register *registers = myCPU.RegisterFile(count);
+  Register *last = myRegisters.data();
+  const size_t maskBytes = (count + 7) / 8;
+  char *mask = p;
+  char *q = p + maskBytes;
+  uint64_t changed = 0;
+  for (size_t t = 0; t < count; ++t) {
+    if (registers[t] != last[t]) {
+      changed |= uint64_t(1) << t;
+      q = PutSigned(q, static_cast<int32_t>(registers[t] - last[t]));
+      last[t] = registers[t];
+    }
+  }
+  if (changed != 0) {
+    flags |= REGISTERS;
+    for (size_t t = 0; t < maskBytes; ++t)
+      mask[t] = static_cast<char>(changed >> (8 * t));
+    p = q;
+  }
+
+  // Writes and notes are rare, so make room for each one as it comes
+  if (!myWrites.empty()) {
+    flags |= WRITES;
+    p = PutVarint(p, myWrites.size());
+    for (const AddressSpace::Write &write : myWrites) {
+      myBlockLength = p - myBlock.data();
+      p = Reserve(2 * MAXIMUM_VARINT + write.width);
+      p = PutSigned(p, int64_t(write.address) - int64_t(myLastWrite));
+      p = PutVarint(p, write.width);
+      if (write.memory != nullptr)
+        std::memcpy(p, write.memory, write.width);
+      else
+        WriteBigEndian(reinterpret_cast<Byte *>(p), write.value, write.width);
+      p += write.width;
+      myLastWrite = write.address;
+    }
+  }
+  if (!note.empty()) {
+    flags |= NOTE;
+    myBlockLength = p - myBlock.data();
+    p = Reserve(MAXIMUM_VARINT + note.size());
+    p = PutVarint(p, note.size());
+    std::memcpy(p, note.data(), note.size());
+    p += note.size();
+  }
+
+  myBlockLength = p - myBlock.data();
+  myBlock[recordAt] = static_cast<char>(flags);
+  ++myInstructions;
+}
+
+char *TraceRecorder::Reserve(size_t bytes) {
+  if (myBlock.size() - myBlockLength < bytes)
+    myBlock.resize(2 * (myBlockLength + bytes));
+  return myBlock.data() + myBlockLength;
+}
+
+void TraceRecorder::FinishBlock() {
+  if (myInstructions != myBlockFirst) {
+    std::string header;
+    PutFixed(header, myBlockFirst, 8);
+    PutFixed(header, myInstructions - myBlockFirst, 4);
+    PutFixed(header, myBlockLength, 4);
+    for (Register value : myBlockRegisters)
+      PutFixed(header, value, 4);
+    myFile.write(header.data(), header.size());
+    myFile.write(myBlock.data(), myBlockLength);
+  }
+
+  myBlockLength = 0;
+  myBlockFirst = myInstructions;
+  myBlockRegisters = myRegisters;
+  myLastWrite = 0;
+  myCodeSeen.assign(CODE_SLOTS, ~uint64_t(0));
+}
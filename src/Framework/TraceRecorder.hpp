@@ -0,0 +1,95 @@
+//
+// Runs the CPU while recording a compact binary execution trace to a file,
+// keeping what each instruction changed instead of formatting its trace
+// record, so long runs can be traced at close to full speed.  TraceReader
+// turns the file back into trace records; TraceFormat.hpp describes it.
+//
+
+#ifndef FRAMEWORK_TRACERECORDER_HPP_
+#define FRAMEWORK_TRACERECORDER_HPP_
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "Framework/AddressSpace.hpp"
+#include "Framework/BasicCPU.hpp"
+
+class TraceRecorder {
+public:
+  explicit TraceRecorder(BasicCPU &cpu);
+
+  // Finishes the trace if it hasn't been closed.
+  ~TraceRecorder();
+
+  TraceRecorder(const TraceRecorder &) = delete;
+  TraceRecorder &operator=(const TraceRecorder &) = delete;
+
+  // Starts a trace in the file.  Returns an error message or the empty
+  // string.
+  std::string Open(const std::string &filename);
+
+  // Executes and records up to maxInstructions instructions, stopping early
+  // like BasicCPU::Execute does.  Idle loops are executed one instruction at
+  // a time, so every instruction executed is in the trace.
+  BasicCPU::ExecuteResult Record(size_t maxInstructions,
+                                 const BasicCPU::StopConditions &stop);
+
+  // Writes out the rest of the trace.  Returns an error message or the empty
+  // string.
+  std::string Close();
+
+  // Returns the number of instructions recorded so far.
+  uint64_t Instructions() const { return myInstructions; }
+
+private:
+  // Most instructions in a block.
+  static const size_t BLOCK_INSTRUCTIONS = 65536;
+
+  // Bytes kept of the code at each instruction's address, enough for the
+  // longest instruction.
+  static const size_t CODE_BYTES = 24;
+
+  // Slots in the direct mapped cache of addresses whose code is in the
+  // current block.
+  static const size_t CODE_SLOTS = 4096;
+
+  // Appends the record of the instruction just executed to the block, given
+  // the code at its address if the block needs it.
+  void AppendRecord(const Byte *code, size_t codeLength, bool disassembled,
+                    const std::string &note);
+
+  // Makes room for bytes more at the end of the block's records, returning
+  // where they go.
+  char *Reserve(size_t bytes);
+
+  // Writes the current block out, if it holds anything, and starts the next.
+  void FinishBlock();
+
+  BasicCPU &myCPU;
+  AddressSpace &mySpace;
+  std::ofstream myFile;
+
+  // Number of the next instruction and of the current block's first one
+  uint64_t myInstructions;
+  uint64_t myBlockFirst;
+
+  // Registers after the last instruction and before the block's first one
+  std::vector<Register> myRegisters;
+  std::vector<Register> myBlockRegisters;
+
+  // The current block's records, in the first myBlockLength bytes, and the
+  // address of its last write
+  std::vector<char> myBlock;
+  size_t myBlockLength;
+  Address myLastWrite;
+
+  // Addresses whose code is in the current block, by slot, or ~0
+  std::vector<uint64_t> myCodeSeen;
+
+  // Writes the instruction being recorded made
+  std::vector<AddressSpace::Write> myWrites;
+};
+
+#endif  // FRAMEWORK_TRACERECORDER_HPP_
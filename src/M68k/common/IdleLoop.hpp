@@ -0,0 +1,300 @@
+//
+// Idle loop detection for the 68000 family.  Firmware waiting for a device
+// often sits in a short loop that tests a status register and branches back
+// until a bit changes.  When the loop only loads and tests, every read is of
+// memory or of a device register that doesn't change when it's read, and an
+// iteration leaves the registers as the one before did, every iteration is
+// the same until a device event happens.  Whole iterations can then be
+// skipped up to the next event.  Reads of registers such as a receive
+// buffer, which take data from the device, rule the loop out.
+//
+// The simulators share the detector.  Each makes it a friend so it can
+// decode instructions, read registers and memory, and count the cycles
+// skipped the way the simulator itself does.
+//
+
+#ifndef M68K_COMMON_IDLELOOP_HPP_
+#define M68K_COMMON_IDLELOOP_HPP_
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "Framework/AddressSpace.hpp"
+#include "Framework/Event.hpp"
+#include "Framework/Types.hpp"
+
+template <class Cpu>
+class IdleLoop {
+public:
+  // Most bytes and instructions in a loop which can be skipped when idle.
+  static const Address MAX_BYTES = 32;
+  static const size_t MAX_LENGTH = 8;
+
+  IdleLoop()
+      : myBranch(0), myTarget(0), myGeneration(0), myLength(0), myCycles(0),
+        myExecuted(0), myDeadline(EventHandler::NEVER) {}
+
+  // Forgets the last loop, so the next branch back is looked at afresh.
+  void Forget() { myBranch = myTarget = 0; }
+
+  // Checks whether the branch just taken back to the PC closes an idle loop.
+  // If it does and the previous iteration ran straight through and left the
+  // registers as the one before, skip as many iterations as fit before the
+  // next event and within the budget of instructions.  Returns the number of
+  // instructions skipped.
+  size_t Skip(Cpu &cpu, Address branch, size_t executed, size_t budget);
+
+private:
+  typedef typename Cpu::ExecutionPointer ExecutionPointer;
+
+  // Answers true iff running the instruction again changes nothing but the
+  // condition codes.
+  static bool IsPollingInstruction(unsigned int opcode,
+                                   ExecutionPointer execute);
+
+  // Answers true iff the memory the polling instruction at the address
+  // reads, if any, doesn't change when it's read.
+  static bool ReadsQuietly(Cpu &cpu, unsigned int opcode,
+                           ExecutionPointer execute, Address address);
+
+  // Works out what the loop does with the registers as they are now.  Sets
+  // myLength to the instructions in the loop, or 0 if it isn't idle.
+  void Analyse(Cpu &cpu);
+
+  // Returns the address of the instruction after the one at the address,
+  // which the disassembler knows the length of.  The simulators differ in
+  // the type of address their disassemblers take.
+  template <class ProgramCounter>
+  static Address NextInstruction(
+      Cpu &cpu, void (Cpu::*disassemble)(int, ProgramCounter &, std::string &),
+      unsigned int opcode, Address address);
+
+  Address myBranch;             // Address of the branch back
+  Address myTarget;             // Address the loop starts at
+  unsigned long myGeneration;   // Code generation when it was checked
+  size_t myLength;              // Instructions in the loop, 0 if not idle
+  unsigned int myOpcodes[MAX_LENGTH];
+  uint64_t myCycles;            // Clock cycles when the branch was taken
+  size_t myExecuted;            // Instructions Execute had run by then
+  uint64_t myDeadline;          // When the next event was due by then
+  std::vector<Register> myRegisters;  // Registers by then
+};
+
+namespace idle_loop {
+
+// Answers true iff the effective address changes a register when used
+inline bool ChangesRegister(int mode_register) {
+  const int mode = (mode_register >> 3) & 7;
+  return mode == 3 || mode == 4;
+}
+
+// Answers true iff the effective address uses an index register
+inline bool UsesIndex(int mode_register) {
+  const int mode = (mode_register >> 3) & 7;
+  return mode == 6 || mode_register == 0x3b;
+}
+}
+
+// The polling instructions change no memory and no register but a data
+// register or the condition codes
+template <class Cpu>
+bool IdleLoop<Cpu>::IsPollingInstruction(unsigned int opcode,
+                                         ExecutionPointer execute) {
+  if (idle_loop::ChangesRegister(opcode & 0x3f))
+    return false;
+
+  if (execute == &Cpu::ExecuteTST || execute == &Cpu::ExecuteCMP ||
+      execute == &Cpu::ExecuteCMPA || execute == &Cpu::ExecuteCMPI)
+    return true;
+  if (execute == &Cpu::ExecuteBit)
+    return (opcode & 0x00c0) == 0;  // BTST
+
+  // Loading a data register, or masking one, is fine as long as the loop
+  // settles into giving the same values each time round
+  if (execute == &Cpu::ExecuteMOVE)
+    return ((opcode >> 6) & 7) == 0 && !idle_loop::UsesIndex(opcode & 0x3f);
+  if (execute == &Cpu::ExecuteAND)
+    return !(opcode & 0x0100) && !idle_loop::UsesIndex(opcode & 0x3f);
+  if (execute == &Cpu::ExecuteANDI)
+    return (opcode & 0x38) == 0;
+  return false;
+}
+
+template <class Cpu>
+bool IdleLoop<Cpu>::ReadsQuietly(Cpu &cpu, unsigned int opcode,
+                                 ExecutionPointer execute, Address address) {
+  const int mode_register = opcode & 0x3f;
+  if ((mode_register >> 3) < 2 || mode_register == 0x3c)
+    return true;  // Register or immediate
+
+  // Work out the size of the operand and where its extension words are
+  static const int move_width[] = {0, 1, 4, 2};
+  int width = 1 << ((opcode >> 6) & 3);
+  Address extension = address + 2;
+  if (execute == &Cpu::ExecuteMOVE)
+    width = move_width[(opcode >> 12) & 3];
+  else if (execute == &Cpu::ExecuteCMPA)
+    width = (opcode & 0x0100) ? 4 : 2;
+  else if (execute == &Cpu::ExecuteBit) {
+    width = 1;
+    if (!(opcode & 0x0100))
+      extension += 2;  // Bit number
+  } else if (execute == &Cpu::ExecuteCMPI)
+    extension += (width == 4) ? 4 : 2;
+
+  // The loop changes no address register, so the address stays the same
+  const Register *registers = cpu.register_value;
+  unsigned int word;
+  Address operand;
+  const int number = mode_register & 7;
+  switch (mode_register >> 3) {
+  case 2:  // Address Register Indirect
+  case 5:  // Address Register Indirect with Displacement
+    if (number == 7 && (registers[cpu.SR_INDEX] & cpu.S_FLAG))
+      operand = registers[cpu.SSP_INDEX];
+    else
+      operand = registers[cpu.A0_INDEX + number];
+    if (mode_register >> 3 == 5) {
+      if (cpu.Peek(extension, word, WORD) != cpu.EXECUTE_OK)
+        return false;
+      operand += cpu.SignExtend(word, WORD);
+    }
+    break;
+
+  case 7:
+    if (number == 0 || number == 2) {  // Absolute Short or PC Relative
+      if (cpu.Peek(extension, word, WORD) != cpu.EXECUTE_OK)
+        return false;
+      operand = cpu.SignExtend(word, WORD) + (number == 2 ? extension : 0);
+    } else if (number == 1) {  // Absolute Long
+      if (cpu.Peek(extension, word, LONG) != cpu.EXECUTE_OK)
+        return false;
+      operand = word;
+    } else {
+      return false;
+    }
+    break;
+
+  default:
+    return false;
+  }
+  return cpu.myAddressSpaces[0]->PeekIsQuiet(operand, width);
+}
+
+template <class Cpu>
+template <class ProgramCounter>
+Address IdleLoop<Cpu>::NextInstruction(
+    Cpu &cpu, void (Cpu::*disassemble)(int, ProgramCounter &, std::string &),
+    unsigned int opcode, Address address) {
+  ProgramCounter next = address + 2;
+  std::string mnemonic;
+  (cpu.*disassemble)(opcode, next, mnemonic);
+  return next;
+}
+
+template <class Cpu>
+void IdleLoop<Cpu>::Analyse(Cpu &cpu) {
+  myLength = 0;
+
+  // The PC must have got here by the branch being taken
+  unsigned int opcode, displacement;
+  if (cpu.Peek(myBranch, opcode, WORD) != cpu.EXECUTE_OK ||
+      cpu.DecodeInstruction(opcode).execute != &Cpu::ExecuteBcc)
+    return;
+  displacement = cpu.SignExtend(opcode & 0xff, BYTE);
+  if ((opcode & 0xff) == 0) {
+    if (cpu.Peek(myBranch + 2, displacement, WORD) != cpu.EXECUTE_OK)
+      return;
+    displacement = cpu.SignExtend(displacement, WORD);
+  }
+  if (Address(myBranch + 2 + displacement) != myTarget)
+    return;
+
+  size_t length = 0;
+  Address address = myTarget;
+  while (address < myBranch) {
+    if (length == MAX_LENGTH - 1 ||
+        cpu.Peek(address, opcode, WORD) != cpu.EXECUTE_OK)
+      return;
+    const typename Cpu::DecodeEntry &entry = cpu.DecodeInstruction(opcode);
+    if (!IsPollingInstruction(opcode, entry.execute) ||
+        !ReadsQuietly(cpu, opcode, entry.execute, address))
+      return;
+    myOpcodes[length++] = opcode;
+    address = NextInstruction(cpu, entry.disassemble, opcode, address);
+  }
+  if (address != myBranch)
+    return;
+  cpu.Peek(myBranch, opcode, WORD);
+  myOpcodes[length++] = opcode;
+  myLength = length;
+}
+
+template <class Cpu>
+size_t IdleLoop<Cpu>::Skip(Cpu &cpu, Address branch, size_t executed,
+                           size_t budget) {
+  const Address target = cpu.register_value[cpu.PC_INDEX];
+  const unsigned long generation = cpu.myAddressSpaces[0]->CodeGeneration();
+  const size_t previous = myExecuted;
+  const uint64_t deadline = cpu.myEventHandler.Deadline();
+  const bool quiet = deadline == myDeadline;
+  const bool same = branch == myBranch && target == myTarget &&
+                    generation == myGeneration;
+  myExecuted = executed;
+  myDeadline = deadline;
+
+  // A loop found not to be idle stays that way
+  if (same && myLength == 0) {
+    myCycles = cpu.myCycles;
+    return 0;
+  }
+
+  // Until an iteration leaves the registers as the one before, the loads may
+  // still be passing values along, or an interrupt may have moved the
+  // addresses the loop reads
+  size_t count;
+  const Register *registers = cpu.RegisterFile(count);
+  const bool settled =
+      same && myRegisters.size() == count &&
+      std::equal(registers, registers + count, myRegisters.begin());
+  myRegisters.assign(registers, registers + count);
+
+  if (!settled) {
+    myBranch = branch;
+    myTarget = target;
+    myGeneration = generation;
+    myCycles = cpu.myCycles;
+    Analyse(cpu);
+    return 0;
+  }
+
+  // Each iteration takes as long as the last one, as long as nothing else
+  // such as an interrupt ran in between.  An event changes the deadline, and
+  // may have changed what the loop is waiting for since it last looked.
+  const uint64_t period = cpu.myCycles - myCycles;
+  myCycles = cpu.myCycles;
+  if (executed - previous != myLength || period == 0 || !quiet ||
+      (registers[cpu.SR_INDEX] & cpu.T_FLAG))
+    return 0;
+
+  // Stop short of the next event so it happens at the same point as it
+  // would without skipping
+  uint64_t iterations = budget / myLength;
+  if (deadline != EventHandler::NEVER) {
+    if (deadline <= cpu.myCycles)
+      return 0;
+    iterations = std::min(iterations, (deadline - cpu.myCycles - 1) / period);
+  }
+  if (iterations == 0)
+    return 0;
+
+  cpu.myCycles += iterations * period;
+  myCycles = cpu.myCycles;
+  myExecuted += iterations * myLength;
+  for (size_t t = 0; t < myLength; ++t)
+    cpu.myStatistics.CountInstruction(myOpcodes[t], iterations);
+  return iterations * myLength;
+}
+
+#endif  // M68K_COMMON_IDLELOOP_HPP_
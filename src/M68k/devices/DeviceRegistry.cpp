@@ -3,7 +3,9 @@
 #include "M68k/devices/DeviceRegistry.hpp"
 #include "M68k/devices/Gdbsock.hpp"
 #include "M68k/devices/M68681.hpp"
+#include "M68k/devices/MappedImage.hpp"
 #include "M68k/devices/RAM.hpp"
+#include "M68k/devices/SparseRAM.hpp"
 #include "M68k/devices/Timer.hpp"
 
 // Array of device information (name, description, tcl script).
@@ -11,6 +13,14 @@ const DeviceInformation DeviceRegistry::ourDeviceInfo[] = {
     {
      "RAM", "Random Access Memory",
 #include "M68k/devices/RAM.scr"
+    },
+    {
+     "SparseRAM", "Random Access Memory allocated as it's written",
+#include "M68k/devices/SparseRAM.scr"
+    },
+    {
+     "MappedImage", "Memory mapped from a binary image file",
+#include "M68k/devices/MappedImage.scr"
     },
     {
      "GdbSocket", "Socket for connecting gdb",
@@ -35,6 +45,10 @@ bool DeviceRegistry::Create(const std::string &name, const std::string &args,
   device = nullptr;
   if (name == "RAM")
     device = new RAM(args, cpu);
+  else if (name == "SparseRAM")
+    device = new SparseRAM(args, cpu);
+  else if (name == "MappedImage")
+    device = new MappedImage(args, cpu);
   else if (name == "GdbSocket")
     device = new GdbSocket(args, cpu);
   else if (name == "M68681")
@@ -52,7 +52,7 @@ void log(const char *fmt, ...)
 #define TxEMT 8
 
 // Baudrate table (contains event duration times in micro-seconds)
-long M68681::baudrate_table[32] = {
+const long M68681::baudrate_table[32] = {
     160000, // 50     baudrate (i.e. (8*1000000)/50) uS)
     72727,  // 110
     59479,  // 134.5
@@ -140,6 +140,22 @@ M68681::M68681(const std::string &args, BasicCPU &cpu)
     return;
   }
 
+  // Scan the optional "Buffered = 0|1"
+  int bufferedFlag = 0;
+  std::streampos commands = in.tellg();
+  in >> keyword;
+  if (keyword == "Buffered") {
+    in >> equals >> bufferedFlag;
+    if ((!in) || (equals != "=")) {
+      ErrorMessage("Invalid initialization arguments!");
+      return;
+    }
+  } else {
+    in.seekg(commands);
+  }
+  buffered = (bufferedFlag != 0);
+  rx_fifo_depth = buffered ? 3 : 1;
+
   int loc;
   loc = args.find("PortACommand = ") + 15;
   std::string portACommand(args, loc, args.find(" PortBCommand = ") - loc);
@@ -169,6 +185,26 @@ M68681::M68681(const std::string &args, BasicCPU &cpu)
     }
   }
 
+  // Hand the pipes over to a thread so characters don't cost system calls
+  coma_channel = comb_channel = -1;
+  if (coma_pid != -1 || comb_pid != -1) {
+    io_thread.reset(new IOThread);
+    if (coma_pid != -1)
+      coma_channel = io_thread->AddChannel(coma_read_id, coma_write_id);
+    if (comb_pid != -1)
+      comb_channel = io_thread->AddChannel(comb_read_id, comb_write_id);
+    if (buffered) {
+      if (coma_channel != -1)
+        io_thread->Buffer(coma_channel);
+      if (comb_channel != -1)
+        io_thread->Buffer(comb_channel);
+    }
+    if (!io_thread->Start()) {
+      ErrorMessage("Problem starting the I/O thread!");
+      return;
+    }
+  }
+
   // Reset the DUART to its startup state
   Reset();
 
@@ -210,6 +246,9 @@ bool M68681::StartPortCommand(const std::string &command, bool std_flag,
   if (fcntl(read_pipe_ids[0], F_SETFD, 1) == -1)
     return false;
 
+  // Build the child's command line first, the child mustn't allocate
+  const std::string shell = "exec " + command;
+
   if ((pid = fork()) == 0) {
     // See if the pipes should be connected to STDIN and STDOUT
     if (std_flag) {
@@ -244,11 +283,10 @@ bool M68681::StartPortCommand(const std::string &command, bool std_flag,
       close(2);
     }
 
-    std::ostringstream out;
-    out << "exec " << command << std::flush;
-
-    if (execl("/bin/sh", "sh", "-c", out.str().c_str(), NULL))
-      exit(0);
+    // The child of a threaded process may only make async-signal-safe
+    // calls, so it leaves with _exit rather than running exit handlers
+    if (execl("/bin/sh", "sh", "-c", shell.c_str(), NULL))
+      _exit(127);
 
     return false;
   } else {
@@ -262,6 +300,9 @@ bool M68681::StartPortCommand(const std::string &command, bool std_flag,
 }
 
 M68681::~M68681() {
+  // Send what's still buffered before the pipes are closed
+  io_thread.reset();
+
   // We need to destory the Command Process
   if (coma_pid != -1) {
     close(coma_read_id);
@@ -286,6 +327,8 @@ void M68681::Reset() {
   IMR = 0;                     // Clear the interrupt mask register
   SRA = 0;                     // Clear status register A
   SRB = 0;                     // Clear status register B
+  rx_count_a = 0;              // Empty the receiver FIFOs
+  rx_count_b = 0;
   receiver_a_state = INACTIVE; // Set the channels to inactive state
   transmitter_a_state = INACTIVE;
   receiver_b_state = INACTIVE;
@@ -316,7 +359,14 @@ Byte M68681::Peek(Address addr) {
   } else if (addr == 1 * offset_between_registers) {   // Status Register A
     return SRA;
   } else if (addr == 3 * offset_between_registers) {   // Receive Buffer A
-    SRA &= ~RxRDY;
+    if (rx_count_a > 0) {
+      RBA = rx_fifo_a[0];
+      rx_fifo_a[0] = rx_fifo_a[1];
+      rx_fifo_a[1] = rx_fifo_a[2];
+      --rx_count_a;
+    }
+    if (rx_count_a == 0)
+      SRA &= ~RxRDY;
     SRA &= ~FFULL;
     SetInterruptStatusRegister();
     return RBA;
@@ -337,7 +387,14 @@ Byte M68681::Peek(Address addr) {
   } else if (addr == 9 * offset_between_registers) {   // Status Register B
     return SRB;
   } else if (addr == 11 * offset_between_registers) {  // Receive Buffer B
-    SRB &= ~RxRDY;
+    if (rx_count_b > 0) {
+      RBB = rx_fifo_b[0];
+      rx_fifo_b[0] = rx_fifo_b[1];
+      rx_fifo_b[1] = rx_fifo_b[2];
+      --rx_count_b;
+    }
+    if (rx_count_b == 0)
+      SRB &= ~RxRDY;
     SRB &= ~FFULL;
     SetInterruptStatusRegister();
     return RBB;
@@ -347,6 +404,19 @@ Byte M68681::Peek(Address addr) {
   return 0;
 }
 
+// Reading the mode registers moves their pointer and reading the receive
+// buffers takes characters from the FIFOs, everything else just reads
+bool M68681::PeekIsQuiet(Address addr, size_t length) const {
+  for (size_t k = 0; k < length; ++k) {
+    const Address offset = addr + k - (base_address + offset_to_first_register);
+    if (offset == 0 || offset == 3 * offset_between_registers ||
+        offset == 8 * offset_between_registers ||
+        offset == 11 * offset_between_registers)
+      return false;
+  }
+  return true;
+}
+
 // Write to one of the registers in the DUART
 void M68681::Poke(Address addr, Byte c) {
   addr -= (base_address + offset_to_first_register);
@@ -368,6 +438,7 @@ void M68681::Poke(Address addr, Byte c) {
       break;
     case 2: // Reset receiver
       receiver_a_state = INACTIVE;
+      rx_count_a = 0;
       SRA &= ~RxRDY;
       SRA &= ~FFULL;
       SetInterruptStatusRegister();
@@ -399,6 +470,7 @@ void M68681::Poke(Address addr, Byte c) {
     switch (c & 0x3) {
     case 1: // Enable receiver
       receiver_a_state = ACTIVE;
+      rx_count_a = 0;
       SRA &= ~RxRDY;
       SRA &= ~FFULL;
       SetInterruptStatusRegister();
@@ -413,7 +485,11 @@ void M68681::Poke(Address addr, Byte c) {
     SRA &= ~TxEMT;
     SetInterruptStatusRegister();
 
-    if (ACR & 128)
+    // Buffered ports hand characters over at once instead of taking the
+    // time a real line would
+    if (buffered)
+      EventCallback(WRITE_A_CALLBACK, 0);
+    else if (ACR & 128)
       myCPU.eventHandler()
           .Add(this, WRITE_A_CALLBACK, 0, baudrate_table[(CSRA & 0xf) + 16]);
     else
@@ -443,6 +519,7 @@ void M68681::Poke(Address addr, Byte c) {
       break;
     case 2: // Reset receiver
       receiver_b_state = INACTIVE;
+      rx_count_b = 0;
       SRB &= ~RxRDY;
       SRB &= ~FFULL;
       SetInterruptStatusRegister();
@@ -474,6 +551,7 @@ void M68681::Poke(Address addr, Byte c) {
     switch (c & 0x3) {
     case 1: // Enable receiver
       receiver_b_state = ACTIVE;
+      rx_count_b = 0;
       SRB &= ~RxRDY;
       SRB &= ~FFULL;
       SetInterruptStatusRegister();
@@ -489,7 +567,9 @@ void M68681::Poke(Address addr, Byte c) {
     SRB &= ~TxEMT;
     SetInterruptStatusRegister();
 
-    if (ACR & 128)
+    if (buffered)
+      EventCallback(WRITE_B_CALLBACK, 0);
+    else if (ACR & 128)
       (myCPU.eventHandler())
           .Add(this, WRITE_B_CALLBACK, 0, baudrate_table[(CSRB & 0xf) + 16]);
     else
@@ -542,7 +622,7 @@ void M68681::EventCallback(int type, void *) {
       break;
 
     default: // Normal mode
-      if (write(coma_write_id, &c, 1) != 1) {
+      if (!io_thread->Transmit(coma_channel, c)) {
         exit(1);
       }
       SRA |= TxRDY; // Ready for more data
@@ -561,27 +641,24 @@ void M68681::EventCallback(int type, void *) {
     }
 
     // Try to read a byte from the pipe
-    if (read(coma_read_id, &c, 1) == 1) {
+    if (io_thread->Receive(coma_channel, c)) {
       // Mask off bits that shouldn't be received
       switch (MR1A & 3) {
       case 0:
-        RBA = c & 0x1f;
+        c &= 0x1f;
         break;
       case 1:
-        RBA = c & 0x3f;
+        c &= 0x3f;
         break;
       case 2:
-        RBA = c & 0x7f;
+        c &= 0x7f;
         break;
-
-      default:
-        RBA = c;
       }
 
       // Handle any special stuff for the funky modes
       switch ((MR2A & 0xc0) >> 6) {
       case 1: // Automatic-echo mode
-        if (write(coma_write_id, &RBA, 1) != 1) {
+        if (!io_thread->Transmit(coma_channel, c)) {
           exit(1);
         }
         break;
@@ -591,8 +668,13 @@ void M68681::EventCallback(int type, void *) {
       //      if(SRA & FFULL)
       //        SRA |= 16;
 
+      // Characters arrive one per character time even when the FIFO has
+      // room for more, programs which look for input while they write
+      // output would take them too early otherwise
+      rx_fifo_a[rx_count_a++] = c;
       SRA |= RxRDY;
-      SRA |= FFULL;
+      if (rx_count_a == rx_fifo_depth)
+        SRA |= FFULL;
       SetInterruptStatusRegister();
 
       // Reschedule another read callback to check for more characters
@@ -602,7 +684,7 @@ void M68681::EventCallback(int type, void *) {
       else
         myCPU.eventHandler()
             .Add(this, READ_A_CALLBACK, 0, baudrate_table[(CSRA >> 4)]);
-    } else {
+    } else if (!io_thread->Finished(coma_channel)) {
       // Reschedule another read callback to check for more characters
       myCPU.eventHandler()
           .Add(this, READ_A_CALLBACK, 0, DEFAULT_READ_CALLBACK_DURATION);
@@ -646,7 +728,7 @@ void M68681::EventCallback(int type, void *) {
     case 3: // Multidrop mode (not implemented)
 
     default: // Normal mode
-      if (write(comb_write_id, &c, 1) != 1) {
+      if (!io_thread->Transmit(comb_channel, c)) {
         exit(1);
       }
       SRB |= TxRDY;
@@ -674,27 +756,24 @@ void M68681::EventCallback(int type, void *) {
     }
 
     // Try to read a byte from the pipe
-    if (read(comb_read_id, &c, 1) == 1) {
+    if (io_thread->Receive(comb_channel, c)) {
       // Mask off bits that shouldn't be received
       switch (MR1B & 3) {
       case 0:
-        RBB = c & 0x1f;
+        c &= 0x1f;
         break;
       case 1:
-        RBB = c & 0x3f;
+        c &= 0x3f;
         break;
       case 2:
-        RBB = c & 0x7f;
+        c &= 0x7f;
         break;
-
-      default:
-        RBB = c;
       }
 
       // Handle any special stuff for the funky modes
       switch ((MR2B & 0xc0) >> 6) {
       case 1: // Automatic-echo mode (transmitter link disabled)
-        if (write(comb_write_id, &RBB, 1) != 1) {
+        if (!io_thread->Transmit(comb_channel, c)) {
           exit(1);
         }
         break;
@@ -704,8 +783,10 @@ void M68681::EventCallback(int type, void *) {
       //      if(SRB & FFULL)
       //        SRB |= 16;
 
+      rx_fifo_b[rx_count_b++] = c;
       SRB |= RxRDY;
-      SRB |= FFULL;
+      if (rx_count_b == rx_fifo_depth)
+        SRB |= FFULL;
       SetInterruptStatusRegister();
 
       // Reschedule another read callback to check for more characters
@@ -715,7 +796,7 @@ void M68681::EventCallback(int type, void *) {
       else
         (myCPU.eventHandler())
             .Add(this, READ_B_CALLBACK, 0, baudrate_table[(CSRB >> 4)]);
-    } else {
+    } else if (!io_thread->Finished(comb_channel)) {
       // Reschedule another read callback to check for more characters
       (myCPU.eventHandler())
           .Add(this, READ_B_CALLBACK, 0, DEFAULT_READ_CALLBACK_DURATION);
@@ -5,10 +5,12 @@
 #ifndef M68K_DEVICES_M68681_HPP_
 #define M68K_DEVICES_M68681_HPP_
 
+#include <memory>
 #include <string>
 #include <sys/types.h>
 
 #include "Framework/BasicDevice.hpp"
+#include "Framework/IOThread.hpp"
 
 class M68681 : public BasicDevice {
 public:
@@ -33,6 +35,10 @@ public:
   // Puts a byte into the device
   void Poke(Address addr, Byte c) override;
 
+  // Returns true iff none of the bytes is a mode register or a receive
+  // buffer, which change the DUART when they're read
+  bool PeekIsQuiet(Address addr, size_t length) const override;
+
   // Resets the DUART.
   void Reset() override;
 
@@ -81,12 +87,23 @@ private:
   Byte mr1a_pointer; // Determines MR1A/MR2A
   Byte mr1b_pointer; // Determines MR1B/MR2B
 
+  Byte rx_fifo_a[3]; // Characters received on A, oldest first
+  Byte rx_fifo_b[3]; // Characters received on B, oldest first
+  int rx_count_a;    // Number of characters in rx_fifo_a
+  int rx_count_b;    // Number of characters in rx_fifo_b
+  int rx_fifo_depth; // Characters a receiver holds before it's full
+
+  // Set when characters are passed on as fast as the program writes them,
+  // and the receivers use their whole FIFO, instead of running at the baud
+  // rate with a single receive buffer
+  bool buffered;
+
   Byte receiver_a_state;    // State of receiver A
   Byte transmitter_a_state; // State of transmitter A
   Byte receiver_b_state;    // State of receiver B
   Byte transmitter_b_state; // State of transmitter B
 
-  static long baudrate_table[32]; // Table of times for baud rates
+  static const long baudrate_table[32]; // Table of times for baud rates
 
   int coma_read_id;  // Pipe to command for port a
   int coma_write_id; // Pipe to command for port a
@@ -95,6 +112,11 @@ private:
   pid_t coma_pid;    // Proccess ID for port a command
   pid_t comb_pid;    // Proccess ID for port b command
 
+  // Moves characters between the pipes and the ports, nullptr without any
+  std::unique_ptr<IOThread> io_thread;
+  int coma_channel;  // I/O thread channel for port a
+  int comb_channel;  // I/O thread channel for port b
+
   Address base_address;             // Base address of the DUART
   size_t offset_to_first_register;  // Offset to the first registers
   size_t offset_between_registers;  // Offset to between registers
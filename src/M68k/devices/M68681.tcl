@@ -18,6 +18,7 @@
 proc DeviceSetupGetValues {} {
   global DevicePortAStd
   global DevicePortBStd
+  global DeviceBuffered
 
   set base [.device.base.entry get]
   set offset_to_first [.device.offsetToFirst get]
@@ -27,8 +28,9 @@ proc DeviceSetupGetValues {} {
   if {$DevicePortAStd == 1} {set port_a_std 1} else {set port_a_std 0}
   set port_b_command [.device.portB.entry get] 
   if {$DevicePortBStd == 1} {set port_b_std 1} else {set port_b_std 0}
+  if {$DeviceBuffered == 1} {set buffered 1} else {set buffered 0}
 
-  set result "BaseAddress = $base OffsetToFirstRegister = $offset_to_first OffsetBetweenRegisters = $offset_between InterruptLevel = $interrupt_level PortAStandardInputOutputFlag = $port_a_std PortBStandardInputOutputFlag = $port_b_std PortACommand = $port_a_command PortBCommand = $port_b_command"
+  set result "BaseAddress = $base OffsetToFirstRegister = $offset_to_first OffsetBetweenRegisters = $offset_between InterruptLevel = $interrupt_level PortAStandardInputOutputFlag = $port_a_std PortBStandardInputOutputFlag = $port_b_std Buffered = $buffered PortACommand = $port_a_command PortBCommand = $port_b_command"
 
   return "$result"
 }
@@ -51,6 +53,7 @@ proc DeviceSetup {} {
   global DeviceSetupReturnValue
   global DevicePortAStd
   global DevicePortBStd
+  global DeviceBuffered
 
   catch {destroy .device}
  
@@ -98,6 +101,9 @@ proc DeviceSetup {} {
     pack .device.portB.label -side left
     pack .device.portB.entry -side left -fill x -expand 1 -pady 4 -padx 4
 
+  checkbutton .device.buffered -relief groove -variable DeviceBuffered \
+      -text "Buffer the ports for high throughput?"
+
   frame .device.buttons
     button .device.buttons.ok -text "Okay" \
       -command {set DeviceSetupReturnValue [DeviceSetupGetValues]
@@ -117,6 +123,7 @@ proc DeviceSetup {} {
       -ipadx 4 -ipady 4
   pack .device.portA -side top -fill x -pady 4 -padx 4
   pack .device.portB -side top -fill x -pady 4 -padx 4
+  pack .device.buffered -side top -fill x -pady 4 -padx 4
   pack .device.buttons -side top -fill x -pady 4
 
   # Set some defaults
@@ -125,6 +132,7 @@ proc DeviceSetup {} {
   .device.interruptLevel set 4
   set DevicePortAStd 0
   set DevicePortBStd 0
+  set DeviceBuffered 0
 
   # Set focus to the first entry widget
   tkwait visibility .device
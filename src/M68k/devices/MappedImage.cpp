@@ -0,0 +1,107 @@
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <ios>
+#include <sstream>
+
+#include "Framework/BasicCPU.hpp"
+#include "M68k/devices/MappedImage.hpp"
+
+MappedImage::MappedImage(const std::string &args, BasicCPU &cpu)
+    : BasicDevice("MappedImage", args, cpu), myBaseAddress(0), mySize(0),
+      myMode(ROM), myImage(nullptr) {
+  std::istringstream in(args);
+  std::string keyword, equals, filename, mode;
+  Address base;
+
+  // Scan "BaseAddress = nnnn"
+  in >> keyword >> equals >> std::hex >> base;
+  if ((!in) || (keyword != "BaseAddress") || (equals != "=")) {
+    ErrorMessage("Invalid initialization arguments!");
+    return;
+  }
+
+  // Scan "File = name"
+  in >> keyword >> equals >> filename;
+  if ((!in) || (keyword != "File") || (equals != "=")) {
+    ErrorMessage("Invalid initialization arguments!");
+    return;
+  }
+
+  // Scan "Mode = ROM|RAM|NVRAM"
+  in >> keyword >> equals >> mode;
+  if ((!in) || (keyword != "Mode") || (equals != "=")) {
+    ErrorMessage("Invalid initialization arguments!");
+    return;
+  }
+  if (mode == "ROM") {
+    myMode = ROM;
+  } else if (mode == "RAM") {
+    myMode = RAM;
+  } else if (mode == "NVRAM") {
+    myMode = NVRAM;
+  } else {
+    ErrorMessage("Invalid mode, it must be ROM, RAM or NVRAM!");
+    return;
+  }
+
+  // Only NVRAM writes go back to the file, the others are copied on write
+  int fd = open(filename.c_str(), (myMode == NVRAM) ? O_RDWR : O_RDONLY);
+  if (fd < 0) {
+    ErrorMessage("Could not open " + filename + "!");
+    return;
+  }
+  struct stat status;
+  if (fstat(fd, &status) != 0 || status.st_size <= 0) {
+    close(fd);
+    ErrorMessage("Could not find the size of " + filename + "!");
+    return;
+  }
+  int protection = (myMode == ROM) ? PROT_READ : PROT_READ | PROT_WRITE;
+  int flags = (myMode == NVRAM) ? MAP_SHARED : MAP_PRIVATE;
+  void *image = mmap(nullptr, status.st_size, protection, flags, fd, 0);
+  close(fd);
+  if (image == MAP_FAILED) {
+    ErrorMessage("Could not map " + filename + "!");
+    return;
+  }
+
+  myImage = static_cast<Byte *>(image);
+  myBaseAddress = base * cpu.Granularity();
+  mySize = status.st_size;
+}
+
+MappedImage::~MappedImage() {
+  if (myImage != nullptr) {
+    if (myMode == NVRAM)
+      msync(myImage, mySize, MS_SYNC);
+    munmap(myImage, mySize);
+  }
+}
+
+bool MappedImage::CheckMapped(Address address) const {
+  return (address >= myBaseAddress) && (address - myBaseAddress < mySize);
+}
+
+Byte MappedImage::Peek(Address address) {
+  if (!CheckMapped(address)) {
+    return 0xFF;
+  }
+  return myImage[address - myBaseAddress];
+}
+
+void MappedImage::Poke(Address address, Byte c) {
+  if (myMode != ROM && CheckMapped(address)) {
+    myImage[address - myBaseAddress] = c;
+  }
+}
+
+Byte *MappedImage::Memory(Address address, size_t length, bool write) {
+  if ((write && myMode == ROM) || length == 0 || !CheckMapped(address) ||
+      !CheckMapped(address + length - 1)) {
+    return nullptr;
+  }
+  return myImage + (address - myBaseAddress);
+}
@@ -0,0 +1,60 @@
+//
+// Memory Device holding a raw binary image that's mapped straight from a
+// file instead of being loaded.  As a ROM it can't be written, as RAM its
+// writes are private to the simulator and as NVRAM they're written back to
+// the file.  Simulators mapping the same image share its unwritten pages.
+//
+
+#ifndef M68K_DEVICES_MAPPEDIMAGE_HPP_
+#define M68K_DEVICES_MAPPEDIMAGE_HPP_
+
+#include <string>
+
+#include "Framework/BasicDevice.hpp"
+
+class MappedImage : public BasicDevice {
+public:
+  MappedImage(const std::string &args, BasicCPU &cpu);
+  ~MappedImage() override;
+
+  // Returns true iff the address maps into the device.
+  bool CheckMapped(Address address) const override;
+
+  // Returns the lowest address used by the device.
+  Address LowestAddress() const override { return myBaseAddress; }
+
+  // Returns the highest address used by the device.
+  Address HighestAddress() const override {
+    return myBaseAddress + mySize - 1;
+  }
+
+  // Gets a byte from the image.
+  Byte Peek(Address address) override;
+
+  // Puts a byte into the image unless it's a ROM.
+  void Poke(Address address, Byte c) override;
+
+  // Returns the part of the image holding the given bytes, unless they're
+  // to be written and it's a ROM.
+  Byte *Memory(Address address, size_t length, bool write) override;
+
+  // Images never have Events
+  void EventCallback(int, void *) override { }
+
+private:
+  // How writes are handled.
+  enum Mode { ROM, RAM, NVRAM };
+
+  // Starting address of the device
+  Address myBaseAddress;
+
+  // Size of the image in bytes
+  size_t mySize;
+
+  Mode myMode;
+
+  // The mapped image, or nullptr if it couldn't be mapped
+  Byte *myImage;
+};
+
+#endif  // M68K_DEVICES_MAPPEDIMAGE_HPP_
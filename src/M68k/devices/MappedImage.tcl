@@ -0,0 +1,97 @@
+#!/usr/local/bin/wish -f
+#
+# This Tcl script gets the setup information for the MappedImage device.
+#
+# Notes: - All Procedures and global variables begin with "DeviceSetup".  This
+#          should be true for all device scripts.
+#        - The toplevel window should be .device for all device scripts.
+#        - The script must return a valid argument for the device's
+#          constructor. (i.e. "BaseAddress = 0 File = rom.bin Mode = ROM")
+#        - If the cancel button is pressed the empty string should be
+#          returned
+#        - All device scripts should be modal dialogs
+
+proc DeviceSetupGetValues {} {
+  set base [.device.inputs.entry.address get]
+  set file [.device.inputs.entry.file get]
+  set mode [.device.inputs.entry.mode get]
+
+  set result "BaseAddress = $base File = $file Mode = $mode"
+  return "$result"
+}
+
+proc DeviceSetupCheckValues {} {
+  set base [.device.inputs.entry.address get]
+  set file [.device.inputs.entry.file get]
+  set mode [.device.inputs.entry.mode get]
+
+  if {[regexp {^[0-9A-Fa-f]+$} $base] && [regexp {^[^ ]+$} $file] && \
+      [regexp {^(ROM|RAM|NVRAM)$} $mode]} {
+    destroy .device 
+  }
+}
+
+###############################################################################
+# This is the procedure the User Interface calls
+###############################################################################
+proc DeviceSetup {} {
+  global DeviceSetupReturnValue
+
+  catch {destroy .device}
+ 
+  toplevel .device
+  wm title .device "Mapped Image Setup"
+  wm iconname .device "Mapped Image Setup"
+
+  message .device.message \
+    -text "Please enter the base address of the image, the binary file holding it and whether it's a ROM, RAM or NVRAM.  NVRAM writes are saved to the file.\n\nThe address is in hexadecimal!" \
+    -width 3i -justify left
+
+  frame .device.inputs -relief ridge -borderwidth 2
+    frame .device.inputs.label
+      label .device.inputs.label.address -text "Base Address:"
+      label .device.inputs.label.file -text "File:"
+      label .device.inputs.label.mode -text "Mode:"
+      pack .device.inputs.label.address -side top 
+      pack .device.inputs.label.file -side top
+      pack .device.inputs.label.mode -side top
+    frame .device.inputs.entry
+      entry .device.inputs.entry.address -width 10 -relief sunken
+      bind .device.inputs.entry.address \
+          <Return> { focus .device.inputs.entry.file }
+      entry .device.inputs.entry.file -width 30 -relief sunken
+      bind .device.inputs.entry.file \
+          <Return> { focus .device.inputs.entry.mode }
+      entry .device.inputs.entry.mode -width 10 -relief sunken
+      .device.inputs.entry.mode insert 0 ROM
+      bind .device.inputs.entry.mode \
+          <Return> { focus .device.inputs.entry.address }
+      pack .device.inputs.entry.address -side top -fill x -expand 1 -pady 2
+      pack .device.inputs.entry.file -side top -fill x -expand 1 -pady 2
+      pack .device.inputs.entry.mode -side top -fill x -expand 1 -pady 2
+    pack .device.inputs.label -side left 
+    pack .device.inputs.entry -side left -fill x -expand 1 -padx 2
+
+  frame .device.buttons
+    button .device.buttons.ok -text "Okay" \
+      -command {set DeviceSetupReturnValue [DeviceSetupGetValues]
+                DeviceSetupCheckValues}
+    button .device.buttons.cancel -text "Cancel" \
+      -command {set DeviceSetupReturnValue ""; destroy .device}
+    pack .device.buttons.ok -side left -expand 1 -fill x -padx 4
+    pack .device.buttons.cancel -side right -expand 1 -fill x -padx 4
+
+  pack .device.message -side top -fill x -pady 4 -padx 4
+  pack .device.inputs -side top -fill x -pady 2 -padx 4 -ipady 2
+  pack .device.buttons -side top -fill x -pady 4
+
+  # Set input focus to the first entry widget
+  tkwait visibility .device
+  focus .device.inputs.entry.address
+
+  # Make this a modal dialog
+  grab set .device
+  tkwait window .device
+
+  return $DeviceSetupReturnValue
+}
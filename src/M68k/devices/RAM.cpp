@@ -1,6 +1,8 @@
+#include <cstring>
 #include <ios>
 #include <sstream>
 
+#include "Framework/AddressSpace.hpp"
 #include "Framework/Tools.hpp"
 #include "Framework/BasicCPU.hpp"
 #include "M68k/devices/RAM.hpp"
@@ -39,3 +41,37 @@ RAM::~RAM() { delete[] myBuffer; }
 bool RAM::CheckMapped(Address address) const {
   return (address >= myBaseAddress) && (address < myBaseAddress + mySize);
 }
+
+bool RAM::Peek(Address address, unsigned long &data, int size) {
+  const int width = (size == LONG) ? 4 : (size == WORD) ? 2 : 1;
+  if (!Contains(address, width)) {
+    return BasicDevice::Peek(address, data, size);
+  }
+  data = ReadBigEndian(myBuffer + (address - myBaseAddress), width);
+  return true;
+}
+
+bool RAM::Poke(Address address, unsigned long data, int size) {
+  const int width = (size == LONG) ? 4 : (size == WORD) ? 2 : 1;
+  if (!Contains(address, width)) {
+    return BasicDevice::Poke(address, data, size);
+  }
+  WriteBigEndian(myBuffer + (address - myBaseAddress), data, width);
+  return true;
+}
+
+void RAM::ReadBlock(Address address, Byte *data, size_t length) {
+  if (!Contains(address, length)) {
+    BasicDevice::ReadBlock(address, data, length);
+    return;
+  }
+  std::memcpy(data, myBuffer + (address - myBaseAddress), length);
+}
+
+void RAM::WriteBlock(Address address, const Byte *data, size_t length) {
+  if (!Contains(address, length)) {
+    BasicDevice::WriteBlock(address, data, length);
+    return;
+  }
+  std::memcpy(myBuffer + (address - myBaseAddress), data, length);
+}
@@ -38,6 +38,24 @@ public:
     }
   }
 
+  // Gets a byte, word or long from memory in one go.
+  bool Peek(Address address, unsigned long &data, int size);
+
+  // Puts a byte, word or long into memory in one go.
+  bool Poke(Address address, unsigned long data, int size);
+
+  // Copies a block out of memory.
+  void ReadBlock(Address address, Byte *data, size_t length);
+
+  // Copies a block into memory.
+  void WriteBlock(Address address, const Byte *data, size_t length);
+
+  // Returns the part of the buffer holding the given bytes.
+  Byte *Memory(Address address, size_t length, bool) {
+    return Contains(address, length) ? myBuffer + (address - myBaseAddress)
+                                     : nullptr;
+  }
+
   // RAM never has Events
   void EventCallback(int, void *) { }
 
@@ -46,6 +64,13 @@ protected:
   Byte *myBuffer;
 
 private:
+  // Answers true iff the length bytes starting at the address are all in
+  // the RAM.
+  bool Contains(Address address, size_t length) const {
+    return address >= myBaseAddress && length <= mySize &&
+           address - myBaseAddress <= mySize - length;
+  }
+
   // Starting address of the RAM device
   Address myBaseAddress;
 
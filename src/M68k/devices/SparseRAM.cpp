@@ -0,0 +1,97 @@
+#include <cstring>
+#include <ios>
+#include <sstream>
+
+#include "Framework/BasicCPU.hpp"
+#include "Framework/StatInfo.hpp"
+#include "Framework/Tools.hpp"
+#include "M68k/devices/SparseRAM.hpp"
+
+SparseRAM::SparseRAM(const std::string &args, BasicCPU &cpu)
+    : BasicDevice("SparseRAM", args, cpu), myBaseAddress(0), mySize(0),
+      myFill(0), myResidentPages(0) {
+  std::istringstream in(args);
+  std::string keyword, equals;
+  Address base;
+  size_t size;
+
+  // Scan "BaseAddress = nnnn"
+  in >> keyword >> equals >> std::hex >> base;
+  if ((!in) || (keyword != "BaseAddress") || (equals != "=")) {
+    ErrorMessage("Invalid initialization arguments!");
+    return;
+  }
+
+  // Scan "Size = nnnn"
+  in >> keyword >> equals >> std::hex >> size;
+  if ((!in) || (keyword != "Size") || (equals != "=")) {
+    ErrorMessage("Invalid initialization arguments!");
+    return;
+  }
+
+  // Scan the optional "Fill = nn"
+  unsigned int fill = 0;
+  if (in >> keyword) {
+    in >> equals >> std::hex >> fill;
+    if ((!in) || (keyword != "Fill") || (equals != "=") || fill > 0xff) {
+      ErrorMessage("Invalid initialization arguments!");
+      return;
+    }
+  }
+
+  myBaseAddress = base * cpu.Granularity();
+  mySize = size * cpu.Granularity();
+  myFill = fill;
+
+  if (mySize > 0) {
+    size_t first = myBaseAddress >> PAGE_SHIFT;
+    size_t last = (myBaseAddress + mySize - 1) >> PAGE_SHIFT;
+    myPages.resize(last - first + 1);
+  }
+}
+
+bool SparseRAM::CheckMapped(Address address) const {
+  return (address >= myBaseAddress) && (address - myBaseAddress < mySize);
+}
+
+Byte *SparseRAM::Page(Address address, bool allocate) {
+  size_t index = (address >> PAGE_SHIFT) - (myBaseAddress >> PAGE_SHIFT);
+  std::unique_ptr<Byte[]> &page = myPages[index];
+  if (!page && allocate) {
+    page.reset(new Byte[PAGE_SIZE]);
+    std::memset(page.get(), myFill, PAGE_SIZE);
+    ++myResidentPages;
+  }
+  return page.get();
+}
+
+Byte SparseRAM::Peek(Address address) {
+  if (!CheckMapped(address)) {
+    return 0xFF;
+  }
+  const Byte *page = Page(address, false);
+  return (page == nullptr) ? myFill : page[address & (PAGE_SIZE - 1)];
+}
+
+void SparseRAM::Poke(Address address, Byte c) {
+  if (CheckMapped(address)) {
+    Page(address, true)[address & (PAGE_SIZE - 1)] = c;
+  }
+}
+
+Byte *SparseRAM::Memory(Address address, size_t length, bool write) {
+  if (length == 0 || !CheckMapped(address) ||
+      !CheckMapped(address + length - 1) ||
+      (address & (PAGE_SIZE - 1)) + length > PAGE_SIZE) {
+    return nullptr;
+  }
+  Byte *page = Page(address, write);
+  return (page == nullptr) ? nullptr : page + (address & (PAGE_SIZE - 1));
+}
+
+void SparseRAM::BuildStatisticalInformationList(
+    StatisticalInformationList &list) {
+  list.Append("SparseRAM " + IntToString(myBaseAddress, 8) +
+              " Resident Bytes: " +
+              std::to_string(myResidentPages * PAGE_SIZE));
+}
@@ -0,0 +1,72 @@
+//
+// Random Access Memory Device which only sets aside host memory for the
+// pages that are written.  Pages that haven't been written read as a fill
+// byte, so large memory windows of which little is used stay cheap.
+//
+
+#ifndef M68K_DEVICES_SPARSERAM_HPP_
+#define M68K_DEVICES_SPARSERAM_HPP_
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Framework/BasicDevice.hpp"
+
+class SparseRAM : public BasicDevice {
+public:
+  SparseRAM(const std::string &args, BasicCPU &cpu);
+
+  // Returns true iff the address maps into the device.
+  bool CheckMapped(Address address) const override;
+
+  // Returns the lowest address used by the device.
+  Address LowestAddress() const override { return myBaseAddress; }
+
+  // Returns the highest address used by the device.
+  Address HighestAddress() const override {
+    return myBaseAddress + mySize - 1;
+  }
+
+  // Gets a byte from memory.
+  Byte Peek(Address address) override;
+
+  // Puts a byte into memory, setting aside its page first if need be.
+  void Poke(Address address, Byte c) override;
+
+  // Returns the page memory holding the given bytes, if they're in one page,
+  // setting it aside first if it's to be written.
+  Byte *Memory(Address address, size_t length, bool write) override;
+
+  // Appends the amount of host memory in use to the list.
+  void BuildStatisticalInformationList(
+      StatisticalInformationList &list) override;
+
+  // RAM never has Events
+  void EventCallback(int, void *) override { }
+
+private:
+  // Pages are 2^PAGE_SHIFT bytes and start at multiples of their size.
+  static const int PAGE_SHIFT = 12;
+  static const size_t PAGE_SIZE = size_t(1) << PAGE_SHIFT;
+
+  // Returns the memory of the page holding the address, setting it aside
+  // iff allocate is true, or nullptr if it hasn't been.
+  Byte *Page(Address address, bool allocate);
+
+  // Starting address of the RAM device
+  Address myBaseAddress;
+
+  // Size of the RAM device in bytes
+  size_t mySize;
+
+  // Value read from locations that haven't been written
+  Byte myFill;
+
+  // Memory for each page from the one holding the base address onwards,
+  // empty until the page is written, and the number that aren't.
+  std::vector<std::unique_ptr<Byte[]>> myPages;
+  size_t myResidentPages;
+};
+
+#endif  // M68K_DEVICES_SPARSERAM_HPP_
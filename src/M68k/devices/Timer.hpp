@@ -51,6 +51,9 @@ public:
   // Puts a byte into the device.
   void Poke(Address address, Byte c) override;
 
+  // Returns true since reading the registers changes nothing.
+  bool PeekIsQuiet(Address, size_t) const override { return true; }
+
   // Resets the device.
   void Reset() override;
 
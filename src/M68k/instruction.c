@@ -2,10 +2,13 @@
  * instruction.c
  *
  * This program reads in an instruction definition file and builds the
- * m68000DecodeTable.hpp file.  It checks the input to make sure that all
+ * DecodeTable.hpp file.  It checks the input to make sure that all
  * instruction entries are distinguishable (if not an error is reported).
+ * Each entry names both the routine that executes the instruction and the
+ * one that disassembles it.  A dispatch table giving the entry for every
+ * opcode is built too, so nothing needs to be decoded at run time.
  *
- * Usage: instruction
+ * Usage: instruction input output class
  */
 
 #include <stdio.h>
@@ -22,6 +25,7 @@ typedef struct {
 } Entry;
 
 Entry table[4096];
+int dispatch[65536];
 
 int
 Compare(const void *a, const void *b)
@@ -79,7 +83,7 @@ main(int argc, char *argv[])
 	int num_of_entries;
 	char input[320], name[80], gen[80];
 	char mask[80], signature[80];
-	int t, s;
+	int t, s, opcode;
 
 	if (argc != 4) {
 		fprintf(stderr, "Usage: instruction input output class\n");
@@ -153,22 +157,43 @@ main(int argc, char *argv[])
 	printf("Sorting list...\n");
 	qsort((void *)table, num_of_entries, sizeof(Entry), Compare);
 
-	/* Generate the instruction decode table */
+	/* Work out which entry each opcode decodes to, 0 if none */
+	printf("Building dispatch table...\n");
+	for (opcode = 0; opcode < 65536; ++opcode) {
+		dispatch[opcode] = 0;
+		for (t = 0; t < num_of_entries; ++t)
+			if ((opcode & table[t].mask) == table[t].signature)
+				dispatch[opcode] = t + 1;
+	}
+
+	/* Generate the instruction decode and dispatch tables */
 	printf("Writing '%s' file...\n\n", outfile);
 	fp = fopen(outfile, "w");
+	fprintf(fp, "// Generated from %s by instruction, do not edit.\n\n",
+		infile);
+	fprintf(fp, "// Instructions indexed by the dispatch table, the first "
+		"is for invalid opcodes\n");
+	fprintf(fp, "const %s::DecodeEntry %s::ourDecodeTable[] = {\n",
+		classname, classname);
+	fprintf(fp, "  { 0x0000, 0x0000, &%s::ExecuteInvalid, "
+		"&%s::DisassembleInvalid, \"Invalid\" },\n",
+		classname, classname);
 	for (t = 0; t < num_of_entries; ++t)
-		if (t != num_of_entries - 1)
-			fprintf(fp,
-				"  { 0x%04x, 0x%04x, &%s::Execute%s },\n",
-				table[t].mask, table[t].signature,
-				classname,
-				table[t].name);
-		else
-			fprintf(fp,
-				"  { 0x%04x, 0x%04x, &%s::Execute%s }\n",
-				table[t].mask, table[t].signature,
-				classname,
-				table[t].name);
+		fprintf(fp,
+			"  { 0x%04x, 0x%04x, &%s::Execute%s, "
+			"&%s::Disassemble%s, \"%s\" },\n",
+			table[t].mask, table[t].signature,
+			classname, table[t].name,
+			classname, table[t].name, table[t].name);
+	fprintf(fp, "};\n\n");
+
+	fprintf(fp, "// Index of the decode table entry for each opcode\n");
+	fprintf(fp, "const uint16_t %s::ourDispatchTable[65536] = {\n",
+		classname);
+	for (opcode = 0; opcode < 65536; ++opcode)
+		fprintf(fp, "%s%d,%s", (opcode % 16) ? " " : "  ",
+			dispatch[opcode], (opcode % 16 == 15) ? "\n" : "");
+	fprintf(fp, "};\n");
 
 	fclose(fp);
 
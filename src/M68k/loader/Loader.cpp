@@ -1,4 +1,5 @@
 #include <fstream>
+#include <vector>
 
 #include "Framework/Types.hpp"
 #include "Framework/AddressSpace.hpp"
@@ -25,7 +26,6 @@ std::string Cut(size_t n, std::string &line) {
 std::string Loader::LoadMotorolaSRecord(std::ifstream &file, int addressSpace) {
   Address address;
   int length;
-  Byte byte;
   std::string line;
 
   while (!file.eof() && file.good()) {
@@ -37,26 +37,21 @@ std::string Loader::LoadMotorolaSRecord(std::ifstream &file, int addressSpace) {
       return "ERROR: Incorrect file format!!!";
     }
     std::string line1 = Cut(1, line);
-    if (line1 == "1") {
+    if (line1 == "1" || line1 == "2" || line1 == "3") {
+      // S1, S2 and S3 records have two, three and four address bytes
+      int addressBytes = 2 + (line1[0] - '1');
       length = StringToInt(Cut(2, line));
-      address = StringToInt(Cut(4, line));
-      for (int k = 0; k < length - 3; ++k) {
-        byte = StringToInt(Cut(2, line));
-        myCPU.addressSpace(addressSpace).Poke(address + k, byte);
+      address = StringToInt(Cut(2 * addressBytes, line));
+      std::vector<Byte> data;
+      for (int k = 0; k < length - addressBytes - 1; ++k) {
+        data.push_back(StringToInt(Cut(2, line)));
       }
-    } else if (line1 == "2") {
-      length = StringToInt(Cut(2, line));
-      address = StringToInt(Cut(6, line));
-      for (int k = 0; k < length - 4; ++k) {
-        byte = StringToInt(Cut(2, line));
-        myCPU.addressSpace(addressSpace).Poke(address + k, byte);
-      }
-    } else if (line1 == "3") {
-      length = StringToInt(Cut(2, line));
-      address = StringToInt(Cut(8, line));
-      for (int k = 0; k < length - 5; ++k) {
-        byte = StringToInt(Cut(2, line));
-        myCPU.addressSpace(addressSpace).Poke(address + k, byte);
+
+      // Skip over any locations that aren't mapped
+      AddressSpace &space = myCPU.addressSpace(addressSpace);
+      for (size_t done = 0; done < data.size(); ++done) {
+        done += space.WriteBlock(address + done, &data[done],
+                                 data.size() - done);
       }
     } else if (line1 == "7" || line1 == "8" || line1 == "9") {
       break;
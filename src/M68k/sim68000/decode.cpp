@@ -1,28 +1,34 @@
 // Motorola 68000 instruction decoding.
 
+#include <algorithm>
+#include <string>
+
 #include "M68k/sim68000/m68000.hpp"
 
-// Table to decode 68000 opcodes.
-m68000::DecodeEntry m68000::ourDecodeTable[] = {
+// Tables to decode 68000 opcodes.
 #include "M68k/sim68000/DecodeTable.hpp"
-};
-
-// Used to cache opcodes once they've been decoded
-m68000::ExecutionPointer *m68000::ourDecodeCacheTable = nullptr;
 
-// Decode the given opcode
-m68000::ExecutionPointer m68000::DecodeInstruction(int opcode) {
-  // Check to see if this opcode needs to be decoded
-  if (ourDecodeCacheTable[opcode] == 0) {
-    // Decode the opcode using a linear search (slow :-{ )
-    for (size_t s = 0; s < (sizeof(ourDecodeTable) / sizeof(DecodeEntry)); ++s) {
-      if ((opcode & ourDecodeTable[s].mask) == ourDecodeTable[s].signature) {
-        ourDecodeCacheTable[opcode] = ourDecodeTable[s].execute;
-      }
-    }
-    // If not found then it's an invalid instruction
-    if (ourDecodeCacheTable[opcode] == 0)
-      ourDecodeCacheTable[opcode] = &m68000::ExecuteInvalid;
+// Answers true iff the instruction may change the flow of control
+bool m68000::EndsBlock(ExecutionPointer execute) {
+  static const ExecutionPointer branches[] = {
+      &m68000::ExecuteBRA,   &m68000::ExecuteBSR,     &m68000::ExecuteBcc,
+      &m68000::ExecuteDBcc,  &m68000::ExecuteJMP,     &m68000::ExecuteJSR,
+      &m68000::ExecuteRTE,   &m68000::ExecuteRTR,     &m68000::ExecuteRTS,
+      &m68000::ExecuteTRAP,  &m68000::ExecuteTRAPV,   &m68000::ExecuteCHK,
+      &m68000::ExecuteSTOP,  &m68000::ExecuteBREAK,   &m68000::ExecuteILLEGAL,
+      &m68000::ExecuteInvalid};
+  for (auto branch : branches) {
+    if (execute == branch)
+      return true;
   }
-  return ourDecodeCacheTable[opcode];
+  return false;
+}
+
+// Answers the number of bytes the instruction has after its opcode word,
+// which the disassembler works out
+size_t m68000::OperandLength(unsigned int opcode, Address pc) {
+  std::string mnemonic;
+  Address next = pc + 2;
+  (this->*DecodeInstruction(opcode).disassemble)(opcode, next, mnemonic);
+  return std::min<size_t>(Address(next - pc - 2), OPERAND_BYTES);
 }
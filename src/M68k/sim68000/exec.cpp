@@ -11,8 +11,7 @@
 
 // Compute the effective address, given the mode and register bits
 int m68000::ComputeEffectiveAddress(Address &address, int &in_register,
-                                    std::string &description, int mode_register,
-                                    int size, int trace) {
+                                    int mode_register, int size) {
   Register tmp;
   unsigned int extend_word;
   int status;
@@ -20,9 +19,6 @@ int m68000::ComputeEffectiveAddress(Address &address, int &in_register,
   switch (mode_register >> 3) {
   case 0: // Data Register Direct
     address = (mode_register & 0x7) + D0_INDEX;
-    if (trace) {
-      description += ourRegisterData[address].name;
-    }
     in_register = 1;
     return (EXECUTE_OK);
     break;
@@ -33,9 +29,6 @@ int m68000::ComputeEffectiveAddress(Address &address, int &in_register,
       address = SSP_INDEX;
     else
       address += A0_INDEX;
-    if (trace) {
-      description += ourRegisterData[address].name;
-    }
     in_register = 1;
     return (EXECUTE_OK);
     break;
@@ -47,11 +40,6 @@ int m68000::ComputeEffectiveAddress(Address &address, int &in_register,
     else
       tmp += A0_INDEX;
     address = register_value[tmp];
-    if (trace) {
-      description += "(";
-      description += ourRegisterData[tmp].name;
-      description += ")";
-    }
     in_register = 0;
     return (EXECUTE_OK);
     break;
@@ -80,11 +68,6 @@ int m68000::ComputeEffectiveAddress(Address &address, int &in_register,
       register_value[tmp] += 4;
       break;
     }
-    if (trace) {
-      description += "(";
-      description += ourRegisterData[tmp].name;
-      description += ")+";
-    }
     in_register = 0;
     return (EXECUTE_OK);
     break;
@@ -113,11 +96,6 @@ int m68000::ComputeEffectiveAddress(Address &address, int &in_register,
       break;
     }
     address = register_value[tmp];
-    if (trace) {
-      description += "-(";
-      description += ourRegisterData[tmp].name;
-      description += ")";
-    }
     in_register = 0;
     return (EXECUTE_OK);
     break;
@@ -139,13 +117,6 @@ int m68000::ComputeEffectiveAddress(Address &address, int &in_register,
     }
 
     address += SignExtend(extend_word, WORD);
-    if (trace) {
-      description += "($";
-      description += IntToString(extend_word, 4);
-      description += ",";
-      description += ourRegisterData[tmp].name;
-      description += ")";
-    }
     in_register = 0;
     return (EXECUTE_OK);
     break;
@@ -167,13 +138,6 @@ int m68000::ComputeEffectiveAddress(Address &address, int &in_register,
     }
 
     address += SignExtend(extend_word & 0xff, BYTE); // Add 8-bit displacement
-    if (trace) {
-      description += "$";
-      description += IntToString(extend_word & 0xff, 2);
-      description += "(";
-      description += ourRegisterData[tmp].name;
-      description += ",";
-    }
 
     if (extend_word & 0x8000) // Get register number
     {
@@ -191,13 +155,6 @@ int m68000::ComputeEffectiveAddress(Address &address, int &in_register,
     else
       address += SignExtend(register_value[tmp], WORD);
 
-    if (trace) {
-      description += ourRegisterData[tmp].name;
-      if (extend_word & 0x0800)
-        description += ".L)";
-      else
-        description += ".W)";
-    }
     in_register = 0;
     return (EXECUTE_OK);
     break;
@@ -213,10 +170,6 @@ int m68000::ComputeEffectiveAddress(Address &address, int &in_register,
         register_value[PC_INDEX] += 2;
       }
       address = SignExtend(extend_word, WORD);
-      if (trace) {
-        description += IntToString(extend_word, 4);
-        description += ".W";
-      }
       in_register = 0;
       return (EXECUTE_OK);
       break;
@@ -230,10 +183,6 @@ int m68000::ComputeEffectiveAddress(Address &address, int &in_register,
         register_value[PC_INDEX] += 4;
       }
       address = extend_word;
-      if (trace) {
-        description += IntToString(extend_word, 8);
-        description += ".L";
-      }
       in_register = 0;
       return (EXECUTE_OK);
       break;
@@ -248,11 +197,6 @@ int m68000::ComputeEffectiveAddress(Address &address, int &in_register,
         register_value[PC_INDEX] += 2;
       }
       address += SignExtend(extend_word, WORD);
-      if (trace) {
-        description += "($";
-        description += IntToString(extend_word, 4);
-        description += ",PC)";
-      }
       in_register = 0;
       return (EXECUTE_OK);
       break;
@@ -268,11 +212,6 @@ int m68000::ComputeEffectiveAddress(Address &address, int &in_register,
       }
 
       address += SignExtend(extend_word & 0xff, BYTE); // 8-bit displacement
-      if (trace) {
-        description += "$";
-        description += IntToString(extend_word & 0xff, 2);
-        description += "(PC,";
-      }
 
       if (extend_word & 0x8000) // Get register number
       {
@@ -290,13 +229,6 @@ int m68000::ComputeEffectiveAddress(Address &address, int &in_register,
       else
         address += SignExtend(register_value[tmp], WORD);
 
-      if (trace) {
-        description += ourRegisterData[tmp].name;
-        if (extend_word & 0x0800)
-          description += ".L)";
-        else
-          description += ".W)";
-      }
       in_register = 0;
       return (EXECUTE_OK);
       break;
@@ -312,19 +244,6 @@ int m68000::ComputeEffectiveAddress(Address &address, int &in_register,
       else
         register_value[PC_INDEX] += 4;
 
-      if (trace) {
-        // Fetch the immediate data
-        if ((status = Peek(address, extend_word, size)) != EXECUTE_OK)
-          return (status);
-
-        description += "#$";
-        if (size == BYTE)
-          description += IntToString(extend_word, 2);
-        else if (size == WORD)
-          description += IntToString(extend_word, 4);
-        else if (size == LONG)
-          description += IntToString(extend_word, 8);
-      }
       in_register = 0;
       return (EXECUTE_OK);
       break;
@@ -358,11 +277,16 @@ unsigned int m68000::SignExtend(unsigned int value, int size) {
 
 // Read a BYTE, WORD, or LONG from memory.
 int m68000::Peek(Address address, unsigned int &value, int size) {
-  unsigned char c1, c2, c3, c4;
+  AddressSpace &space = *myAddressSpaces[0];
+  unsigned long data;
+  unsigned char c1;
 
   switch (size) {
   case BYTE:
-    if (!myAddressSpaces[0]->Peek(address, c1)) {
+    if (PeekOperand(address, value, 1)) {
+      return EXECUTE_OK;
+    }
+    if (!space.Peek(address, c1)) {
       return EXECUTE_BUS_ERROR;
     }
     value = (unsigned int)c1;
@@ -372,27 +296,34 @@ int m68000::Peek(Address address, unsigned int &value, int size) {
     if ((address & 1) != 0) {
       return EXECUTE_ADDRESS_ERROR;
     }
-    if (!myAddressSpaces[0]->Peek(address, c1) ||
-        !myAddressSpaces[0]->Peek(address + 1, c2)) {
+    if (PeekOperand(address, value, 2)) {
+      return EXECUTE_OK;
+    }
+    if (const Byte *memory = space.FindReadMemory(address, 2)) {
+      value = (unsigned int)ReadBigEndian(memory, 2);
+      return EXECUTE_OK;
+    }
+    if (!space.Peek(address, data, WORD)) {
       return EXECUTE_BUS_ERROR;
     }
-    value = (((unsigned int)c1) << 8) | ((unsigned int)c2);
+    value = (unsigned int)data;
     return EXECUTE_OK;
 
   case LONG:
     if ((address & 1) != 0) {
       return EXECUTE_ADDRESS_ERROR;
     }
-    if (!myAddressSpaces[0]->Peek(address, c1) ||
-        !myAddressSpaces[0]->Peek(address + 1, c2) ||
-        !myAddressSpaces[0]->Peek(address + 2, c3) ||
-        !myAddressSpaces[0]->Peek(address + 3, c4)) {
+    if (PeekOperand(address, value, 4)) {
+      return EXECUTE_OK;
+    }
+    if (const Byte *memory = space.FindReadMemory(address, 4)) {
+      value = (unsigned int)ReadBigEndian(memory, 4);
+      return EXECUTE_OK;
+    }
+    if (!space.Peek(address, data, LONG)) {
       return EXECUTE_BUS_ERROR;
     }
-    value = ((unsigned int)c1 << 24) |
-            ((unsigned int)c2 << 16) |
-            ((unsigned int)c3 <<  8) |
-            ((unsigned int)c4 <<  0);
+    value = (unsigned int)data;
     return EXECUTE_OK;
   default:
     std::abort();
@@ -402,9 +333,11 @@ int m68000::Peek(Address address, unsigned int &value, int size) {
 
 // Write a BYTE, WORD, or LONG to memory.
 int m68000::Poke(Address address, unsigned int value, int size) {
+  AddressSpace &space = *myAddressSpaces[0];
+
   switch (size) {
   case BYTE:
-    if (!myAddressSpaces[0]->Poke(address, (unsigned char)value)) {
+    if (!space.Poke(address, (unsigned char)value)) {
       return EXECUTE_BUS_ERROR;
     }
     return EXECUTE_OK;
@@ -413,8 +346,11 @@ int m68000::Poke(Address address, unsigned int value, int size) {
     if ((address & 1) != 0) {
       return (EXECUTE_ADDRESS_ERROR);
     }
-    if (!myAddressSpaces[0]->Poke(address + 1, (unsigned char)value) ||
-        !myAddressSpaces[0]->Poke(address, (unsigned char)(value >> 8))) {
+    if (Byte *memory = space.FindWriteMemory(address, 2)) {
+      WriteBigEndian(memory, value, 2);
+      return EXECUTE_OK;
+    }
+    if (!space.Poke(address, value, WORD)) {
       return (EXECUTE_BUS_ERROR);
     }
     return (EXECUTE_OK);
@@ -423,10 +359,11 @@ int m68000::Poke(Address address, unsigned int value, int size) {
     if ((address & 1) != 0) {
       return (EXECUTE_ADDRESS_ERROR);
     }
-    if (!myAddressSpaces[0]->Poke(address + 3, (unsigned char)(value >>  0)) ||
-        !myAddressSpaces[0]->Poke(address + 2, (unsigned char)(value >>  8)) ||
-        !myAddressSpaces[0]->Poke(address + 1, (unsigned char)(value >> 16)) ||
-        !myAddressSpaces[0]->Poke(address + 0, (unsigned char)(value >> 24))) {
+    if (Byte *memory = space.FindWriteMemory(address, 4)) {
+      WriteBigEndian(memory, value, 4);
+      return EXECUTE_OK;
+    }
+    if (!space.Poke(address, value, LONG)) {
       return EXECUTE_BUS_ERROR;
     }
     return EXECUTE_OK;
@@ -435,6 +372,8 @@ int m68000::Poke(Address address, unsigned int value, int size) {
 
 // Clear the condition codes in the status register given by the mask
 void m68000::ClearConditionCodes(int mask) {
+  EvaluateConditionCodes();
+
   if (mask & C_FLAG)
     register_value[SR_INDEX] &= ~C_FLAG;
   else if (mask & V_FLAG)
@@ -451,10 +390,24 @@ void m68000::ClearConditionCodes(int mask) {
     register_value[SR_INDEX] &= ~S_FLAG;
 }
 
-// Set the condition codes in the status register
+// Record the operation so its condition codes can be computed lazily.  Any
+// flags of the previous operation that this one doesn't set are computed now.
 void m68000::SetConditionCodes(unsigned int src, unsigned int dest,
                                unsigned int result, int size, int operation,
                                int mask) {
+  const PendingConditionCodes &p = myPendingConditionCodes;
+  const int stale = p.mask & ~mask;
+
+  if (stale)
+    ComputeConditionCodes(p.src, p.dest, p.result, p.size, p.operation, stale);
+
+  myPendingConditionCodes = {src, dest, result, size, operation, mask};
+}
+
+// Set the condition codes in the status register
+void m68000::ComputeConditionCodes(unsigned int src, unsigned int dest,
+                                   unsigned int result, int size, int operation,
+                                   int mask) {
   int S, D, R;
 
   switch (size) {
@@ -562,95 +515,64 @@ void m68000::SetRegister(int register_number, unsigned int value, int size) {
 }
 
 // Checks the condition codes to see if a branch should occur
-int m68000::CheckConditionCodes(int code, std::string &mnemonic, int trace) {
+int m68000::CheckConditionCodes(int code) {
   int branch = 0;
   Register sr;
 
+  EvaluateConditionCodes();
   sr = register_value[SR_INDEX];
   switch (code) {
   case 4:
     branch = !(sr & C_FLAG);
-    if (trace)
-      mnemonic += "CC";
     break;
   case 5:
     branch = (sr & C_FLAG);
-    if (trace)
-      mnemonic += "CS";
     break;
   case 7:
     branch = (sr & Z_FLAG);
-    if (trace)
-      mnemonic += "EQ";
     break;
   case 1:
     branch = 0;
-    if (trace)
-      mnemonic += "F";
     break;
   case 12:
     branch =
         ((sr & N_FLAG) && (sr & V_FLAG)) || (!(sr & N_FLAG) && !(sr & V_FLAG));
-    if (trace)
-      mnemonic += "GE";
     break;
   case 14:
     branch = ((sr & N_FLAG) && (sr & V_FLAG) && !(sr & Z_FLAG)) ||
              (!(sr & N_FLAG) && !(sr & V_FLAG) && !(sr & Z_FLAG));
-    if (trace)
-      mnemonic += "GT";
     break;
   case 2:
     branch = (!(sr & C_FLAG) && !(sr & Z_FLAG));
-    if (trace)
-      mnemonic += "HI";
     break;
   case 15:
     branch = (sr & Z_FLAG) || ((sr & N_FLAG) && !(sr & V_FLAG)) ||
              (!(sr & N_FLAG) && (sr & V_FLAG));
-    if (trace)
-      mnemonic += "LE";
     break;
   case 3:
     branch = (sr & C_FLAG) || (sr & Z_FLAG);
-    if (trace)
-      mnemonic += "LS";
     break;
   case 13:
     branch =
         ((sr & N_FLAG) && !(sr & V_FLAG)) || (!(sr & N_FLAG) && (sr & V_FLAG));
-    if (trace)
-      mnemonic += "LT";
     break;
   case 11:
     branch = (sr & N_FLAG);
-    if (trace)
-      mnemonic += "MI";
     break;
   case 6:
     branch = !(sr & Z_FLAG);
-    if (trace)
-      mnemonic += "NE";
     break;
   case 10:
     branch = !(sr & N_FLAG);
-    if (trace)
-      mnemonic += "PL";
     break;
   case 0:
     branch = 1;
-    if (trace)
-      mnemonic += "T";
     break;
   case 8:
     branch = !(sr & V_FLAG);
-    if (trace)
-      mnemonic += "VC";
     break;
   case 9:
     branch = (sr & V_FLAG);
-    if (trace)
-      mnemonic += "VS";
     break;
   }
   return (branch);
@@ -658,36 +580,25 @@ int m68000::CheckConditionCodes(int code, std::string &mnemonic, int trace) {
 
 // Execute the 'ABCD' instruction
 // This Function is made out of the 'addx' Function !!
-int m68000::ExecuteABCD(int opcode, std::string &trace_record, int trace) {
+int m68000::ExecuteABCD(int opcode) {
   int status, size, in_register_flag;
   Address src_address, dest_address;
   unsigned int result, src, dest, zw_resultat, zw_uebertrag; // T_M change
-  std::string mnemonic;
 
+  EvaluateConditionCodes();
   size = (opcode & 0x00c0) >> 6;
 
-  if (trace) {
-    mnemonic += "{Mnemonic {ABCD";
-    if (size == BYTE)
-      mnemonic += ".B ";
-    else
-      return (ExecuteInvalid(opcode, trace_record, trace));
-  }
-
   // Get the addresses
   if (opcode & 8) {
     if ((status = ComputeEffectiveAddress(src_address, in_register_flag,
-                                          mnemonic, 0x20 | (opcode & 7), size,
-                                          trace)) != EXECUTE_OK) {
+                                          0x20 | (opcode & 7), size)) !=
+        EXECUTE_OK) {
       return (status);
     }
 
-    if (trace)
-      mnemonic += ",";
-
-    if ((status = ComputeEffectiveAddress(
-             dest_address, in_register_flag, mnemonic,
-             0x20 | ((opcode & 0x0e00) >> 9), size, trace)) != EXECUTE_OK) {
+    if ((status = ComputeEffectiveAddress(dest_address, in_register_flag,
+                                          0x20 | ((opcode & 0x0e00) >> 9),
+                                          size)) != EXECUTE_OK) {
       return (status);
     }
 
@@ -700,11 +611,6 @@ int m68000::ExecuteABCD(int opcode, std::string &trace_record, int trace) {
     src = register_value[src_address];
     dest_address = D0_INDEX + ((opcode & 0x0e00) >> 9);
     dest = register_value[dest_address];
-    if (trace) {
-      mnemonic += ourRegisterData[src_address].name;
-      mnemonic += ",";
-      mnemonic += ourRegisterData[dest_address].name;
-    }
   }
 
   if (register_value[SR_INDEX] & X_FLAG)
@@ -735,8 +641,8 @@ int m68000::ExecuteABCD(int opcode, std::string &trace_record, int trace) {
   // only BYTE data !!
   result = result & 0xff;
 
-  SetConditionCodes(src, dest, result, size, ADDITION,
-                    C_FLAG | V_FLAG | N_FLAG | X_FLAG);
+  ComputeConditionCodes(src, dest, result, size, ADDITION,
+                        C_FLAG | V_FLAG | N_FLAG | X_FLAG);
   if (result)
     register_value[SR_INDEX] &= ~Z_FLAG;
 
@@ -747,26 +653,20 @@ int m68000::ExecuteABCD(int opcode, std::string &trace_record, int trace) {
     SetRegister(dest_address, result, size);
   }
 
-  if (trace) {
-    mnemonic += "}} ";
-    trace_record += mnemonic;
-  }
   return (EXECUTE_OK);
 }
 
 // Execute the 'ADD' instruction
-int m68000::ExecuteADD(int opcode, std::string &trace_record, int trace) {
+int m68000::ExecuteADD(int opcode) {
   int status, size, in_register_flag;
   Address ea_address, register_number;
   unsigned int result, ea_data;
-  std::string mnemonic, ea_description;
 
   size = (opcode & 0x00c0) >> 6;
 
   // Get the <ea> data address
-  if ((status =
-           ComputeEffectiveAddress(ea_address, in_register_flag, ea_description,
-                                   opcode & 0x3f, size, trace)) != EXECUTE_OK) {
+  if ((status = ComputeEffectiveAddress(ea_address, in_register_flag,
+                                        opcode & 0x3f, size)) != EXECUTE_OK) {
     return (status);
   }
 
@@ -779,23 +679,8 @@ int m68000::ExecuteADD(int opcode, std::string &trace_record, int trace) {
   // Get the register number
   register_number = D0_INDEX + ((opcode & 0x0e00) >> 9);
 
-  if (trace) {
-    mnemonic += "{Mnemonic {ADD";
-    if (size == BYTE)
-      mnemonic += ".B ";
-    else if (size == WORD)
-      mnemonic += ".W ";
-    else if (size == LONG)
-      mnemonic += ".L ";
-  }
-
   if (opcode & 0x0100) // <Dn> + <ea> -> <ea>
   {
-    if (trace) {
-      mnemonic += ourRegisterData[register_number].name;
-      mnemonic += ",";
-      mnemonic += ea_description;
-    }
     result = register_value[register_number] + ea_data;
     SetConditionCodes(register_value[register_number], ea_data, result, size,
                       ADDITION, C_FLAG | V_FLAG | Z_FLAG | N_FLAG | X_FLAG);
@@ -803,30 +688,20 @@ int m68000::ExecuteADD(int opcode, std::string &trace_record, int trace) {
       return (status);
   } else // <ea> + <Dn> -> <Dn>
   {
-    if (trace) {
-      mnemonic += ea_description;
-      mnemonic += ",";
-      mnemonic += ourRegisterData[register_number].name;
-    }
     result = ea_data + register_value[register_number];
     SetConditionCodes(ea_data, register_value[register_number], result, size,
                       ADDITION, C_FLAG | V_FLAG | Z_FLAG | N_FLAG | X_FLAG);
     SetRegister(register_number, result, size);
   }
 
-  if (trace) {
-    mnemonic += "}} ";
-    trace_record += mnemonic;
-  }
   return (EXECUTE_OK);
 }
 
 // Execute the 'ADDA' instruction
-int m68000::ExecuteADDA(int opcode, std::string &trace_record, int trace) {
+int m68000::ExecuteADDA(int opcode) {
   int status, size, in_register_flag;
   Address ea_address, register_number;
   unsigned int result, ea_data;
-  std::string mnemonic, ea_description;
 
   if (opcode & 0x0100)
     size = LONG;
@@ -834,9 +709,8 @@ int m68000::ExecuteADDA(int opcode, std::string &trace_record, int trace) {
     size = WORD;
 
   // Get the <ea> data address
-  if ((status =
-           ComputeEffectiveAddress(ea_address, in_register_flag, ea_description,
-                                   opcode & 0x3f, size, trace)) != EXECUTE_OK) {
+  if ((status = ComputeEffectiveAddress(ea_address, in_register_flag,
+                                        opcode & 0x3f, size)) != EXECUTE_OK) {
     return (status);
   }
 
@@ -859,44 +733,20 @@ int m68000::ExecuteADDA(int opcode, std::string &trace_record, int trace) {
   result = ea_data + register_value[register_number];
   SetRegister(register_number, result, LONG);
 
-  if (trace) {
-    mnemonic += "{Mnemonic {ADDA";
-    if (size == WORD)
-      mnemonic += ".W ";
-    else if (size == LONG)
-      mnemonic += ".L ";
-
-    mnemonic += ea_description;
-    mnemonic += ",";
-    mnemonic += ourRegisterData[register_number].name;
-    mnemonic += "}} ";
-    trace_record += mnemonic;
-  }
   return (EXECUTE_OK);
 }
 
 // Execute the 'ADDI' instruction
-int m68000::ExecuteADDI(int opcode, std::string &trace_record, int trace) {
+int m68000::ExecuteADDI(int opcode) {
   int status, size, in_register;
   Address dest_addr, src_addr;
   unsigned int result, src, dest;
-  std::string mnemonic;
 
   size = (opcode & 0x00c0) >> 6;
 
-  if (trace) {
-    mnemonic += "{Mnemonic {ADDI";
-    if (size == BYTE)
-      mnemonic += ".B ";
-    else if (size == WORD)
-      mnemonic += ".W ";
-    else if (size == LONG)
-      mnemonic += ".L ";
-  }
-
   // Get the immediate data pointer
-  if ((status = ComputeEffectiveAddress(src_addr, in_register, mnemonic, 0x3c,
-                                        size, trace)) != EXECUTE_OK) {
+  if ((status = ComputeEffectiveAddress(src_addr, in_register, 0x3c, size)) !=
+      EXECUTE_OK) {
     return (status);
   }
 
@@ -904,13 +754,9 @@ int m68000::ExecuteADDI(int opcode, std::string &trace_record, int trace) {
   if ((status = Peek(src_addr, src, size)) != EXECUTE_OK)
     return (status);
 
-  if (trace)
-    mnemonic += ",";
-
   // Get the destination data pointer
-  if ((status = ComputeEffectiveAddress(dest_addr, in_register, mnemonic,
-                                        opcode & 0x3f, size, trace)) !=
-      EXECUTE_OK) {
+  if ((status = ComputeEffectiveAddress(dest_addr, in_register, opcode & 0x3f,
+                                        size)) != EXECUTE_OK) {
     return (status);
   }
 
@@ -930,19 +776,14 @@ int m68000::ExecuteADDI(int opcode, std::string &trace_record, int trace) {
       return (status);
   }
 
-  if (trace) {
-    mnemonic += "}} ";
-    trace_record += mnemonic;
-  }
   return (EXECUTE_OK);
 }
 
 // Execute the 'ADDQ' instruction
-int m68000::ExecuteADDQ(int opcode, std::string &trace_record, int trace) {
+int m68000::ExecuteADDQ(int opcode) {
   int status, size, in_register_flag;
   Address ea_address, immediate_data;
   unsigned int result, ea_data;
-  std::string ea_description;
 
   size = (opcode & 0x00c0) >> 6;
 
@@ -951,9 +792,8 @@ int m68000::ExecuteADDQ(int opcode, std::string &trace_record, int trace) {
     immediate_data = 8;
 
   // Get the <ea> data address
-  if ((status =
-           ComputeEffectiveAddress(ea_address, in_register_flag, ea_description,
-                                   opcode & 0x3f, size, trace)) != EXECUTE_OK) {
+  if ((status = ComputeEffectiveAddress(ea_address, in_register_flag,
+                                        opcode & 0x3f, size)) != EXECUTE_OK) {
     return (status);
   }
 
@@ -980,56 +820,29 @@ int m68000::ExecuteADDQ(int opcode, std::string &trace_record, int trace) {
       return (status);
   }
 
-  if (trace) {
-    trace_record += "{Mnemonic {ADDQ";
-    if (size == BYTE)
-      trace_record += ".B ";
-    else if (size == WORD)
-      trace_record += ".W ";
-    else if (size == LONG)
-      trace_record += ".L ";
-    trace_record += "#$";
-    trace_record += IntToString(immediate_data, 1);
-    trace_record += ",";
-    trace_record += ea_description;
-    trace_record += "}} ";
-  }
   return (EXECUTE_OK);
 }
 
 // Execute the 'ADDX' instruction
-int m68000::ExecuteADDX(int opcode, std::string &trace_record, int trace) {
+int m68000::ExecuteADDX(int opcode) {
   int status, size, in_register_flag;
   Address src_address, dest_address;
   unsigned int result, src, dest;
-  std::string mnemonic;
 
+  EvaluateConditionCodes();
   size = (opcode & 0x00c0) >> 6;
 
-  if (trace) {
-    mnemonic += "{Mnemonic {ADDX";
-    if (size == BYTE)
-      mnemonic += ".B ";
-    else if (size == WORD)
-      mnemonic += ".W ";
-    else if (size == LONG)
-      mnemonic += ".L ";
-  }
-
   // Get the addresses
   if (opcode & 8) {
     if ((status = ComputeEffectiveAddress(src_address, in_register_flag,
-                                          mnemonic, 0x20 | (opcode & 7), size,
-                                          trace)) != EXECUTE_OK) {
+                                          0x20 | (opcode & 7), size)) !=
+        EXECUTE_OK) {
       return (status);
     }
 
-    if (trace)
-      mnemonic += ",";
-
-    if ((status = ComputeEffectiveAddress(
-             dest_address, in_register_flag, mnemonic,
-             0x20 | ((opcode & 0x0e00) >> 9), size, trace)) != EXECUTE_OK) {
+    if ((status = ComputeEffectiveAddress(dest_address, in_register_flag,
+                                          0x20 | ((opcode & 0x0e00) >> 9),
+                                          size)) != EXECUTE_OK) {
       return (status);
     }
 
@@ -1042,11 +855,6 @@ int m68000::ExecuteADDX(int opcode, std::string &trace_record, int trace) {
     src = register_value[src_address];
     dest_address = D0_INDEX + ((opcode & 0x0e00) >> 9);
     dest = register_value[dest_address];
-    if (trace) {
-      mnemonic += ourRegisterData[src_address].name;
-      mnemonic += ",";
-      mnemonic += ourRegisterData[dest_address].name;
-    }
   }
 
   if (register_value[SR_INDEX] & X_FLAG)
@@ -1061,8 +869,8 @@ int m68000::ExecuteADDX(int opcode, std::string &trace_record, int trace) {
   else if (size == LONG)
     result = result & 0xffffffff;
 
-  SetConditionCodes(src, dest, result, size, ADDITION,
-                    C_FLAG | V_FLAG | N_FLAG | X_FLAG);
+  ComputeConditionCodes(src, dest, result, size, ADDITION,
+                        C_FLAG | V_FLAG | N_FLAG | X_FLAG);
   if (result)
     register_value[SR_INDEX] &= ~Z_FLAG;
 
@@ -1073,26 +881,20 @@ int m68000::ExecuteADDX(int opcode, std::string &trace_record, int trace) {
     SetRegister(dest_address, result, size);
   }
 
-  if (trace) {
-    mnemonic += "}} ";
-    trace_record += mnemonic;
-  }
   return (EXECUTE_OK);
 }
 
 // Execute the 'AND' instruction
-int m68000::ExecuteAND(int opcode, std::string &trace_record, int trace) {
+int m68000::ExecuteAND(int opcode) {
   int status, size, in_register_flag;
   Address ea_address, register_number;
   unsigned int result, ea_data;
-  std::string mnemonic, ea_description;
 
   size = (opcode & 0x00c0) >> 6;
 
   // Get the <ea> data address
-  if ((status =
-           ComputeEffectiveAddress(ea_address, in_register_flag, ea_description,
-                                   opcode & 0x3f, size, trace)) != EXECUTE_OK) {
+  if ((status = ComputeEffectiveAddress(ea_address, in_register_flag,
+                                        opcode & 0x3f, size)) != EXECUTE_OK) {
     return (status);
   }
 
@@ -1105,23 +907,8 @@ int m68000::ExecuteAND(int opcode, std::string &trace_record, int trace) {
   // Get the register number
   register_number = D0_INDEX + ((opcode & 0x0e00) >> 9);
 
-  if (trace) {
-    mnemonic += "{Mnemonic {AND";
-    if (size == BYTE)
-      mnemonic += ".B ";
-    else if (size == WORD)
-      mnemonic += ".W ";
-    else if (size == LONG)
-      mnemonic += ".L ";
-  }
-
   if (opcode & 0x0100) // <Dn> & <ea> -> <ea>
   {
-    if (trace) {
-      mnemonic += ourRegisterData[register_number].name;
-      mnemonic += ",";
-      mnemonic += ea_description;
-    }
     result = register_value[register_number] & ea_data;
     SetConditionCodes(register_value[register_number], ea_data, result, size,
                       OTHER, V_FLAG | C_FLAG | Z_FLAG | N_FLAG);
@@ -1129,46 +916,26 @@ int m68000::ExecuteAND(int opcode, std::string &trace_record, int trace) {
       return (status);
   } else // <ea> & <Dn> -> <Dn>
   {
-    if (trace) {
-      mnemonic += ea_description;
-      mnemonic += ",";
-      mnemonic += ourRegisterData[register_number].name;
-    }
     result = ea_data & register_value[register_number];
     SetConditionCodes(ea_data, register_value[register_number], result, size,
                       OTHER, V_FLAG | C_FLAG | Z_FLAG | N_FLAG);
     SetRegister(register_number, result, size);
   }
 
-  if (trace) {
-    mnemonic += "}} ";
-    trace_record += mnemonic;
-  }
   return (EXECUTE_OK);
 }
 
 // Execute the 'ANDI' instruction
-int m68000::ExecuteANDI(int opcode, std::string &trace_record, int trace) {
+int m68000::ExecuteANDI(int opcode) {
   int status, size, in_register;
   Address dest_addr, src_addr;
   unsigned int result, src, dest;
-  std::string mnemonic;
 
   size = (opcode & 0x00c0) >> 6;
 
-  if (trace) {
-    mnemonic += "{Mnemonic {ANDI";
-    if (size == BYTE)
-      mnemonic += ".B ";
-    else if (size == WORD)
-      mnemonic += ".W ";
-    else if (size == LONG)
-      mnemonic += ".L ";
-  }
-
   // Get the immediate data pointer
-  if ((status = ComputeEffectiveAddress(src_addr, in_register, mnemonic, 0x3c,
-                                        size, trace)) != EXECUTE_OK) {
+  if ((status = ComputeEffectiveAddress(src_addr, in_register, 0x3c, size)) !=
+      EXECUTE_OK) {
     return (status);
   }
 
@@ -1176,13 +943,9 @@ int m68000::ExecuteANDI(int opcode, std::string &trace_record, int trace) {
   if ((status = Peek(src_addr, src, size)) != EXECUTE_OK)
     return (status);
 
-  if (trace)
-    mnemonic += ",";
-
   // Get the destination data pointer
-  if ((status = ComputeEffectiveAddress(dest_addr, in_register, mnemonic,
-                                        opcode & 0x3f, size, trace)) !=
-      EXECUTE_OK) {
+  if ((status = ComputeEffectiveAddress(dest_addr, in_register, opcode & 0x3f,
+                                        size)) != EXECUTE_OK) {
     return (status);
   }
 
@@ -1202,28 +965,21 @@ int m68000::ExecuteANDI(int opcode, std::string &trace_record, int trace) {
       return (status);
   }
 
-  if (trace) {
-    mnemonic += "}} ";
-    trace_record += mnemonic;
-  }
   return (EXECUTE_OK);
 }
 
 // Execute the 'ANDItoCCR' instruction
-int m68000::ExecuteANDItoCCR(int, std::string &trace_record, int trace) {
+int m68000::ExecuteANDItoCCR(int) {
   int status, size, in_register_flag;
   Address src_addr;
   unsigned int src;
-  std::string mnemonic;
 
+  EvaluateConditionCodes();
   size = BYTE;
 
-  if (trace)
-    mnemonic += "{Mnemonic {ANDI.B ";
-
   // Get the immediate data pointer
-  if ((status = ComputeEffectiveAddress(src_addr, in_register_flag, mnemonic,
-                                        0x3c, size, trace)) != EXECUTE_OK) {
+  if ((status = ComputeEffectiveAddress(src_addr, in_register_flag, 0x3c,
+                                        size)) != EXECUTE_OK) {
     return (status);
   }
 
@@ -1232,39 +988,31 @@ int m68000::ExecuteANDItoCCR(int, std::string &trace_record, int trace) {
     return (status);
 
   SetRegister(SR_INDEX, (register_value[SR_INDEX] & src), BYTE);
-  if (trace) {
-    mnemonic += ",CCR}} ";
-    trace_record += mnemonic;
-  }
   return (EXECUTE_OK);
 }
 
 // Execute the 'ANDItoSR' instruction
-int m68000::ExecuteANDItoSR(int, std::string &trace_record, int trace) {
+int m68000::ExecuteANDItoSR(int) {
   int status, size, in_register_flag;
   Address src_addr;
   unsigned int src;
-  std::string mnemonic;
+
+  EvaluateConditionCodes();
 
   // Make sure we're in supervisor mode or trap
   if (!(register_value[SR_INDEX] & S_FLAG)) {
     SetRegister(PC_INDEX, register_value[PC_INDEX] - 2, LONG);
     if ((status = ProcessException(8)) != EXECUTE_OK)
       return (status);
-    if (trace)
-      ;
-    trace_record += "{Mnemonic {Privilege Violation Exception}} ";
+    myExceptionMnemonic = "Privilege Violation Exception";
     return (EXECUTE_PRIVILEGED_OK);
   }
 
   size = WORD;
 
-  if (trace)
-    mnemonic += "{Mnemonic {ANDI.W ";
-
   // Get the immediate data pointer
-  if ((status = ComputeEffectiveAddress(src_addr, in_register_flag, mnemonic,
-                                        0x3c, size, trace)) != EXECUTE_OK) {
+  if ((status = ComputeEffectiveAddress(src_addr, in_register_flag, 0x3c,
+                                        size)) != EXECUTE_OK) {
     return (status);
   }
 
@@ -1274,20 +1022,16 @@ int m68000::ExecuteANDItoSR(int, std::string &trace_record, int trace) {
 
   SetRegister(SR_INDEX, register_value[SR_INDEX] & src, WORD);
 
-  if (trace) {
-    mnemonic += ",SR}} ";
-    trace_record += mnemonic;
-  }
   return (EXECUTE_PRIVILEGED_OK);
 }
 
 // Execute the 'ASL' instruction
-int m68000::ExecuteASL(int opcode, std::string &trace_record, int trace) {
+int m68000::ExecuteASL(int opcode) {
   int status, size, in_register_flag, shift_count;
   Address address;
   unsigned int data;
-  std::string ea_description;
 
+  EvaluateConditionCodes();
   size = (opcode & 0x00c0) >> 6;
 
   // Check to see if this is a memory or register shift
@@ -1296,8 +1040,7 @@ int m68000::ExecuteASL(int opcode, std::string &trace_record, int trace) {
 
     // Get the address
     if ((status = ComputeEffectiveAddress(address, in_register_flag,
-                                          ea_description, opcode & 0x3f, size,
-                                          trace)) != EXECUTE_OK) {
+                                          opcode & 0x3f, size)) != EXECUTE_OK) {
       return (status);
     }
 
@@ -1312,8 +1055,8 @@ int m68000::ExecuteASL(int opcode, std::string &trace_record, int trace) {
     if ((status = Poke(address, data, size)) != EXECUTE_OK)
       return (status);
 
-    SetConditionCodes(0, 0, data, size, OTHER,
-                      N_FLAG | Z_FLAG | X_FLAG | C_FLAG | V_FLAG);
+    ComputeConditionCodes(0, 0, data, size, OTHER,
+                          N_FLAG | Z_FLAG | X_FLAG | C_FLAG | V_FLAG);
     if (data & 0x00010000) {
       register_value[SR_INDEX] |= C_FLAG;
       register_value[SR_INDEX] |= X_FLAG;
@@ -1325,23 +1068,11 @@ int m68000::ExecuteASL(int opcode, std::string &trace_record, int trace) {
     // Compute the shift count
     if (opcode & 32) {
       shift_count = register_value[D0_INDEX + ((opcode & 0x0e00) >> 9)] & 0x3f;
-      if (trace)
-        ea_description =
-            ourRegisterData[D0_INDEX + ((opcode & 0x0e00) >> 9)].name;
     } else {
       if ((shift_count = (opcode & 0x0e00) >> 9) == 0)
         shift_count = 8;
-
-      if (trace) {
-        ea_description = "#$";
-        ea_description += IntToString(shift_count, 1);
-      }
-    }
-
-    if (trace) {
-      ea_description += ",";
-      ea_description += ourRegisterData[D0_INDEX + (opcode & 7)].name;
     }
+    myCycles += 2 * shift_count;
 
     unsigned int carry = 0, overflow = 0;
     unsigned int carry_mask, overflow_mask;
@@ -1371,8 +1102,8 @@ int m68000::ExecuteASL(int opcode, std::string &trace_record, int trace) {
 
     SetRegister(D0_INDEX + (opcode & 7), data, size);
 
-    SetConditionCodes(0, 0, data, size, OTHER,
-                      N_FLAG | Z_FLAG | X_FLAG | C_FLAG | V_FLAG);
+    ComputeConditionCodes(0, 0, data, size, OTHER,
+                          N_FLAG | Z_FLAG | X_FLAG | C_FLAG | V_FLAG);
     if (overflow)
       register_value[SR_INDEX] |= V_FLAG;
     if (carry) {
@@ -1381,27 +1112,16 @@ int m68000::ExecuteASL(int opcode, std::string &trace_record, int trace) {
     }
   }
 
-  if (trace) {
-    trace_record += "{Mnemonic {ASL";
-    if (size == BYTE)
-      trace_record += ".B ";
-    else if (size == WORD)
-      trace_record += ".W ";
-    else if (size == LONG)
-      trace_record += ".L ";
-    trace_record += ea_description;
-    trace_record += "}} ";
-  }
   return (EXECUTE_OK);
 }
 
 // Execute the 'ASR' instruction
-int m68000::ExecuteASR(int opcode, std::string &trace_record, int trace) {
+int m68000::ExecuteASR(int opcode) {
   int status, size, in_register_flag, shift_count;
   Address address;
   unsigned int data;
-  std::string ea_description;
 
+  EvaluateConditionCodes();
   size = (opcode & 0x00c0) >> 6;
 
   // Check to see if this is a memory or register shift
@@ -1410,8 +1130,7 @@ int m68000::ExecuteASR(int opcode, std::string &trace_record, int trace) {
 
     // Get the address
     if ((status = ComputeEffectiveAddress(address, in_register_flag,
-                                          ea_description, opcode & 0x3f, size,
-                                          trace)) != EXECUTE_OK) {
+                                          opcode & 0x3f, size)) != EXECUTE_OK) {
       return (status);
     }
 
@@ -1420,8 +1139,8 @@ int m68000::ExecuteASR(int opcode, std::string &trace_record, int trace) {
       return (status);
 
     // Set the condition codes
-    SetConditionCodes(0, 0, data >> 1, size, OTHER,
-                      N_FLAG | Z_FLAG | X_FLAG | C_FLAG | V_FLAG);
+    ComputeConditionCodes(0, 0, data >> 1, size, OTHER,
+                          N_FLAG | Z_FLAG | X_FLAG | C_FLAG | V_FLAG);
     if (data & 0x0001) {
       register_value[SR_INDEX] |= C_FLAG;
       register_value[SR_INDEX] |= X_FLAG;
@@ -1443,23 +1162,11 @@ int m68000::ExecuteASR(int opcode, std::string &trace_record, int trace) {
     // Compute the shift count
     if (opcode & 32) {
       shift_count = register_value[D0_INDEX + ((opcode & 0x0e00) >> 9)] & 0x3f;
-      if (trace)
-        ea_description =
-            ourRegisterData[D0_INDEX + ((opcode & 0x0e00) >> 9)].name;
     } else {
       if ((shift_count = (opcode & 0x0e00) >> 9) == 0)
         shift_count = 8;
-
-      if (trace) {
-        ea_description = "#$";
-        ea_description += IntToString(shift_count, 1);
-      }
-    }
-
-    if (trace) {
-      ea_description += ",";
-      ea_description += ourRegisterData[D0_INDEX + (opcode & 7)].name;
     }
+    myCycles += 2 * shift_count;
 
     unsigned int carry = 0, replicate_mask, msb;
 
@@ -1490,48 +1197,35 @@ int m68000::ExecuteASR(int opcode, std::string &trace_record, int trace) {
 
     SetRegister(D0_INDEX + (opcode & 7), data, size);
 
-    SetConditionCodes(0, 0, data, size, OTHER,
-                      N_FLAG | Z_FLAG | X_FLAG | C_FLAG | V_FLAG);
+    ComputeConditionCodes(0, 0, data, size, OTHER,
+                          N_FLAG | Z_FLAG | X_FLAG | C_FLAG | V_FLAG);
     if (carry) {
       register_value[SR_INDEX] |= C_FLAG;
       register_value[SR_INDEX] |= X_FLAG;
     }
   }
 
-  if (trace) {
-    trace_record += "{Mnemonic {ASR";
-    if (size == BYTE)
-      trace_record += ".B ";
-    else if (size == WORD)
-      trace_record += ".W ";
-    else if (size == LONG)
-      trace_record += ".L ";
-    trace_record += ea_description;
-    trace_record += "}} ";
-  }
   return (EXECUTE_OK);
 }
 
 // Execute the 'Bit' instructions (BCHG, BCLR, BSET, & BTST)
-int m68000::ExecuteBit(int opcode, std::string &trace_record, int trace) {
+int m68000::ExecuteBit(int opcode) {
   int status, size, in_register_flag;
   Address ea_address, register_number;
   unsigned int ea_data, bit_number;
-  std::string mnemonic, ea_description;
+
+  EvaluateConditionCodes();
 
   // Get the bit number we're supposed to be checking
   if (opcode & 256) {
     register_number = D0_INDEX + ((opcode & 0x0e00) >> 9);
     bit_number = register_value[register_number];
-    if (trace)
-      ea_description = ourRegisterData[register_number].name;
   } else {
     Address address;
 
     // Get the immediate data pointer
-    if ((status = ComputeEffectiveAddress(address, in_register_flag,
-                                          ea_description, 0x3c, WORD, trace)) !=
-        EXECUTE_OK) {
+    if ((status = ComputeEffectiveAddress(address, in_register_flag, 0x3c,
+                                          WORD)) != EXECUTE_OK) {
       return (status);
     }
 
@@ -1540,9 +1234,6 @@ int m68000::ExecuteBit(int opcode, std::string &trace_record, int trace) {
       return (status);
   }
 
-  if (trace)
-    ea_description += ",";
-
   // Determine the size of the operation (BYTE or LONG)
   if ((opcode & 0x38) == 0)
     size = LONG;
@@ -1550,9 +1241,8 @@ int m68000::ExecuteBit(int opcode, std::string &trace_record, int trace) {
     size = BYTE;
 
   // Get the <ea> data address
-  if ((status =
-           ComputeEffectiveAddress(ea_address, in_register_flag, ea_description,
-                                   opcode & 0x3f, size, trace)) != EXECUTE_OK) {
+  if ((status = ComputeEffectiveAddress(ea_address, in_register_flag,
+                                        opcode & 0x3f, size)) != EXECUTE_OK) {
     return (status);
   }
 
@@ -1574,13 +1264,9 @@ int m68000::ExecuteBit(int opcode, std::string &trace_record, int trace) {
 
   switch ((opcode & 0x00c0) >> 6) {
   case 0: // BTST
-    if (trace)
-      mnemonic += "{Mnemonic {BTST";
     break;
 
   case 1: // BCHG
-    if (trace)
-      mnemonic += "{Mnemonic {BCHG";
     if (ea_data & bit_number)
       ea_data &= ~bit_number;
     else
@@ -1588,14 +1274,10 @@ int m68000::ExecuteBit(int opcode, std::string &trace_record, int trace) {
     break;
 
   case 2: // BCLR
-    if (trace)
-      mnemonic += "{Mnemonic {BCLR";
     ea_data &= ~bit_number;
     break;
 
   case 3: // BSET
-    if (trace)
-      mnemonic += "{Mnemonic {BSET";
     ea_data |= bit_number;
     break;
   }
@@ -1608,26 +1290,13 @@ int m68000::ExecuteBit(int opcode, std::string &trace_record, int trace) {
       return (status);
   }
 
-  if (trace) {
-    if (size == BYTE)
-      mnemonic += ".B ";
-    else
-      mnemonic += ".L ";
-    trace_record += mnemonic;
-    trace_record += ea_description;
-    trace_record += "}} ";
-  }
   return (EXECUTE_OK);
 }
 
 // Execute the 'BRA' instruction
-int m68000::ExecuteBRA(int opcode, std::string &trace_record, int trace) {
+int m68000::ExecuteBRA(int opcode) {
   unsigned int displacement;
   int status;
-  std::string mnemonic;
-
-  if (trace)
-    mnemonic = "{Mnemonic {BRA";
 
   // Compute the displacement
   if ((displacement = opcode & 0xff) == 0) {
@@ -1637,20 +1306,8 @@ int m68000::ExecuteBRA(int opcode, std::string &trace_record, int trace) {
       return (status);
 
     displacement = SignExtend(displacement, WORD);
-    if (trace) {
-      mnemonic += ".W $";
-      mnemonic += IntToString(displacement, 4);
-      mnemonic += "}} ";
-      trace_record += mnemonic;
-    }
   } else {
     displacement = SignExtend(displacement, BYTE);
-    if (trace) {
-      mnemonic += ".B $";
-      mnemonic += IntToString(displacement, 2);
-      mnemonic += "}} ";
-      trace_record += mnemonic;
-    }
   }
 
   SetRegister(PC_INDEX, register_value[PC_INDEX] + displacement, LONG);
@@ -1658,14 +1315,10 @@ int m68000::ExecuteBRA(int opcode, std::string &trace_record, int trace) {
 }
 
 // Execute the 'BSR' instruction
-int m68000::ExecuteBSR(int opcode, std::string &trace_record, int trace) {
+int m68000::ExecuteBSR(int opcode) {
   unsigned int displacement;
   int status;
   Address addr;
-  std::string mnemonic;
-
-  if (trace)
-    mnemonic = "{Mnemonic {BSR";
 
   // Compute the displacement
   if ((displacement = opcode & 0xff) == 0) {
@@ -1675,18 +1328,8 @@ int m68000::ExecuteBSR(int opcode, std::string &trace_record, int trace) {
       return (status);
 
     displacement = SignExtend(displacement, WORD);
-    if (trace) {
-      mnemonic += ".W $";
-      mnemonic += IntToString(displacement, 4);
-      mnemonic += "}} ";
-    }
   } else {
     displacement = SignExtend(displacement, BYTE);
-    if (trace) {
-      mnemonic += ".B $";
-      mnemonic += IntToString(displacement, 2);
-      mnemonic += "}}  ";
-    }
   }
 
   // Push the PC onto the stack
@@ -1708,17 +1351,13 @@ int m68000::ExecuteBSR(int opcode, std::string &trace_record, int trace) {
 
   SetRegister(PC_INDEX, register_value[PC_INDEX] + displacement, LONG);
 
-  if (trace)
-    trace_record += mnemonic;
-
   return (EXECUTE_OK);
 }
 
 // Execute the 'Bcc' instructions
-int m68000::ExecuteBcc(int opcode, std::string &trace_record, int trace) {
+int m68000::ExecuteBcc(int opcode) {
   unsigned int displacement, branch;
   int status;
-  std::string mnemonic;
 
   // Compute the displacement
   if ((displacement = opcode & 0xff) == 0) {
@@ -1728,65 +1367,42 @@ int m68000::ExecuteBcc(int opcode, std::string &trace_record, int trace) {
       return (status);
   }
 
-  if (trace)
-    mnemonic = "{Mnemonic {B";
-
   // See if the branch should occur
-  branch = CheckConditionCodes((opcode & 0x0f00) >> 8, mnemonic, trace);
+  branch = CheckConditionCodes((opcode & 0x0f00) >> 8);
 
   if ((opcode & 0xff) == 0) {
-    if (trace) {
-      mnemonic += ".W $";
-      mnemonic += IntToString(displacement, 4);
-    }
     displacement = SignExtend(displacement, WORD);
   } else {
-    if (trace) {
-      mnemonic += ".B $";
-      mnemonic += IntToString(displacement, 2);
-    }
     displacement = SignExtend(displacement, BYTE);
   }
 
+  // A taken short branch or an untaken long one takes longer
+  if (branch != ((opcode & 0xff) == 0))
+    myCycles += 2;
+
   if (branch)
     SetRegister(PC_INDEX, register_value[PC_INDEX] + displacement, LONG);
   else if ((opcode & 0xff) == 0)
     SetRegister(PC_INDEX, register_value[PC_INDEX] + 2, LONG);
 
-  if (trace) {
-    mnemonic += "}} ";
-    trace_record += mnemonic;
-  }
   return (EXECUTE_OK);
 }
 
 // Execute the '' instruction
-int m68000::ExecuteCHK(int opcode, std::string &trace_record, int trace) {
-  return (ExecuteInvalid(opcode, trace_record, trace));
+int m68000::ExecuteCHK(int opcode) {
+  return (ExecuteInvalid(opcode));
 }
 
 // Execute the 'CLR' instruction
-int m68000::ExecuteCLR(int opcode, std::string &trace_record, int trace) {
+int m68000::ExecuteCLR(int opcode) {
   int status, size, in_register;
   Address address;
-  std::string mnemonic;
 
   size = (opcode & 0x00c0) >> 6;
 
-  if (trace) {
-    mnemonic += "{Mnemonic {CLR";
-    if (size == BYTE)
-      mnemonic += ".B ";
-    else if (size == WORD)
-      mnemonic += ".W ";
-    else if (size == LONG)
-      mnemonic += ".L ";
-  }
-
   // Get the destination data pointer
-  if ((status = ComputeEffectiveAddress(address, in_register, mnemonic,
-                                        opcode & 0x3f, size, trace)) !=
-      EXECUTE_OK) {
+  if ((status = ComputeEffectiveAddress(address, in_register, opcode & 0x3f,
+                                        size)) != EXECUTE_OK) {
     return (status);
   }
 
@@ -1799,26 +1415,20 @@ int m68000::ExecuteCLR(int opcode, std::string &trace_record, int trace) {
       return (status);
   }
 
-  if (trace) {
-    mnemonic += "}} ";
-    trace_record += mnemonic;
-  }
   return (EXECUTE_OK);
 }
 
 // Execute the 'CMP' instruction
-int m68000::ExecuteCMP(int opcode, std::string &trace_record, int trace) {
+int m68000::ExecuteCMP(int opcode) {
   int status, size, in_register_flag;
   Address ea_address, register_number;
   unsigned int result, ea_data;
-  std::string mnemonic, ea_description;
 
   size = (opcode & 0x00c0) >> 6;
 
   // Get the <ea> data address
-  if ((status =
-           ComputeEffectiveAddress(ea_address, in_register_flag, ea_description,
-                                   opcode & 0x3f, size, trace)) != EXECUTE_OK) {
+  if ((status = ComputeEffectiveAddress(ea_address, in_register_flag,
+                                        opcode & 0x3f, size)) != EXECUTE_OK) {
     return (status);
   }
 
@@ -1835,29 +1445,14 @@ int m68000::ExecuteCMP(int opcode, std::string &trace_record, int trace) {
   SetConditionCodes(ea_data, register_value[register_number], result, size,
                     SUBTRACTION, C_FLAG | V_FLAG | Z_FLAG | N_FLAG);
 
-  if (trace) {
-    mnemonic += "{Mnemonic {CMP";
-    if (size == BYTE)
-      mnemonic += ".B ";
-    else if (size == WORD)
-      mnemonic += ".W ";
-    else if (size == LONG)
-      mnemonic += ".L ";
-    mnemonic += ea_description;
-    mnemonic += ",";
-    mnemonic += ourRegisterData[register_number].name;
-    mnemonic += "}} ";
-    trace_record += mnemonic;
-  }
   return (EXECUTE_OK);
 }
 
 // Execute the 'CMPA' instruction
-int m68000::ExecuteCMPA(int opcode, std::string &trace_record, int trace) {
+int m68000::ExecuteCMPA(int opcode) {
   int status, size, in_register_flag;
   Address ea_address, register_number;
   unsigned int result, ea_data;
-  std::string mnemonic, ea_description;
 
   if (opcode & 0x0100)
     size = LONG;
@@ -1865,9 +1460,8 @@ int m68000::ExecuteCMPA(int opcode, std::string &trace_record, int trace) {
     size = WORD;
 
   // Get the <ea> data address
-  if ((status =
-           ComputeEffectiveAddress(ea_address, in_register_flag, ea_description,
-                                   opcode & 0x3f, size, trace)) != EXECUTE_OK) {
+  if ((status = ComputeEffectiveAddress(ea_address, in_register_flag,
+                                        opcode & 0x3f, size)) != EXECUTE_OK) {
     return (status);
   }
 
@@ -1889,43 +1483,20 @@ int m68000::ExecuteCMPA(int opcode, std::string &trace_record, int trace) {
   result = register_value[register_number] - ea_data;
   SetConditionCodes(ea_data, register_value[register_number], result, size,
                     SUBTRACTION, C_FLAG | V_FLAG | Z_FLAG | N_FLAG);
-  if (trace) {
-    mnemonic += "{Mnemonic {CMPA";
-    if (size == WORD)
-      mnemonic += ".W ";
-    else if (size == LONG)
-      mnemonic += ".L ";
-    mnemonic += ea_description;
-    mnemonic += ",";
-    mnemonic += ourRegisterData[register_number].name;
-    mnemonic += "}} ";
-    trace_record += mnemonic;
-  }
   return (EXECUTE_OK);
 }
 
 // Execute the 'CMPI' instruction
-int m68000::ExecuteCMPI(int opcode, std::string &trace_record, int trace) {
+int m68000::ExecuteCMPI(int opcode) {
   int status, size, in_register;
   Address dest_addr, src_addr;
   unsigned int result, src, dest;
-  std::string mnemonic;
 
   size = (opcode & 0x00c0) >> 6;
 
-  if (trace) {
-    mnemonic += "{Mnemonic {CMPI";
-    if (size == BYTE)
-      mnemonic += ".B ";
-    else if (size == WORD)
-      mnemonic += ".W ";
-    else if (size == LONG)
-      mnemonic += ".L ";
-  }
-
   // Get the immediate data pointer
-  if ((status = ComputeEffectiveAddress(src_addr, in_register, mnemonic, 0x3c,
-                                        size, trace)) != EXECUTE_OK) {
+  if ((status = ComputeEffectiveAddress(src_addr, in_register, 0x3c, size)) !=
+      EXECUTE_OK) {
     return (status);
   }
 
@@ -1933,13 +1504,9 @@ int m68000::ExecuteCMPI(int opcode, std::string &trace_record, int trace) {
   if ((status = Peek(src_addr, src, size)) != EXECUTE_OK)
     return (status);
 
-  if (trace)
-    mnemonic += ",";
-
   // Get the destination data pointer
-  if ((status = ComputeEffectiveAddress(dest_addr, in_register, mnemonic,
-                                        opcode & 0x3f, size, trace)) !=
-      EXECUTE_OK) {
+  if ((status = ComputeEffectiveAddress(dest_addr, in_register, opcode & 0x3f,
+                                        size)) != EXECUTE_OK) {
     return (status);
   }
 
@@ -1956,45 +1523,27 @@ int m68000::ExecuteCMPI(int opcode, std::string &trace_record, int trace) {
                       C_FLAG | V_FLAG | Z_FLAG | N_FLAG);
   }
 
-  if (trace) {
-    mnemonic += "}} ";
-    trace_record += mnemonic;
-  }
   return (EXECUTE_OK);
 }
 
 // Execute the 'CMPM' instruction
-int m68000::ExecuteCMPM(int opcode, std::string &trace_record, int trace) {
+int m68000::ExecuteCMPM(int opcode) {
   int status, size, in_register_flag;
   Address src_address, dest_address;
   unsigned int result, src, dest;
-  std::string mnemonic;
 
   size = (opcode & 0x00c0) >> 6;
 
-  if (trace) {
-    mnemonic += "{Mnemonic {CMPM";
-    if (size == BYTE)
-      mnemonic += ".B ";
-    else if (size == WORD)
-      mnemonic += ".W ";
-    else if (size == LONG)
-      mnemonic += ".L ";
-  }
-
   // Get the addresses
-  if ((status = ComputeEffectiveAddress(src_address, in_register_flag, mnemonic,
-                                        0x18 | (opcode & 7), size, trace)) !=
+  if ((status = ComputeEffectiveAddress(src_address, in_register_flag,
+                                        0x18 | (opcode & 7), size)) !=
       EXECUTE_OK) {
     return (status);
   }
 
-  if (trace)
-    mnemonic += ",";
-
-  if ((status = ComputeEffectiveAddress(
-           dest_address, in_register_flag, mnemonic,
-           0x18 | ((opcode & 0x0e00) >> 9), size, trace)) != EXECUTE_OK) {
+  if ((status = ComputeEffectiveAddress(dest_address, in_register_flag,
+                                        0x18 | ((opcode & 0x0e00) >> 9),
+                                        size)) != EXECUTE_OK) {
     return (status);
   }
 
@@ -2007,21 +1556,13 @@ int m68000::ExecuteCMPM(int opcode, std::string &trace_record, int trace) {
   SetConditionCodes(src, dest, result, size, SUBTRACTION,
                     C_FLAG | V_FLAG | N_FLAG | Z_FLAG);
 
-  if (trace) {
-    mnemonic += "}} ";
-    trace_record += mnemonic;
-  }
   return (EXECUTE_OK);
 }
 
 // Execute the 'DBcc' instruction
-int m68000::ExecuteDBcc(int opcode, std::string &trace_record, int trace) {
+int m68000::ExecuteDBcc(int opcode) {
   unsigned int displacement, register_number, condition_code;
   int status;
-  std::string mnemonic;
-
-  if (trace)
-    mnemonic = "{Mnemonic {DB";
 
   // Fetch the 16-bit displacement data
   if ((status = Peek(register_value[PC_INDEX], displacement, WORD)) !=
@@ -2031,47 +1572,39 @@ int m68000::ExecuteDBcc(int opcode, std::string &trace_record, int trace) {
   displacement = SignExtend(displacement, WORD);
 
   // Check the condition code
-  condition_code = CheckConditionCodes((opcode & 0x0f00) >> 8, mnemonic, trace);
+  condition_code = CheckConditionCodes((opcode & 0x0f00) >> 8);
 
   // Get the register number that we are counting with
   register_number = D0_INDEX + (opcode & 7);
 
-  if (trace) {
-    mnemonic += ".W ";
-    mnemonic += ourRegisterData[register_number].name;
-    mnemonic += ",$";
-    mnemonic += IntToString(displacement, 4);
-  }
-
   // If condition code is not true then preform Decrement and Branch
   if (!condition_code) {
     SetRegister(register_number, register_value[register_number] - 1, WORD);
-    if ((register_value[register_number] & 0xffff) == 0xffff)
+    if ((register_value[register_number] & 0xffff) == 0xffff) {
+      myCycles += 4;
       SetRegister(PC_INDEX, register_value[PC_INDEX] + 2, LONG);
-    else
+    } else {
       SetRegister(PC_INDEX, register_value[PC_INDEX] + displacement, LONG);
+    }
   } else {
+    myCycles += 2;
     SetRegister(PC_INDEX, register_value[PC_INDEX] + 2, LONG);
   }
 
-  if (trace) {
-    mnemonic += "}} ";
-    trace_record += mnemonic;
-  }
   return (EXECUTE_OK);
 }
 
 // Execute the 'DIVS' instruction
-int m68000::ExecuteDIVS(int opcode, std::string &trace_record, int trace) {
+int m68000::ExecuteDIVS(int opcode) {
   int status, in_register_flag, positive_result;
   Address ea_address, register_number;
   int ea_data, high_result, low_result, data;
-  std::string ea_description;
+
+  EvaluateConditionCodes();
 
   // Get the <ea> data address
-  if ((status =
-           ComputeEffectiveAddress(ea_address, in_register_flag, ea_description,
-                                   opcode & 0x3f, WORD, trace)) != EXECUTE_OK) {
+  if ((status = ComputeEffectiveAddress(ea_address, in_register_flag,
+                                        opcode & 0x3f, WORD)) != EXECUTE_OK) {
     return (status);
   }
 
@@ -2091,11 +1624,10 @@ int m68000::ExecuteDIVS(int opcode, std::string &trace_record, int trace) {
   if (ea_data == 0) {
     if ((status = ProcessException(5)) != EXECUTE_OK)
       return (status);
-    if (trace)
-      ;
-    trace_record += "{Mnemonic {Divide by Zero Exception}} ";
+    myExceptionMnemonic = "Divide by Zero Exception";
     return (EXECUTE_OK);
   }
+  myCycles += 158;
 
   // Get the register number
   register_number = D0_INDEX + ((opcode & 0x0e00) >> 9);
@@ -2117,7 +1649,8 @@ int m68000::ExecuteDIVS(int opcode, std::string &trace_record, int trace) {
   low_result = data / ea_data;
 
   SetRegister(register_number, high_result | (low_result & 0xffff), LONG);
-  SetConditionCodes(0, 0, low_result, WORD, OTHER, C_FLAG | Z_FLAG | N_FLAG);
+  ComputeConditionCodes(0, 0, low_result, WORD, OTHER,
+                        C_FLAG | Z_FLAG | N_FLAG);
 
   // Set the overflow flag
   if ((positive_result && (low_result & 0xffff8000)) ||
@@ -2126,27 +1659,20 @@ int m68000::ExecuteDIVS(int opcode, std::string &trace_record, int trace) {
   else
     register_value[SR_INDEX] &= ~V_FLAG;
 
-  if (trace) {
-    trace_record += "{Mnemonic {DIVS.W ";
-    trace_record += ea_description;
-    trace_record += ",";
-    trace_record += ourRegisterData[register_number].name;
-    trace_record += "}} ";
-  }
   return (EXECUTE_OK);
 }
 
 // Execute the 'DIVU' instruction
-int m68000::ExecuteDIVU(int opcode, std::string &trace_record, int trace) {
+int m68000::ExecuteDIVU(int opcode) {
   int status, in_register_flag;
   Address ea_address, register_number;
   unsigned int high_result, low_result, ea_data;
-  std::string ea_description;
+
+  EvaluateConditionCodes();
 
   // Get the <ea> data address
-  if ((status =
-           ComputeEffectiveAddress(ea_address, in_register_flag, ea_description,
-                                   opcode & 0x3f, WORD, trace)) != EXECUTE_OK) {
+  if ((status = ComputeEffectiveAddress(ea_address, in_register_flag,
+                                        opcode & 0x3f, WORD)) != EXECUTE_OK) {
     return (status);
   }
 
@@ -2160,11 +1686,10 @@ int m68000::ExecuteDIVU(int opcode, std::string &trace_record, int trace) {
   if (ea_data == 0) {
     if ((status = ProcessException(5)) != EXECUTE_OK)
       return (status);
-    if (trace)
-      ;
-    trace_record += "{Mnemonic {Divide by Zero Exception}} ";
+    myExceptionMnemonic = "Divide by Zero Exception";
     return (EXECUTE_OK);
   }
+  myCycles += 140;
 
   // Get the register number
   register_number = D0_INDEX + ((opcode & 0x0e00) >> 9);
@@ -2174,7 +1699,8 @@ int m68000::ExecuteDIVU(int opcode, std::string &trace_record, int trace) {
   low_result = register_value[register_number] / ea_data;
 
   SetRegister(register_number, high_result | (low_result & 0xffff), LONG);
-  SetConditionCodes(0, 0, low_result, WORD, OTHER, C_FLAG | Z_FLAG | N_FLAG);
+  ComputeConditionCodes(0, 0, low_result, WORD, OTHER,
+                        C_FLAG | Z_FLAG | N_FLAG);
 
   // Set the overflow flag
   if (low_result & 0xffff0000)
@@ -2182,29 +1708,20 @@ int m68000::ExecuteDIVU(int opcode, std::string &trace_record, int trace) {
   else
     register_value[SR_INDEX] &= ~V_FLAG;
 
-  if (trace) {
-    trace_record += "{Mnemonic {DIVU.W ";
-    trace_record += ea_description;
-    trace_record += ",";
-    trace_record += ourRegisterData[register_number].name;
-    trace_record += "}} ";
-  }
   return (EXECUTE_OK);
 }
 
 // Execute the 'EOR' instruction
-int m68000::ExecuteEOR(int opcode, std::string &trace_record, int trace) {
+int m68000::ExecuteEOR(int opcode) {
   int status, size, in_register_flag;
   Address ea_address, register_number;
   unsigned int result, ea_data;
-  std::string mnemonic, ea_description;
 
   size = (opcode & 0x00c0) >> 6;
 
   // Get the <ea> data address
-  if ((status =
-           ComputeEffectiveAddress(ea_address, in_register_flag, ea_description,
-                                   opcode & 0x3f, size, trace)) != EXECUTE_OK) {
+  if ((status = ComputeEffectiveAddress(ea_address, in_register_flag,
+                                        opcode & 0x3f, size)) != EXECUTE_OK) {
     return (status);
   }
 
@@ -2225,45 +1742,20 @@ int m68000::ExecuteEOR(int opcode, std::string &trace_record, int trace) {
   else if ((status = Poke(ea_address, result, size)) != EXECUTE_OK)
     return (status);
 
-  if (trace) {
-    mnemonic += "{Mnemonic {EOR";
-    if (size == BYTE)
-      mnemonic += ".B ";
-    else if (size == WORD)
-      mnemonic += ".W ";
-    else if (size == LONG)
-      mnemonic += ".L ";
-    mnemonic += ourRegisterData[register_number].name;
-    mnemonic += ",";
-    mnemonic += ea_description;
-    mnemonic += "}} ";
-    trace_record += mnemonic;
-  }
   return (EXECUTE_OK);
 }
 
 // Execute the 'EORI' instruction
-int m68000::ExecuteEORI(int opcode, std::string &trace_record, int trace) {
+int m68000::ExecuteEORI(int opcode) {
   int status, size, in_register;
   Address dest_addr, src_addr;
   unsigned int result, src, dest;
-  std::string mnemonic;
 
   size = (opcode & 0x00c0) >> 6;
 
-  if (trace) {
-    mnemonic += "{Mnemonic {EORI";
-    if (size == BYTE)
-      mnemonic += ".B ";
-    else if (size == WORD)
-      mnemonic += ".W ";
-    else if (size == LONG)
-      mnemonic += ".L ";
-  }
-
   // Get the immediate data pointer
-  if ((status = ComputeEffectiveAddress(src_addr, in_register, mnemonic, 0x3c,
-                                        size, trace)) != EXECUTE_OK) {
+  if ((status = ComputeEffectiveAddress(src_addr, in_register, 0x3c, size)) !=
+      EXECUTE_OK) {
     return (status);
   }
 
@@ -2271,13 +1763,9 @@ int m68000::ExecuteEORI(int opcode, std::string &trace_record, int trace) {
   if ((status = Peek(src_addr, src, size)) != EXECUTE_OK)
     return (status);
 
-  if (trace)
-    mnemonic += ",";
-
   // Get the destination data pointer
-  if ((status = ComputeEffectiveAddress(dest_addr, in_register, mnemonic,
-                                        opcode & 0x3f, size, trace)) !=
-      EXECUTE_OK) {
+  if ((status = ComputeEffectiveAddress(dest_addr, in_register, opcode & 0x3f,
+                                        size)) != EXECUTE_OK) {
     return (status);
   }
 
@@ -2297,24 +1785,20 @@ int m68000::ExecuteEORI(int opcode, std::string &trace_record, int trace) {
       return (status);
   }
 
-  if (trace) {
-    mnemonic += "}} ";
-    trace_record += mnemonic;
-  }
   return (EXECUTE_OK);
 }
 
 // Execute the 'EORItoCCR' instruction
-int m68000::ExecuteEORItoCCR(int, std::string &trace_record, int trace) {
+int m68000::ExecuteEORItoCCR(int) {
   int status, in_register_flag;
   Address src_addr;
   unsigned int src;
-  std::string ea_description;
+
+  EvaluateConditionCodes();
 
   // Get the immediate data pointer
-  if ((status = ComputeEffectiveAddress(src_addr, in_register_flag,
-                                        ea_description, 0x3c, BYTE, trace)) !=
-      EXECUTE_OK) {
+  if ((status = ComputeEffectiveAddress(src_addr, in_register_flag, 0x3c,
+                                        BYTE)) != EXECUTE_OK) {
     return (status);
   }
 
@@ -2323,36 +1807,29 @@ int m68000::ExecuteEORItoCCR(int, std::string &trace_record, int trace) {
     return (status);
 
   SetRegister(SR_INDEX, register_value[SR_INDEX] ^ src, BYTE);
-  if (trace) {
-    trace_record += "{Mnemonic {EORI.B ";
-    trace_record += ea_description;
-    trace_record += ",CCR}} ";
-  }
   return (EXECUTE_OK);
 }
 
 // Execute the 'EORItoSR' instruction
-int m68000::ExecuteEORItoSR(int, std::string &trace_record, int trace) {
+int m68000::ExecuteEORItoSR(int) {
   int status, in_register_flag;
   Address src_addr;
   unsigned int src;
-  std::string ea_description;
+
+  EvaluateConditionCodes();
 
   // Make sure we're in supervisor mode or trap
   if (!(register_value[SR_INDEX] & S_FLAG)) {
     SetRegister(PC_INDEX, register_value[PC_INDEX] - 2, LONG);
     if ((status = ProcessException(8)) != EXECUTE_OK)
       return (status);
-    if (trace)
-      ;
-    trace_record += "{Mnemonic {Privilege Violation Exception}} ";
+    myExceptionMnemonic = "Privilege Violation Exception";
     return (EXECUTE_PRIVILEGED_OK);
   }
 
   // Get the immediate data pointer
-  if ((status = ComputeEffectiveAddress(src_addr, in_register_flag,
-                                        ea_description, 0x3c, WORD, trace)) !=
-      EXECUTE_OK) {
+  if ((status = ComputeEffectiveAddress(src_addr, in_register_flag, 0x3c,
+                                        WORD)) != EXECUTE_OK) {
     return (status);
   }
 
@@ -2362,16 +1839,11 @@ int m68000::ExecuteEORItoSR(int, std::string &trace_record, int trace) {
 
   SetRegister(SR_INDEX, register_value[SR_INDEX] ^ src, WORD);
 
-  if (trace) {
-    trace_record += "{Mnemonic {EORI.W ";
-    trace_record += ea_description;
-    trace_record += ",SR}} ";
-  }
   return (EXECUTE_PRIVILEGED_OK);
 }
 
 // Execute the 'EXG' instruction
-int m68000::ExecuteEXG(int opcode, std::string &trace_record, int trace) {
+int m68000::ExecuteEXG(int opcode) {
   Register tmp;
   unsigned int src_register, dest_register;
 
@@ -2408,24 +1880,14 @@ int m68000::ExecuteEXG(int opcode, std::string &trace_record, int trace) {
   SetRegister(src_register, register_value[dest_register], LONG);
   SetRegister(dest_register, tmp, LONG);
 
-  if (trace) {
-    trace_record += "{Mnemonic {EXG.L ";
-    trace_record += ourRegisterData[src_register].name;
-    trace_record += ",";
-    trace_record += ourRegisterData[dest_register].name;
-    trace_record += "}} ";
-  }
   return (EXECUTE_OK);
 }
 
 // Execute the 'EXT' instruction
-int m68000::ExecuteEXT(int opcode, std::string &trace_record, int trace) {
+int m68000::ExecuteEXT(int opcode) {
   unsigned int register_number;
   unsigned long data;
 
-  if (trace)
-    trace_record += "{Mnemonic {EXT";
-
   // Get the data register number
   register_number = D0_INDEX + (opcode & 0x0007);
   data = register_value[register_number];
@@ -2436,26 +1898,18 @@ int m68000::ExecuteEXT(int opcode, std::string &trace_record, int trace) {
     SetRegister(register_number, data, WORD);
     SetConditionCodes(0, 0, data, WORD, OTHER,
                       V_FLAG | C_FLAG | Z_FLAG | N_FLAG);
-    if (trace)
-      trace_record += ".W ";
   } else {
     data = SignExtend(data, WORD);
     SetRegister(register_number, data, LONG);
     SetConditionCodes(0, 0, data, LONG, OTHER,
                       V_FLAG | C_FLAG | Z_FLAG | N_FLAG);
-    if (trace)
-      trace_record += ".L ";
   }
 
-  if (trace) {
-    trace_record += ourRegisterData[register_number].name;
-    trace_record += "}} ";
-  }
   return (EXECUTE_OK);
 }
 
 // Execute the 'ILLEGAL' instruction
-int m68000::ExecuteILLEGAL(int, std::string &trace_record, int trace) {
+int m68000::ExecuteILLEGAL(int) {
   int status;
 
   // Move the PC back to the start of the illegal instruction opcode
@@ -2465,45 +1919,33 @@ int m68000::ExecuteILLEGAL(int, std::string &trace_record, int trace) {
   if ((status = ProcessException(4)) != EXECUTE_OK)
     return (status);
 
-  if (trace)
-    trace_record += "{Mnemonic {ILLEGAL}} ";
-
   return (EXECUTE_OK);
 }
 
 // Execute the 'JMP' instruction
-int m68000::ExecuteJMP(int opcode, std::string &trace_record, int trace) {
+int m68000::ExecuteJMP(int opcode) {
   int status, in_register_flag;
   Address address;
-  std::string ea_description;
 
   // Get the effective address
-  if ((status =
-           ComputeEffectiveAddress(address, in_register_flag, ea_description,
-                                   opcode & 0x3f, LONG, trace)) != EXECUTE_OK) {
+  if ((status = ComputeEffectiveAddress(address, in_register_flag,
+                                        opcode & 0x3f, LONG)) != EXECUTE_OK) {
     return (status);
   }
 
   SetRegister(PC_INDEX, address, LONG);
 
-  if (trace) {
-    trace_record += "{Mnemonic {JMP ";
-    trace_record += ea_description;
-    trace_record += "}} ";
-  }
   return (EXECUTE_OK);
 }
 
 // Execute the 'JSR' instruction
-int m68000::ExecuteJSR(int opcode, std::string &trace_record, int trace) {
+int m68000::ExecuteJSR(int opcode) {
   int status, in_register_flag;
   Address address, stack_address;
-  std::string ea_description;
 
   // Get the effective address
-  if ((status =
-           ComputeEffectiveAddress(address, in_register_flag, ea_description,
-                                   opcode & 0x3f, LONG, trace)) != EXECUTE_OK) {
+  if ((status = ComputeEffectiveAddress(address, in_register_flag,
+                                        opcode & 0x3f, LONG)) != EXECUTE_OK) {
     return (status);
   }
 
@@ -2521,24 +1963,17 @@ int m68000::ExecuteJSR(int opcode, std::string &trace_record, int trace) {
 
   SetRegister(PC_INDEX, address, LONG);
 
-  if (trace) {
-    trace_record += "{Mnemonic {JSR ";
-    trace_record += ea_description;
-    trace_record += "}} ";
-  }
   return (EXECUTE_OK);
 }
 
 // Execute the 'LEA' instruction
-int m68000::ExecuteLEA(int opcode, std::string &trace_record, int trace) {
+int m68000::ExecuteLEA(int opcode) {
   int status, in_register_flag;
   Address address, register_number;
-  std::string ea_description;
 
   // Get the effective address
-  if ((status =
-           ComputeEffectiveAddress(address, in_register_flag, ea_description,
-                                   opcode & 0x3f, LONG, trace)) != EXECUTE_OK) {
+  if ((status = ComputeEffectiveAddress(address, in_register_flag,
+                                        opcode & 0x3f, LONG)) != EXECUTE_OK) {
     return (status);
   }
 
@@ -2551,27 +1986,18 @@ int m68000::ExecuteLEA(int opcode, std::string &trace_record, int trace) {
 
   SetRegister(register_number, address, LONG);
 
-  if (trace) {
-    trace_record += "{Mnemonic {LEA.L ";
-    trace_record += ea_description;
-    trace_record += ",";
-    trace_record += ourRegisterData[register_number].name;
-    trace_record += "}} ";
-  }
   return (EXECUTE_OK);
 }
 
 // Execute the 'LINK' instruction
-int m68000::ExecuteLINK(int opcode, std::string &trace_record, int trace) {
+int m68000::ExecuteLINK(int opcode) {
   int status, in_register_flag, stack_index;
   unsigned int register_number, displacement;
   Address address;
-  std::string ea_description;
 
   // Get the displacement data pointer
-  if ((status = ComputeEffectiveAddress(address, in_register_flag,
-                                        ea_description, 0x3c, WORD, trace)) !=
-      EXECUTE_OK) {
+  if ((status = ComputeEffectiveAddress(address, in_register_flag, 0x3c,
+                                        WORD)) != EXECUTE_OK) {
     return (status);
   }
 
@@ -2606,23 +2032,16 @@ int m68000::ExecuteLINK(int opcode, std::string &trace_record, int trace) {
   // Add displacement to the stack pointer
   SetRegister(stack_index, register_value[stack_index] + displacement, LONG);
 
-  if (trace) {
-    trace_record += "{Mnemonic {LINK ";
-    trace_record += ourRegisterData[register_number].name;
-    trace_record += ",";
-    trace_record += ea_description;
-    trace_record += "}} ";
-  }
   return (EXECUTE_OK);
 }
 
 // Execute the 'LSL' instruction
-int m68000::ExecuteLSL(int opcode, std::string &trace_record, int trace) {
+int m68000::ExecuteLSL(int opcode) {
   int status, size, in_register_flag, shift_count;
   Address address;
   unsigned int data;
-  std::string ea_description;
 
+  EvaluateConditionCodes();
   size = (opcode & 0x00c0) >> 6;
 
   // Check to see if this is a memory or register shift
@@ -2631,8 +2050,7 @@ int m68000::ExecuteLSL(int opcode, std::string &trace_record, int trace) {
 
     // Get the address
     if ((status = ComputeEffectiveAddress(address, in_register_flag,
-                                          ea_description, opcode & 0x3f, size,
-                                          trace)) != EXECUTE_OK) {
+                                          opcode & 0x3f, size)) != EXECUTE_OK) {
       return (status);
     }
 
@@ -2647,8 +2065,8 @@ int m68000::ExecuteLSL(int opcode, std::string &trace_record, int trace) {
     if ((status = Poke(address, data, size)) != EXECUTE_OK)
       return (status);
 
-    SetConditionCodes(0, 0, data, size, OTHER,
-                      N_FLAG | Z_FLAG | X_FLAG | C_FLAG | V_FLAG);
+    ComputeConditionCodes(0, 0, data, size, OTHER,
+                          N_FLAG | Z_FLAG | X_FLAG | C_FLAG | V_FLAG);
     if (data & 0x00010000) {
       register_value[SR_INDEX] |= C_FLAG;
       register_value[SR_INDEX] |= X_FLAG;
@@ -2657,23 +2075,11 @@ int m68000::ExecuteLSL(int opcode, std::string &trace_record, int trace) {
     // Compute the shift count
     if (opcode & 32) {
       shift_count = register_value[D0_INDEX + ((opcode & 0x0e00) >> 9)] & 0x3f;
-      if (trace)
-        ea_description =
-            ourRegisterData[D0_INDEX + ((opcode & 0x0e00) >> 9)].name;
     } else {
       if ((shift_count = (opcode & 0x0e00) >> 9) == 0)
         shift_count = 8;
-
-      if (trace) {
-        ea_description = "#$";
-        ea_description += IntToString(shift_count, 1);
-      }
-    }
-
-    if (trace) {
-      ea_description += ",";
-      ea_description += ourRegisterData[D0_INDEX + (opcode & 7)].name;
     }
+    myCycles += 2 * shift_count;
 
     unsigned int carry = 0;
     unsigned int carry_mask;
@@ -2695,35 +2101,24 @@ int m68000::ExecuteLSL(int opcode, std::string &trace_record, int trace) {
 
     SetRegister(D0_INDEX + (opcode & 7), data, size);
 
-    SetConditionCodes(0, 0, data, size, OTHER,
-                      N_FLAG | Z_FLAG | X_FLAG | C_FLAG | V_FLAG);
+    ComputeConditionCodes(0, 0, data, size, OTHER,
+                          N_FLAG | Z_FLAG | X_FLAG | C_FLAG | V_FLAG);
     if (carry) {
       register_value[SR_INDEX] |= C_FLAG;
       register_value[SR_INDEX] |= X_FLAG;
     }
   }
 
-  if (trace) {
-    trace_record += "{Mnemonic {LSL";
-    if (size == BYTE)
-      trace_record += ".B ";
-    else if (size == WORD)
-      trace_record += ".W ";
-    else if (size == LONG)
-      trace_record += ".L ";
-    trace_record += ea_description;
-    trace_record += "}} ";
-  }
   return (EXECUTE_OK);
 }
 
 // Execute the 'LSR' instruction
-int m68000::ExecuteLSR(int opcode, std::string &trace_record, int trace) {
+int m68000::ExecuteLSR(int opcode) {
   int status, size, in_register_flag, shift_count;
   Address address;
   unsigned int data;
-  std::string ea_description;
 
+  EvaluateConditionCodes();
   size = (opcode & 0x00c0) >> 6;
 
   // Check to see if this is a memory or register shift
@@ -2732,8 +2127,7 @@ int m68000::ExecuteLSR(int opcode, std::string &trace_record, int trace) {
 
     // Get the address
     if ((status = ComputeEffectiveAddress(address, in_register_flag,
-                                          ea_description, opcode & 0x3f, size,
-                                          trace)) != EXECUTE_OK) {
+                                          opcode & 0x3f, size)) != EXECUTE_OK) {
       return (status);
     }
 
@@ -2742,8 +2136,8 @@ int m68000::ExecuteLSR(int opcode, std::string &trace_record, int trace) {
       return (status);
 
     // Set the condition codes
-    SetConditionCodes(0, 0, (data >> 1) & 0x7fff, size, OTHER,
-                      N_FLAG | Z_FLAG | X_FLAG | C_FLAG | V_FLAG);
+    ComputeConditionCodes(0, 0, (data >> 1) & 0x7fff, size, OTHER,
+                          N_FLAG | Z_FLAG | X_FLAG | C_FLAG | V_FLAG);
     if (data & 0x0001) {
       register_value[SR_INDEX] |= C_FLAG;
       register_value[SR_INDEX] |= X_FLAG;
@@ -2759,23 +2153,11 @@ int m68000::ExecuteLSR(int opcode, std::string &trace_record, int trace) {
     // Compute the shift count
     if (opcode & 32) {
       shift_count = register_value[D0_INDEX + ((opcode & 0x0e00) >> 9)] & 0x3f;
-      if (trace)
-        ea_description =
-            ourRegisterData[D0_INDEX + ((opcode & 0x0e00) >> 9)].name;
     } else {
       if ((shift_count = (opcode & 0x0e00) >> 9) == 0)
         shift_count = 8;
-
-      if (trace) {
-        ea_description = "#$";
-        ea_description += IntToString(shift_count, 1);
-      }
-    }
-
-    if (trace) {
-      ea_description += ",";
-      ea_description += ourRegisterData[D0_INDEX + (opcode & 7)].name;
     }
+    myCycles += 2 * shift_count;
 
     unsigned int carry = 0, clear_mask;
 
@@ -2796,34 +2178,22 @@ int m68000::ExecuteLSR(int opcode, std::string &trace_record, int trace) {
 
     SetRegister(D0_INDEX + (opcode & 7), data, size);
 
-    SetConditionCodes(0, 0, data, size, OTHER,
-                      N_FLAG | Z_FLAG | X_FLAG | C_FLAG | V_FLAG);
+    ComputeConditionCodes(0, 0, data, size, OTHER,
+                          N_FLAG | Z_FLAG | X_FLAG | C_FLAG | V_FLAG);
     if (carry) {
       register_value[SR_INDEX] |= C_FLAG;
       register_value[SR_INDEX] |= X_FLAG;
     }
   }
 
-  if (trace) {
-    trace_record += "{Mnemonic {LSR";
-    if (size == BYTE)
-      trace_record += ".B ";
-    else if (size == WORD)
-      trace_record += ".W ";
-    else if (size == LONG)
-      trace_record += ".L ";
-    trace_record += ea_description;
-    trace_record += "}} ";
-  }
   return (EXECUTE_OK);
 }
 
 // Execute the 'MOVE' instruction
-int m68000::ExecuteMOVE(int opcode, std::string &trace_record, int trace) {
+int m68000::ExecuteMOVE(int opcode) {
   int status, in_register_flag, size;
   Address src_address, dest_address;
   unsigned int src;
-  std::string ea_description;
 
   switch ((opcode & 0x3000) >> 12) {
   case 1:
@@ -2841,8 +2211,7 @@ int m68000::ExecuteMOVE(int opcode, std::string &trace_record, int trace) {
 
   // Get the source effective address
   if ((status = ComputeEffectiveAddress(src_address, in_register_flag,
-                                        ea_description, opcode & 0x3f, size,
-                                        trace)) != EXECUTE_OK) {
+                                        opcode & 0x3f, size)) != EXECUTE_OK) {
     return (status);
   }
 
@@ -2851,13 +2220,10 @@ int m68000::ExecuteMOVE(int opcode, std::string &trace_record, int trace) {
   else if ((status = Peek(src_address, src, size)) != EXECUTE_OK)
     return (status);
 
-  if (trace)
-    ea_description += ",";
-
   // Get the destination effective address
   if ((status = ComputeEffectiveAddress(
-           dest_address, in_register_flag, ea_description,
-           ((opcode & 0x01c0) >> 3) | ((opcode & 0x0e00) >> 9), size, trace)) !=
+           dest_address, in_register_flag,
+           ((opcode & 0x01c0) >> 3) | ((opcode & 0x0e00) >> 9), size)) !=
       EXECUTE_OK) {
     return (status);
   }
@@ -2868,26 +2234,14 @@ int m68000::ExecuteMOVE(int opcode, std::string &trace_record, int trace) {
     return (status);
 
   SetConditionCodes(0, 0, src, size, OTHER, N_FLAG | Z_FLAG | V_FLAG | C_FLAG);
-  if (trace) {
-    trace_record += "{Mnemonic {MOVE";
-    if (size == BYTE)
-      trace_record += ".B ";
-    else if (size == WORD)
-      trace_record += ".W ";
-    else if (size == LONG)
-      trace_record += ".L ";
-    trace_record += ea_description;
-    trace_record += "}} ";
-  }
   return (EXECUTE_OK);
 }
 
 // Execute the 'MOVEA' instruction
-int m68000::ExecuteMOVEA(int opcode, std::string &trace_record, int trace) {
+int m68000::ExecuteMOVEA(int opcode) {
   int status, in_register_flag, size;
   Address src_address, dest_address;
   unsigned int src;
-  std::string ea_description;
 
   switch ((opcode & 0x3000) >> 12) {
   case 3:
@@ -2902,8 +2256,7 @@ int m68000::ExecuteMOVEA(int opcode, std::string &trace_record, int trace) {
 
   // Get the source effective address
   if ((status = ComputeEffectiveAddress(src_address, in_register_flag,
-                                        ea_description, opcode & 0x3f, size,
-                                        trace)) != EXECUTE_OK) {
+                                        opcode & 0x3f, size)) != EXECUTE_OK) {
     return (status);
   }
 
@@ -2915,13 +2268,10 @@ int m68000::ExecuteMOVEA(int opcode, std::string &trace_record, int trace) {
   if (size == WORD)
     src = SignExtend(src, WORD);
 
-  if (trace)
-    ea_description += ",";
-
   // Get the destination effective address
   if ((status = ComputeEffectiveAddress(
-           dest_address, in_register_flag, ea_description,
-           ((opcode & 0x01c0) >> 3) | ((opcode & 0x0e00) >> 9), LONG, trace)) !=
+           dest_address, in_register_flag,
+           ((opcode & 0x01c0) >> 3) | ((opcode & 0x0e00) >> 9), LONG)) !=
       EXECUTE_OK) {
     return (status);
   }
@@ -2931,24 +2281,14 @@ int m68000::ExecuteMOVEA(int opcode, std::string &trace_record, int trace) {
   else if ((status = Poke(dest_address, src, LONG)) != EXECUTE_OK)
     return (status);
 
-  if (trace) {
-    trace_record += "{Mnemonic {MOVEA";
-    if (size == WORD)
-      trace_record += ".W ";
-    else if (size == LONG)
-      trace_record += ".L ";
-    trace_record += ea_description;
-    trace_record += "}} ";
-  }
   return (EXECUTE_OK);
 }
 
 // Execute the 'MOVEM' instruction
-int m68000::ExecuteMOVEM(int opcode, std::string &trace_record, int trace) {
+int m68000::ExecuteMOVEM(int opcode) {
   int status, in_register_flag, size;
   Address address, offset, reg;
   unsigned int list, data;
-  std::string ea_description, mnemonic;
 
   // Determine size and offset
   if (opcode & 64) {
@@ -2959,24 +2299,27 @@ int m68000::ExecuteMOVEM(int opcode, std::string &trace_record, int trace) {
     size = WORD;
   }
 
-  if (trace) {
-    mnemonic += "{Mnemonic {MOVEM";
-    if (size == WORD)
-      mnemonic += ".W ";
-    else if (size == LONG)
-      mnemonic += ".L ";
-  }
-
   // Get the register list mask
   if ((status = Peek(register_value[PC_INDEX], list, WORD)) != EXECUTE_OK)
     return (status);
   SetRegister(PC_INDEX, register_value[PC_INDEX] + 2, LONG);
 
+  // Each register transferred takes a bus cycle per word
+  int count = 0;
+  for (unsigned int bits = list & 0xffff; bits != 0; bits &= bits - 1)
+    ++count;
+  myCycles += 2 * offset * count;
+
+  // Registers are moved straight to or from host memory when the block
+  // lies in a single memory page
+  AddressSpace &space = *myAddressSpaces[0];
+  const Byte *source = nullptr;
+  Byte *destination = nullptr;
+
   // Get the effective address (if this isn't predecrement)
   if ((opcode & 0x38) != 32) {
     if ((status = ComputeEffectiveAddress(address, in_register_flag,
-                                          ea_description, opcode & 0x3f, size,
-                                          trace)) != EXECUTE_OK) {
+                                          opcode & 0x3f, size)) != EXECUTE_OK) {
       return (status);
     }
   }
@@ -2989,10 +2332,11 @@ int m68000::ExecuteMOVEM(int opcode, std::string &trace_record, int trace) {
     else
       reg = A0_INDEX + (opcode & 7);
     address = register_value[reg];
-    if (trace) {
-      ea_description += "-(";
-      ea_description += ourRegisterData[reg].name;
-      ea_description += ")";
+    if ((address & 1) == 0 && count != 0) {
+      destination = space.FindWriteMemory(address - count * offset,
+                                          count * offset);
+      if (destination != nullptr)
+        destination += count * offset;
     }
 
     for (unsigned int t = A0_INDEX + 7;;) {
@@ -3003,12 +2347,12 @@ int m68000::ExecuteMOVEM(int opcode, std::string &trace_record, int trace) {
           reg = t;
 
         address -= offset;
-        if ((status = Poke(address, register_value[reg], size)) != EXECUTE_OK)
+        if (destination != nullptr) {
+          destination -= offset;
+          WriteBigEndian(destination, register_value[reg], offset);
+        } else if ((status = Poke(address, register_value[reg], size)) !=
+                   EXECUTE_OK) {
           return (status);
-
-        if (trace) {
-          mnemonic += ourRegisterData[reg].name;
-          mnemonic += " ";
         }
       }
 
@@ -3017,16 +2361,15 @@ int m68000::ExecuteMOVEM(int opcode, std::string &trace_record, int trace) {
       else
         --t;
     }
-    if (trace) {
-      mnemonic += ",";
-      mnemonic += ea_description;
-    }
   } else // Postincrement or Control mode
   {
-    if (trace) {
-      mnemonic += ea_description;
-      mnemonic += ",";
+    if ((address & 1) == 0 && count != 0) {
+      if (opcode & 1024)
+        source = space.FindReadMemory(address, count * offset);
+      else
+        destination = space.FindWriteMemory(address, count * offset);
     }
+
     for (unsigned int t = D0_INDEX; t <= A0_INDEX + 7; ++t) {
       if (list & (1 << (t - D0_INDEX))) {
         if ((register_value[SR_INDEX] & S_FLAG) && (t == USP_INDEX))
@@ -3035,19 +2378,23 @@ int m68000::ExecuteMOVEM(int opcode, std::string &trace_record, int trace) {
           reg = t;
 
         if (opcode & 1024) {
-          if ((status = Peek(address, data, size)) != EXECUTE_OK)
+          if (source != nullptr) {
+            data = ReadBigEndian(source, offset);
+            source += offset;
+          } else if ((status = Peek(address, data, size)) != EXECUTE_OK) {
             return (status);
+          }
           SetRegister(reg, data, size);
         } else {
-          if ((status = Poke(address, register_value[reg], size)) != EXECUTE_OK)
+          if (destination != nullptr) {
+            WriteBigEndian(destination, register_value[reg], offset);
+            destination += offset;
+          } else if ((status = Poke(address, register_value[reg], size)) !=
+                     EXECUTE_OK) {
             return (status);
+          }
         }
         address += offset;
-
-        if (trace) {
-          mnemonic += ourRegisterData[reg].name;
-          mnemonic += " ";
-        }
       }
     }
   }
@@ -3059,19 +2406,14 @@ int m68000::ExecuteMOVEM(int opcode, std::string &trace_record, int trace) {
       SetRegister(A0_INDEX + (opcode & 7), address, LONG);
   }
 
-  if (trace) {
-    mnemonic += "}} ";
-    trace_record += mnemonic;
-  }
   return (EXECUTE_OK);
 }
 
 // Execute the 'MOVEP' instruction
-int m68000::ExecuteMOVEP(int opcode, std::string &trace_record, int trace) {
+int m68000::ExecuteMOVEP(int opcode) {
   Register Dn;
   int in_register_flag;
   Address src_address, dest_address;
-  std::string ea_description;
   int status;
 
   // Get the data register we're working with
@@ -3081,9 +2423,9 @@ int m68000::ExecuteMOVEP(int opcode, std::string &trace_record, int trace) {
   case 4: // WORD from Memory to Register
   {
     // Get the source effective address
-    if ((status = ComputeEffectiveAddress(
-             src_address, in_register_flag, ea_description,
-             (0x28 | (opcode & 0x7)), WORD, trace)) != EXECUTE_OK) {
+    if ((status = ComputeEffectiveAddress(src_address, in_register_flag,
+                                          (0x28 | (opcode & 0x7)), WORD)) !=
+        EXECUTE_OK) {
       return status;
     }
 
@@ -3096,22 +2438,15 @@ int m68000::ExecuteMOVEP(int opcode, std::string &trace_record, int trace) {
 
     SetRegister(Dn, (b1 << 8) | b0, WORD);
 
-    if (trace) {
-      trace_record += "{Mnemonic {MOVEP.W ";
-      trace_record += ea_description;
-      trace_record += ",D";
-      trace_record += IntToString(Dn, 1);
-      trace_record += "}} ";
-    }
     break;
   }
 
   case 5: // LONG from Memory to Register
   {
     // Get the source effective address
-    if ((status = ComputeEffectiveAddress(
-             src_address, in_register_flag, ea_description,
-             (0x28 | (opcode & 0x7)), LONG, trace)) != EXECUTE_OK) {
+    if ((status = ComputeEffectiveAddress(src_address, in_register_flag,
+                                          (0x28 | (opcode & 0x7)), LONG)) !=
+        EXECUTE_OK) {
       return (status);
     }
 
@@ -3128,22 +2463,15 @@ int m68000::ExecuteMOVEP(int opcode, std::string &trace_record, int trace) {
 
     SetRegister(Dn, (b3 << 24) | (b2 << 16) | (b1 << 8) | b0, LONG);
 
-    if (trace) {
-      trace_record += "{Mnemonic {MOVEP.L ";
-      trace_record += ea_description;
-      trace_record += ",D";
-      trace_record += IntToString(Dn, 1);
-      trace_record += "}} ";
-    }
     break;
   }
 
   case 6: // WORD from Register to Memory
   {
     // Get the destination address
-    if ((status = ComputeEffectiveAddress(
-             dest_address, in_register_flag, ea_description,
-             (0x28 | (opcode & 0x7)), WORD, trace)) != EXECUTE_OK) {
+    if ((status = ComputeEffectiveAddress(dest_address, in_register_flag,
+                                          (0x28 | (opcode & 0x7)), WORD)) !=
+        EXECUTE_OK) {
       return status;
     }
 
@@ -3154,22 +2482,15 @@ int m68000::ExecuteMOVEP(int opcode, std::string &trace_record, int trace) {
     if ((status = Poke((dest_address + 2), value, BYTE)) != EXECUTE_OK)
       return status;
 
-    if (trace) {
-      trace_record += "{Mnemonic {MOVEP.W D";
-      trace_record += IntToString(Dn, 1);
-      trace_record += ",";
-      trace_record += ea_description;
-      trace_record += "}} ";
-    }
     break;
   }
 
   case 7: // LONG from Register to Memory
   {
     // Get the destination address
-    if ((status = ComputeEffectiveAddress(
-             dest_address, in_register_flag, ea_description,
-             (0x28 | (opcode & 0x7)), LONG, trace)) != EXECUTE_OK) {
+    if ((status = ComputeEffectiveAddress(dest_address, in_register_flag,
+                                          (0x28 | (opcode & 0x7)), LONG)) !=
+        EXECUTE_OK) {
       return (status);
     }
 
@@ -3184,13 +2505,6 @@ int m68000::ExecuteMOVEP(int opcode, std::string &trace_record, int trace) {
     if ((status = Poke((dest_address + 6), value, BYTE)) != EXECUTE_OK)
       return status;
 
-    if (trace) {
-      trace_record += "{Mnemonic {MOVEP.L D";
-      trace_record += IntToString(Dn, 1);
-      trace_record += ",";
-      trace_record += ea_description;
-      trace_record += "}} ";
-    }
     break;
   }
   }
@@ -3199,7 +2513,7 @@ int m68000::ExecuteMOVEP(int opcode, std::string &trace_record, int trace) {
 }
 
 // Execute the 'MOVEQ' instruction
-int m68000::ExecuteMOVEQ(int opcode, std::string &trace_record, int trace) {
+int m68000::ExecuteMOVEQ(int opcode) {
   Register register_number;
   unsigned int data;
 
@@ -3212,26 +2526,19 @@ int m68000::ExecuteMOVEQ(int opcode, std::string &trace_record, int trace) {
   SetConditionCodes(0, 0, data, LONG, OTHER, C_FLAG | V_FLAG | Z_FLAG | N_FLAG);
   SetRegister(register_number, data, LONG);
 
-  if (trace) {
-    trace_record += "{Mnemonic {MOVEQ.L #$";
-    trace_record += IntToString(data, 2);
-    trace_record += ",";
-    trace_record += ourRegisterData[register_number].name;
-    trace_record += "}} ";
-  }
   return (EXECUTE_OK);
 }
 
 // Execute the 'MOVEfromSR' instruction
-int m68000::ExecuteMOVEfromSR(int opcode, std::string &trace_record, int trace) {
+int m68000::ExecuteMOVEfromSR(int opcode) {
   int status, in_register;
   Address address;
-  std::string ea_description;
+
+  EvaluateConditionCodes();
 
   // Get the destination data pointer
-  if ((status = ComputeEffectiveAddress(address, in_register, ea_description,
-                                        opcode & 0x3f, WORD, trace)) !=
-      EXECUTE_OK) {
+  if ((status = ComputeEffectiveAddress(address, in_register, opcode & 0x3f,
+                                        WORD)) != EXECUTE_OK) {
     return (status);
   }
 
@@ -3241,27 +2548,19 @@ int m68000::ExecuteMOVEfromSR(int opcode, std::string &trace_record, int trace)
            EXECUTE_OK)
     return (status);
 
-  if (trace) {
-    trace_record += "{Mnemonic {MOVE.W SR,";
-    trace_record += ea_description;
-    trace_record += "}} ";
-  }
   return (EXECUTE_OK);
 }
 
 // Execute the 'MOVEUSP' instruction
-int m68000::ExecuteMOVEUSP(int opcode, std::string &trace_record, int trace) {
+int m68000::ExecuteMOVEUSP(int opcode) {
   int status, register_number;
-  std::string ea_description;
 
   // Make sure we're in supervisor mode or trap
   if (!(register_value[SR_INDEX] & S_FLAG)) {
     SetRegister(PC_INDEX, register_value[PC_INDEX] - 2, LONG);
     if ((status = ProcessException(8)) != EXECUTE_OK)
       return (status);
-    if (trace)
-      ;
-    trace_record += "{Mnemonic {Privilege Violation Exception}} ";
+    myExceptionMnemonic = "Privilege Violation Exception";
     return (EXECUTE_PRIVILEGED_OK);
   }
 
@@ -3274,37 +2573,24 @@ int m68000::ExecuteMOVEUSP(int opcode, std::string &trace_record, int trace) {
   // Move from or to the USP
   if (opcode & 8) {
     SetRegister(register_number, register_value[USP_INDEX], LONG);
-    if (trace) {
-      ea_description = "USP,";
-      ea_description += ourRegisterData[register_number].name;
-    }
   } else {
     SetRegister(USP_INDEX, register_value[register_number], LONG);
-    if (trace) {
-      ea_description = ourRegisterData[register_number].name;
-      ea_description += ",USP";
-    }
   }
 
-  if (trace) {
-    trace_record += "{Mnemonic {MOVE.L ";
-    trace_record += ea_description;
-    trace_record += "}} ";
-  }
   return (EXECUTE_PRIVILEGED_OK);
 }
 
 // Execute the 'MOVEtoCCR' instruction
-int m68000::ExecuteMOVEtoCCR(int opcode, std::string &trace_record, int trace) {
+int m68000::ExecuteMOVEtoCCR(int opcode) {
   int status, in_register;
   Address address;
   unsigned int data;
-  std::string ea_description;
+
+  EvaluateConditionCodes();
 
   // Get the destination data pointer
-  if ((status = ComputeEffectiveAddress(address, in_register, ea_description,
-                                        opcode & 0x3f, WORD, trace)) !=
-      EXECUTE_OK) {
+  if ((status = ComputeEffectiveAddress(address, in_register, opcode & 0x3f,
+                                        WORD)) != EXECUTE_OK) {
     return (status);
   }
 
@@ -3315,36 +2601,29 @@ int m68000::ExecuteMOVEtoCCR(int opcode, std::string &trace_record, int trace) {
 
   SetRegister(SR_INDEX, data, BYTE);
 
-  if (trace) {
-    trace_record += "{Mnemonic {MOVE.W ";
-    trace_record += ea_description;
-    trace_record += ",CCR}} ";
-  }
   return (EXECUTE_OK);
 }
 
 // Execute the 'MOVEtoSR' instruction
-int m68000::ExecuteMOVEtoSR(int opcode, std::string &trace_record, int trace) {
+int m68000::ExecuteMOVEtoSR(int opcode) {
   int status, in_register;
   Address address;
   unsigned int data;
-  std::string ea_description;
+
+  EvaluateConditionCodes();
 
   // Make sure we're in supervisor mode or trap
   if (!(register_value[SR_INDEX] & S_FLAG)) {
     SetRegister(PC_INDEX, register_value[PC_INDEX] - 2, LONG);
     if ((status = ProcessException(8)) != EXECUTE_OK)
       return (status);
-    if (trace)
-      ;
-    trace_record += "{Mnemonic {Privilege Violation Exception}} ";
+    myExceptionMnemonic = "Privilege Violation Exception";
     return (EXECUTE_PRIVILEGED_OK);
   }
 
   // Get the destination data pointer
-  if ((status = ComputeEffectiveAddress(address, in_register, ea_description,
-                                        opcode & 0x3f, WORD, trace)) !=
-      EXECUTE_OK) {
+  if ((status = ComputeEffectiveAddress(address, in_register, opcode & 0x3f,
+                                        WORD)) != EXECUTE_OK) {
     return (status);
   }
 
@@ -3355,26 +2634,19 @@ int m68000::ExecuteMOVEtoSR(int opcode, std::string &trace_record, int trace) {
 
   SetRegister(SR_INDEX, data, WORD);
 
-  if (trace) {
-    trace_record += "{Mnemonic {MOVE.W ";
-    trace_record += ea_description;
-    trace_record += ",SR}} ";
-  }
   return (EXECUTE_PRIVILEGED_OK);
 }
 
 // Execute the 'MULS' instruction
-int m68000::ExecuteMULS(int opcode, std::string &trace_record, int trace) {
+int m68000::ExecuteMULS(int opcode) {
   int status, in_register_flag;
   Address ea_address, register_number;
   unsigned int ea_data;
   int result, data;
-  std::string ea_description;
 
   // Get the <ea> data address
-  if ((status =
-           ComputeEffectiveAddress(ea_address, in_register_flag, ea_description,
-                                   opcode & 0x3f, WORD, trace)) != EXECUTE_OK) {
+  if ((status = ComputeEffectiveAddress(ea_address, in_register_flag,
+                                        opcode & 0x3f, WORD)) != EXECUTE_OK) {
     return (status);
   }
 
@@ -3388,6 +2660,11 @@ int m68000::ExecuteMULS(int opcode, std::string &trace_record, int trace) {
   register_number = D0_INDEX + ((opcode & 0x0e00) >> 9);
   data = register_value[register_number];
 
+  // Each change between adjacent bits of the multiplier takes two cycles
+  for (unsigned int bits = (ea_data ^ (ea_data << 1)) & 0xffff; bits != 0;
+       bits &= bits - 1)
+    myCycles += 2;
+
   // Sign extend operands
   data = SignExtend(data, WORD);
   ea_data = SignExtend(ea_data, WORD);
@@ -3397,27 +2674,18 @@ int m68000::ExecuteMULS(int opcode, std::string &trace_record, int trace) {
                     V_FLAG | C_FLAG | Z_FLAG | N_FLAG);
   SetRegister(register_number, result, LONG);
 
-  if (trace) {
-    trace_record += "{Mnemonic {MULS.W ";
-    trace_record += ea_description;
-    trace_record += ",";
-    trace_record += ourRegisterData[register_number].name;
-    trace_record += "}} ";
-  }
   return (EXECUTE_OK);
 }
 
 // Execute the 'MULU' instruction
-int m68000::ExecuteMULU(int opcode, std::string &trace_record, int trace) {
+int m68000::ExecuteMULU(int opcode) {
   int status, in_register_flag;
   Address ea_address, register_number;
   unsigned int result, ea_data;
-  std::string ea_description;
 
   // Get the <ea> data address
-  if ((status =
-           ComputeEffectiveAddress(ea_address, in_register_flag, ea_description,
-                                   opcode & 0x3f, WORD, trace)) != EXECUTE_OK) {
+  if ((status = ComputeEffectiveAddress(ea_address, in_register_flag,
+                                        opcode & 0x3f, WORD)) != EXECUTE_OK) {
     return (status);
   }
 
@@ -3427,6 +2695,10 @@ int m68000::ExecuteMULU(int opcode, std::string &trace_record, int trace) {
   else if ((status = Peek(ea_address, ea_data, WORD)) != EXECUTE_OK)
     return (status);
 
+  // Each one bit of the multiplier takes two cycles
+  for (unsigned int bits = ea_data; bits != 0; bits &= bits - 1)
+    myCycles += 2;
+
   // Get the register number
   register_number = D0_INDEX + ((opcode & 0x0e00) >> 9);
 
@@ -3435,34 +2707,25 @@ int m68000::ExecuteMULU(int opcode, std::string &trace_record, int trace) {
                     V_FLAG | C_FLAG | Z_FLAG | N_FLAG);
   SetRegister(register_number, result, LONG);
 
-  if (trace) {
-    trace_record += "{Mnemonic {MULU.W ";
-    trace_record += ea_description;
-    trace_record += ",";
-    trace_record += ourRegisterData[register_number].name;
-    trace_record += "}} ";
-  }
   return (EXECUTE_OK);
 }
 
 // Execute the '' instruction
-int m68000::ExecuteNBCD(int opcode, std::string &trace_record, int trace) {
-  return (ExecuteInvalid(opcode, trace_record, trace));
+int m68000::ExecuteNBCD(int opcode) {
+  return (ExecuteInvalid(opcode));
 }
 
 // Execute the 'NEG' instruction
-int m68000::ExecuteNEG(int opcode, std::string &trace_record, int trace) {
+int m68000::ExecuteNEG(int opcode) {
   int status, size, in_register_flag;
   Address address;
   unsigned int data, result;
-  std::string ea_description;
 
   size = ((opcode & 0x00c0) >> 6);
 
   // Get the effective address
-  if ((status =
-           ComputeEffectiveAddress(address, in_register_flag, ea_description,
-                                   opcode & 0x3f, size, trace)) != EXECUTE_OK) {
+  if ((status = ComputeEffectiveAddress(address, in_register_flag,
+                                        opcode & 0x3f, size)) != EXECUTE_OK) {
     return (status);
   }
 
@@ -3483,33 +2746,21 @@ int m68000::ExecuteNEG(int opcode, std::string &trace_record, int trace) {
   else if ((status = Poke(address, result, size)) != EXECUTE_OK)
     return (status);
 
-  if (trace) {
-    trace_record += "{Mnemonic {NEG";
-    if (size == BYTE)
-      trace_record += ".B ";
-    else if (size == WORD)
-      trace_record += ".W ";
-    else if (size == LONG)
-      trace_record += ".L ";
-    trace_record += ea_description;
-    trace_record += "}} ";
-  }
   return (EXECUTE_OK);
 }
 
 // Execute the 'NEGX' instruction
-int m68000::ExecuteNEGX(int opcode, std::string &trace_record, int trace) {
+int m68000::ExecuteNEGX(int opcode) {
   int status, size, in_register_flag;
   Address address;
   unsigned int data, result;
-  std::string ea_description;
 
+  EvaluateConditionCodes();
   size = ((opcode & 0x00c0) >> 6);
 
   // Get the effective address
-  if ((status =
-           ComputeEffectiveAddress(address, in_register_flag, ea_description,
-                                   opcode & 0x3f, size, trace)) != EXECUTE_OK) {
+  if ((status = ComputeEffectiveAddress(address, in_register_flag,
+                                        opcode & 0x3f, size)) != EXECUTE_OK) {
     return (status);
   }
 
@@ -3526,8 +2777,8 @@ int m68000::ExecuteNEGX(int opcode, std::string &trace_record, int trace) {
   else
     result = 0 - data;
 
-  SetConditionCodes(data, 0, result, size, SUBTRACTION,
-                    C_FLAG | X_FLAG | V_FLAG | N_FLAG);
+  ComputeConditionCodes(data, 0, result, size, SUBTRACTION,
+                        C_FLAG | X_FLAG | V_FLAG | N_FLAG);
   if (size == BYTE)
     result = result & 0xff;
   else if (size == WORD)
@@ -3544,41 +2795,25 @@ int m68000::ExecuteNEGX(int opcode, std::string &trace_record, int trace) {
   else if ((status = Poke(address, result, size)) != EXECUTE_OK)
     return (status);
 
-  if (trace) {
-    trace_record += "{Mnemonic {NEGX";
-    if (size == BYTE)
-      trace_record += ".B ";
-    else if (size == WORD)
-      trace_record += ".W ";
-    else if (size == LONG)
-      trace_record += ".L ";
-    trace_record += ea_description;
-    trace_record += "}} ";
-  }
   return (EXECUTE_OK);
 }
 
 // Execute the 'NOP' instruction  (An instruction I like :-)
-int m68000::ExecuteNOP(int, std::string &trace_record, int trace) {
-  if (trace)
-    trace_record += "{Mnemonic {NOP}}";
-
+int m68000::ExecuteNOP(int) {
   return (EXECUTE_OK);
 }
 
 // Execute the 'NOT' instruction
-int m68000::ExecuteNOT(int opcode, std::string &trace_record, int trace) {
+int m68000::ExecuteNOT(int opcode) {
   int status, size, in_register_flag;
   Address address;
   unsigned int data, result;
-  std::string ea_description;
 
   size = ((opcode & 0x00c0) >> 6);
 
   // Get the effective address
-  if ((status =
-           ComputeEffectiveAddress(address, in_register_flag, ea_description,
-                                   opcode & 0x3f, size, trace)) != EXECUTE_OK) {
+  if ((status = ComputeEffectiveAddress(address, in_register_flag,
+                                        opcode & 0x3f, size)) != EXECUTE_OK) {
     return (status);
   }
 
@@ -3598,33 +2833,20 @@ int m68000::ExecuteNOT(int opcode, std::string &trace_record, int trace) {
   else if ((status = Poke(address, result, size)) != EXECUTE_OK)
     return (status);
 
-  if (trace) {
-    trace_record += "{Mnemonic {NOT";
-    if (size == BYTE)
-      trace_record += ".B ";
-    else if (size == WORD)
-      trace_record += ".W ";
-    else if (size == LONG)
-      trace_record += ".L ";
-    trace_record += ea_description;
-    trace_record += "}} ";
-  }
   return (EXECUTE_OK);
 }
 
 // Execute the 'OR' instruction
-int m68000::ExecuteOR(int opcode, std::string &trace_record, int trace) {
+int m68000::ExecuteOR(int opcode) {
   int status, size, in_register_flag;
   Address ea_address, register_number;
   unsigned int result, ea_data;
-  std::string mnemonic, ea_description;
 
   size = (opcode & 0x00c0) >> 6;
 
   // Get the <ea> data address
-  if ((status =
-           ComputeEffectiveAddress(ea_address, in_register_flag, ea_description,
-                                   opcode & 0x3f, size, trace)) != EXECUTE_OK) {
+  if ((status = ComputeEffectiveAddress(ea_address, in_register_flag,
+                                        opcode & 0x3f, size)) != EXECUTE_OK) {
     return (status);
   }
 
@@ -3637,23 +2859,8 @@ int m68000::ExecuteOR(int opcode, std::string &trace_record, int trace) {
   // Get the register number
   register_number = D0_INDEX + ((opcode & 0x0e00) >> 9);
 
-  if (trace) {
-    mnemonic += "{Mnemonic {OR";
-    if (size == BYTE)
-      mnemonic += ".B ";
-    else if (size == WORD)
-      mnemonic += ".W ";
-    else if (size == LONG)
-      mnemonic += ".L ";
-  }
-
   if (opcode & 0x0100) // <Dn> | <ea> -> <ea>
   {
-    if (trace) {
-      mnemonic += ourRegisterData[register_number].name;
-      mnemonic += ",";
-      mnemonic += ea_description;
-    }
     result = register_value[register_number] | ea_data;
     SetConditionCodes(register_value[register_number], ea_data, result, size,
                       OTHER, V_FLAG | C_FLAG | Z_FLAG | N_FLAG);
@@ -3661,46 +2868,26 @@ int m68000::ExecuteOR(int opcode, std::string &trace_record, int trace) {
       return (status);
   } else // <ea> | <Dn> -> <Dn>
   {
-    if (trace) {
-      mnemonic += ea_description;
-      mnemonic += ",";
-      mnemonic += ourRegisterData[register_number].name;
-    }
     result = ea_data | register_value[register_number];
     SetConditionCodes(ea_data, register_value[register_number], result, size,
                       OTHER, V_FLAG | C_FLAG | Z_FLAG | N_FLAG);
     SetRegister(register_number, result, size);
   }
 
-  if (trace) {
-    mnemonic += "}} ";
-    trace_record += mnemonic;
-  }
   return (EXECUTE_OK);
 }
 
 // Execute the 'ORI' instruction
-int m68000::ExecuteORI(int opcode, std::string &trace_record, int trace) {
+int m68000::ExecuteORI(int opcode) {
   int status, size, in_register;
   Address dest_addr, src_addr;
   unsigned int result, src, dest;
-  std::string mnemonic;
 
   size = (opcode & 0x00c0) >> 6;
 
-  if (trace) {
-    mnemonic += "{Mnemonic {ORI";
-    if (size == BYTE)
-      mnemonic += ".B ";
-    else if (size == WORD)
-      mnemonic += ".W ";
-    else if (size == LONG)
-      mnemonic += ".L ";
-  }
-
   // Get the immediate data pointer
-  if ((status = ComputeEffectiveAddress(src_addr, in_register, mnemonic, 0x3c,
-                                        size, trace)) != EXECUTE_OK) {
+  if ((status = ComputeEffectiveAddress(src_addr, in_register, 0x3c, size)) !=
+      EXECUTE_OK) {
     return (status);
   }
 
@@ -3708,13 +2895,9 @@ int m68000::ExecuteORI(int opcode, std::string &trace_record, int trace) {
   if ((status = Peek(src_addr, src, size)) != EXECUTE_OK)
     return (status);
 
-  if (trace)
-    mnemonic += ",";
-
   // Get the destination data pointer
-  if ((status = ComputeEffectiveAddress(dest_addr, in_register, mnemonic,
-                                        opcode & 0x3f, size, trace)) !=
-      EXECUTE_OK) {
+  if ((status = ComputeEffectiveAddress(dest_addr, in_register, opcode & 0x3f,
+                                        size)) != EXECUTE_OK) {
     return (status);
   }
 
@@ -3734,26 +2917,20 @@ int m68000::ExecuteORI(int opcode, std::string &trace_record, int trace) {
       return (status);
   }
 
-  if (trace) {
-    mnemonic += "}} ";
-    trace_record += mnemonic;
-  }
   return (EXECUTE_OK);
 }
 
 // Execute the 'ORItoCCR' instruction
-int m68000::ExecuteORItoCCR(int, std::string &trace_record, int trace) {
+int m68000::ExecuteORItoCCR(int) {
   int status, in_register_flag;
   Address src_addr;
   unsigned int src;
-  std::string mnemonic;
 
-  if (trace)
-    mnemonic += "{Mnemonic {ORI.B ";
+  EvaluateConditionCodes();
 
   // Get the immediate data pointer
-  if ((status = ComputeEffectiveAddress(src_addr, in_register_flag, mnemonic,
-                                        0x3c, BYTE, trace)) != EXECUTE_OK) {
+  if ((status = ComputeEffectiveAddress(src_addr, in_register_flag, 0x3c,
+                                        BYTE)) != EXECUTE_OK) {
     return (status);
   }
 
@@ -3762,37 +2939,29 @@ int m68000::ExecuteORItoCCR(int, std::string &trace_record, int trace) {
     return (status);
 
   SetRegister(SR_INDEX, register_value[SR_INDEX] | src, BYTE);
-  if (trace) {
-    mnemonic += ",CCR}} ";
-    trace_record += mnemonic;
-  }
   return (EXECUTE_OK);
 }
 
 // Execute the 'ORItoSR' instruction
-int m68000::ExecuteORItoSR(int, std::string &trace_record, int trace) {
+int m68000::ExecuteORItoSR(int) {
   int status, in_register_flag;
   Address src_addr;
   unsigned int src;
-  std::string mnemonic;
+
+  EvaluateConditionCodes();
 
   // Make sure we're in supervisor mode or trap
   if (!(register_value[SR_INDEX] & S_FLAG)) {
     SetRegister(PC_INDEX, register_value[PC_INDEX] - 2, LONG);
     if ((status = ProcessException(8)) != EXECUTE_OK)
       return (status);
-    if (trace)
-      ;
-    trace_record += "{Mnemonic {Privilege Violation Exception}} ";
+    myExceptionMnemonic = "Privilege Violation Exception";
     return (EXECUTE_PRIVILEGED_OK);
   }
 
-  if (trace)
-    mnemonic += "{Mnemonic {ORI.W ";
-
   // Get the immediate data pointer
-  if ((status = ComputeEffectiveAddress(src_addr, in_register_flag, mnemonic,
-                                        0x3c, WORD, trace)) != EXECUTE_OK) {
+  if ((status = ComputeEffectiveAddress(src_addr, in_register_flag, 0x3c,
+                                        WORD)) != EXECUTE_OK) {
     return (status);
   }
 
@@ -3802,23 +2971,17 @@ int m68000::ExecuteORItoSR(int, std::string &trace_record, int trace) {
 
   SetRegister(SR_INDEX, register_value[SR_INDEX] | src, WORD);
 
-  if (trace) {
-    mnemonic += ",SR}} ";
-    trace_record += mnemonic;
-  }
   return (EXECUTE_PRIVILEGED_OK);
 }
 
 // Execute the 'PEA' instruction
-int m68000::ExecutePEA(int opcode, std::string &trace_record, int trace) {
+int m68000::ExecutePEA(int opcode) {
   int status, in_register_flag, stack_index;
   Address address;
-  std::string ea_description;
 
   // Get the effective address
-  if ((status =
-           ComputeEffectiveAddress(address, in_register_flag, ea_description,
-                                   opcode & 0x3f, LONG, trace)) != EXECUTE_OK) {
+  if ((status = ComputeEffectiveAddress(address, in_register_flag,
+                                        opcode & 0x3f, LONG)) != EXECUTE_OK) {
     return (status);
   }
 
@@ -3833,16 +2996,11 @@ int m68000::ExecutePEA(int opcode, std::string &trace_record, int trace) {
   if ((status = Poke(register_value[stack_index], address, LONG)) != EXECUTE_OK)
     return (status);
 
-  if (trace) {
-    trace_record += "{Mnemonic {PEA.L ";
-    trace_record += ea_description;
-    trace_record += "}} ";
-  }
   return (EXECUTE_OK);
 }
 
 // Execute the 'RESET' instruction
-int m68000::ExecuteRESET(int, std::string &trace_record, int trace) {
+int m68000::ExecuteRESET(int) {
   int status;
 
   // Make sure we're in supervisor mode or trap
@@ -3850,28 +3008,23 @@ int m68000::ExecuteRESET(int, std::string &trace_record, int trace) {
     SetRegister(PC_INDEX, register_value[PC_INDEX] - 2, LONG);
     if ((status = ProcessException(8)) != EXECUTE_OK)
       return (status);
-    if (trace)
-      ;
-    trace_record += "{Mnemonic {Privilege Violation Exception}} ";
+    myExceptionMnemonic = "Privilege Violation Exception";
     return (EXECUTE_PRIVILEGED_OK);
   }
 
   // Tell the AddressSpace to reset all of the attached devices
   myAddressSpaces[0]->Reset();
 
-  if (trace)
-    trace_record += "{Mnemonic {RESET}} ";
-
   return (EXECUTE_PRIVILEGED_OK);
 }
 
 // Execute the 'ROL' instruction
-int m68000::ExecuteROL(int opcode, std::string &trace_record, int trace) {
+int m68000::ExecuteROL(int opcode) {
   int status, size, in_register_flag, shift_count;
   Address address;
   unsigned int data;
-  std::string ea_description;
 
+  EvaluateConditionCodes();
   size = (opcode & 0x00c0) >> 6;
 
   // Check to see if this is a memory or register rotate
@@ -3880,8 +3033,7 @@ int m68000::ExecuteROL(int opcode, std::string &trace_record, int trace) {
 
     // Get the address
     if ((status = ComputeEffectiveAddress(address, in_register_flag,
-                                          ea_description, opcode & 0x3f, size,
-                                          trace)) != EXECUTE_OK) {
+                                          opcode & 0x3f, size)) != EXECUTE_OK) {
       return (status);
     }
 
@@ -3899,31 +3051,19 @@ int m68000::ExecuteROL(int opcode, std::string &trace_record, int trace) {
     if ((status = Poke(address, data, size)) != EXECUTE_OK)
       return (status);
 
-    SetConditionCodes(0, 0, data, size, OTHER,
-                      N_FLAG | Z_FLAG | C_FLAG | V_FLAG);
+    ComputeConditionCodes(0, 0, data, size, OTHER,
+                          N_FLAG | Z_FLAG | C_FLAG | V_FLAG);
     if (data & 0x0001)
       register_value[SR_INDEX] |= C_FLAG;
   } else {
     // Compute the shift count
     if (opcode & 32) {
       shift_count = register_value[D0_INDEX + ((opcode & 0x0e00) >> 9)] & 0x3f;
-      if (trace)
-        ea_description =
-            ourRegisterData[D0_INDEX + ((opcode & 0x0e00) >> 9)].name;
     } else {
       if ((shift_count = (opcode & 0x0e00) >> 9) == 0)
         shift_count = 8;
-
-      if (trace) {
-        ea_description = "#$";
-        ea_description += IntToString(shift_count, 1);
-      }
-    }
-
-    if (trace) {
-      ea_description += ",";
-      ea_description += ourRegisterData[D0_INDEX + (opcode & 7)].name;
     }
+    myCycles += 2 * shift_count;
 
     unsigned int msb;
 
@@ -3946,33 +3086,22 @@ int m68000::ExecuteROL(int opcode, std::string &trace_record, int trace) {
 
     SetRegister(D0_INDEX + (opcode & 7), data, size);
 
-    SetConditionCodes(0, 0, data, size, OTHER,
-                      N_FLAG | Z_FLAG | C_FLAG | V_FLAG);
+    ComputeConditionCodes(0, 0, data, size, OTHER,
+                          N_FLAG | Z_FLAG | C_FLAG | V_FLAG);
     if (data & 1)
       register_value[SR_INDEX] |= C_FLAG;
   }
 
-  if (trace) {
-    trace_record += "{Mnemonic {ROL";
-    if (size == BYTE)
-      trace_record += ".B ";
-    else if (size == WORD)
-      trace_record += ".W ";
-    else if (size == LONG)
-      trace_record += ".L ";
-    trace_record += ea_description;
-    trace_record += "}} ";
-  }
   return (EXECUTE_OK);
 }
 
 // Execute the 'ROR' instruction
-int m68000::ExecuteROR(int opcode, std::string &trace_record, int trace) {
+int m68000::ExecuteROR(int opcode) {
   int status, size, in_register_flag, shift_count;
   Address address;
   unsigned int data;
-  std::string ea_description;
 
+  EvaluateConditionCodes();
   size = (opcode & 0x00c0) >> 6;
 
   // Check to see if this is a memory or register rotate
@@ -3981,8 +3110,7 @@ int m68000::ExecuteROR(int opcode, std::string &trace_record, int trace) {
 
     // Get the address
     if ((status = ComputeEffectiveAddress(address, in_register_flag,
-                                          ea_description, opcode & 0x3f, size,
-                                          trace)) != EXECUTE_OK) {
+                                          opcode & 0x3f, size)) != EXECUTE_OK) {
       return (status);
     }
 
@@ -4001,31 +3129,19 @@ int m68000::ExecuteROR(int opcode, std::string &trace_record, int trace) {
       return (status);
 
     // Set the condition codes
-    SetConditionCodes(0, 0, data, size, OTHER,
-                      N_FLAG | Z_FLAG | C_FLAG | V_FLAG);
+    ComputeConditionCodes(0, 0, data, size, OTHER,
+                          N_FLAG | Z_FLAG | C_FLAG | V_FLAG);
     if (data & 0x8000)
       register_value[SR_INDEX] |= C_FLAG;
   } else {
     // Compute the shift count
     if (opcode & 32) {
       shift_count = register_value[D0_INDEX + ((opcode & 0x0e00) >> 9)] & 0x3f;
-      if (trace)
-        ea_description =
-            ourRegisterData[D0_INDEX + ((opcode & 0x0e00) >> 9)].name;
     } else {
       if ((shift_count = (opcode & 0x0e00) >> 9) == 0)
         shift_count = 8;
-
-      if (trace) {
-        ea_description = "#$";
-        ea_description += IntToString(shift_count, 1);
-      }
-    }
-
-    if (trace) {
-      ea_description += ",";
-      ea_description += ourRegisterData[D0_INDEX + (opcode & 7)].name;
     }
+    myCycles += 2 * shift_count;
 
     unsigned int msb;
 
@@ -4048,33 +3164,22 @@ int m68000::ExecuteROR(int opcode, std::string &trace_record, int trace) {
 
     SetRegister(D0_INDEX + (opcode & 7), data, size);
 
-    SetConditionCodes(0, 0, data, size, OTHER,
-                      N_FLAG | Z_FLAG | C_FLAG | V_FLAG);
+    ComputeConditionCodes(0, 0, data, size, OTHER,
+                          N_FLAG | Z_FLAG | C_FLAG | V_FLAG);
     if (data & msb)
       register_value[SR_INDEX] |= C_FLAG;
   }
 
-  if (trace) {
-    trace_record += "{Mnemonic {ROR";
-    if (size == BYTE)
-      trace_record += ".B ";
-    else if (size == WORD)
-      trace_record += ".W ";
-    else if (size == LONG)
-      trace_record += ".L ";
-    trace_record += ea_description;
-    trace_record += "}} ";
-  }
   return (EXECUTE_OK);
 }
 
 // Execute the 'ROXL' instruction
-int m68000::ExecuteROXL(int opcode, std::string &trace_record, int trace) {
+int m68000::ExecuteROXL(int opcode) {
   int status, size, in_register_flag, shift_count;
   Address address;
   unsigned int data;
-  std::string ea_description;
 
+  EvaluateConditionCodes();
   size = (opcode & 0x00c0) >> 6;
 
   // Check to see if this is a memory or register rotate
@@ -4083,8 +3188,7 @@ int m68000::ExecuteROXL(int opcode, std::string &trace_record, int trace) {
 
     // Get the address
     if ((status = ComputeEffectiveAddress(address, in_register_flag,
-                                          ea_description, opcode & 0x3f, size,
-                                          trace)) != EXECUTE_OK) {
+                                          opcode & 0x3f, size)) != EXECUTE_OK) {
       return (status);
     }
 
@@ -4102,8 +3206,8 @@ int m68000::ExecuteROXL(int opcode, std::string &trace_record, int trace) {
     if ((status = Poke(address, data, size)) != EXECUTE_OK)
       return (status);
 
-    SetConditionCodes(0, 0, data, size, OTHER,
-                      N_FLAG | Z_FLAG | C_FLAG | X_FLAG | V_FLAG);
+    ComputeConditionCodes(0, 0, data, size, OTHER,
+                          N_FLAG | Z_FLAG | C_FLAG | X_FLAG | V_FLAG);
     if (data & 0x00010000) {
       register_value[SR_INDEX] |= C_FLAG;
       register_value[SR_INDEX] |= X_FLAG;
@@ -4112,23 +3216,11 @@ int m68000::ExecuteROXL(int opcode, std::string &trace_record, int trace) {
     // Compute the shift count
     if (opcode & 32) {
       shift_count = register_value[D0_INDEX + ((opcode & 0x0e00) >> 9)] & 0x3f;
-      if (trace)
-        ea_description =
-            ourRegisterData[D0_INDEX + ((opcode & 0x0e00) >> 9)].name;
     } else {
       if ((shift_count = (opcode & 0x0e00) >> 9) == 0)
         shift_count = 8;
-
-      if (trace) {
-        ea_description = "#$";
-        ea_description += IntToString(shift_count, 1);
-      }
-    }
-
-    if (trace) {
-      ea_description += ",";
-      ea_description += ourRegisterData[D0_INDEX + (opcode & 7)].name;
     }
+    myCycles += 2 * shift_count;
 
     unsigned int msb, extend;
 
@@ -4157,35 +3249,24 @@ int m68000::ExecuteROXL(int opcode, std::string &trace_record, int trace) {
 
     SetRegister(D0_INDEX + (opcode & 7), data, size);
 
-    SetConditionCodes(0, 0, data, size, OTHER,
-                      N_FLAG | Z_FLAG | X_FLAG | C_FLAG | V_FLAG);
+    ComputeConditionCodes(0, 0, data, size, OTHER,
+                          N_FLAG | Z_FLAG | X_FLAG | C_FLAG | V_FLAG);
     if (extend) {
       register_value[SR_INDEX] |= C_FLAG;
       register_value[SR_INDEX] |= X_FLAG;
     }
   }
 
-  if (trace) {
-    trace_record += "{Mnemonic {ROXL";
-    if (size == BYTE)
-      trace_record += ".B ";
-    else if (size == WORD)
-      trace_record += ".W ";
-    else if (size == LONG)
-      trace_record += ".L ";
-    trace_record += ea_description;
-    trace_record += "}} ";
-  }
   return (EXECUTE_OK);
 }
 
 // Execute the 'ROXR' instruction
-int m68000::ExecuteROXR(int opcode, std::string &trace_record, int trace) {
+int m68000::ExecuteROXR(int opcode) {
   int status, size, in_register_flag, shift_count;
   Address address;
   unsigned int data;
-  std::string ea_description;
 
+  EvaluateConditionCodes();
   size = (opcode & 0x00c0) >> 6;
 
   // Check to see if this is a memory or register rotate
@@ -4194,8 +3275,7 @@ int m68000::ExecuteROXR(int opcode, std::string &trace_record, int trace) {
 
     // Get the address
     if ((status = ComputeEffectiveAddress(address, in_register_flag,
-                                          ea_description, opcode & 0x3f, size,
-                                          trace)) != EXECUTE_OK) {
+                                          opcode & 0x3f, size)) != EXECUTE_OK) {
       return (status);
     }
 
@@ -4217,8 +3297,8 @@ int m68000::ExecuteROXR(int opcode, std::string &trace_record, int trace) {
       return (status);
 
     // Set the condition codes
-    SetConditionCodes(0, 0, data, size, OTHER,
-                      N_FLAG | Z_FLAG | X_FLAG | C_FLAG | V_FLAG);
+    ComputeConditionCodes(0, 0, data, size, OTHER,
+                          N_FLAG | Z_FLAG | X_FLAG | C_FLAG | V_FLAG);
     if (carry) {
       register_value[SR_INDEX] |= C_FLAG;
       register_value[SR_INDEX] |= X_FLAG;
@@ -4227,23 +3307,11 @@ int m68000::ExecuteROXR(int opcode, std::string &trace_record, int trace) {
     // Compute the shift count
     if (opcode & 32) {
       shift_count = register_value[D0_INDEX + ((opcode & 0x0e00) >> 9)] & 0x3f;
-      if (trace)
-        ea_description =
-            ourRegisterData[D0_INDEX + ((opcode & 0x0e00) >> 9)].name;
     } else {
       if ((shift_count = (opcode & 0x0e00) >> 9) == 0)
         shift_count = 8;
-
-      if (trace) {
-        ea_description = "#$";
-        ea_description += IntToString(shift_count, 1);
-      }
-    }
-
-    if (trace) {
-      ea_description += ",";
-      ea_description += ourRegisterData[D0_INDEX + (opcode & 7)].name;
     }
+    myCycles += 2 * shift_count;
 
     unsigned int msb, extend;
 
@@ -4271,41 +3339,30 @@ int m68000::ExecuteROXR(int opcode, std::string &trace_record, int trace) {
 
     SetRegister(D0_INDEX + (opcode & 7), data, size);
 
-    SetConditionCodes(0, 0, data, size, OTHER,
-                      N_FLAG | Z_FLAG | X_FLAG | C_FLAG | V_FLAG);
+    ComputeConditionCodes(0, 0, data, size, OTHER,
+                          N_FLAG | Z_FLAG | X_FLAG | C_FLAG | V_FLAG);
     if (extend) {
       register_value[SR_INDEX] |= C_FLAG;
       register_value[SR_INDEX] |= X_FLAG;
     }
   }
 
-  if (trace) {
-    trace_record += "{Mnemonic {ROXR";
-    if (size == BYTE)
-      trace_record += ".B ";
-    else if (size == WORD)
-      trace_record += ".W ";
-    else if (size == LONG)
-      trace_record += ".L ";
-    trace_record += ea_description;
-    trace_record += "}} ";
-  }
   return (EXECUTE_OK);
 }
 
 // Execute the 'RTE' instruction
-int m68000::ExecuteRTE(int, std::string &trace_record, int trace) {
+int m68000::ExecuteRTE(int) {
   int status;
   unsigned int sr, pc;
 
+  EvaluateConditionCodes();
+
   // Make sure we're in supervisor mode or trap
   if (!(register_value[SR_INDEX] & S_FLAG)) {
     SetRegister(PC_INDEX, register_value[PC_INDEX] - 2, LONG);
     if ((status = ProcessException(8)) != EXECUTE_OK)
       return (status);
-    if (trace)
-      ;
-    trace_record += "{Mnemonic {Privilege Violation Exception}} ";
+    myExceptionMnemonic = "Privilege Violation Exception";
     return (EXECUTE_PRIVILEGED_OK);
   }
 
@@ -4323,18 +3380,17 @@ int m68000::ExecuteRTE(int, std::string &trace_record, int trace) {
   SetRegister(SSP_INDEX, register_value[SSP_INDEX] + 4, LONG);
   SetRegister(PC_INDEX, pc, LONG);
 
-  if (trace)
-    trace_record += "{Mnemonic {RTE}} ";
-
   return (EXECUTE_PRIVILEGED_OK);
 }
 
 // Execute the 'RTR' instruction
-int m68000::ExecuteRTR(int, std::string &trace_record, int trace) {
+int m68000::ExecuteRTR(int) {
   int status;
   unsigned int ccr, pc;
   int stackRegister;
 
+  EvaluateConditionCodes();
+
   // Determine which stack pointer to use
   if (register_value[SR_INDEX] & S_FLAG)
     stackRegister = SSP_INDEX;
@@ -4355,14 +3411,11 @@ int m68000::ExecuteRTR(int, std::string &trace_record, int trace) {
   SetRegister(stackRegister, register_value[stackRegister] + 4, LONG);
   SetRegister(PC_INDEX, pc, LONG);
 
-  if (trace)
-    trace_record += "{Mnemonic {RTR}} ";
-
   return (EXECUTE_OK);
 }
 
 // Execute the 'RTS' instruction
-int m68000::ExecuteRTS(int, std::string &trace_record, int trace) {
+int m68000::ExecuteRTS(int) {
   int status;
   unsigned int pc;
   int stackRegister;
@@ -4380,22 +3433,20 @@ int m68000::ExecuteRTS(int, std::string &trace_record, int trace) {
   SetRegister(stackRegister, register_value[stackRegister] + 4, LONG);
   SetRegister(PC_INDEX, pc, LONG);
 
-  if (trace)
-    trace_record += "{Mnemonic {RTS}} ";
-
   return (EXECUTE_OK);
 }
 
 // Execute the '' instruction
-int m68000::ExecuteSBCD(int opcode, std::string &trace_record, int trace) {
-  return (ExecuteInvalid(opcode, trace_record, trace));
+int m68000::ExecuteSBCD(int opcode) {
+  return (ExecuteInvalid(opcode));
 }
 
 // Execute the 'STOP' instruction
-int m68000::ExecuteSTOP(int, std::string &trace_record, int trace) {
+int m68000::ExecuteSTOP(int) {
   unsigned int newStatusRegister;
   int status;
-  std::string mnemonic;
+
+  EvaluateConditionCodes();
 
   // Fetch the 16-bit immediate data
   status = Peek(register_value[PC_INDEX], newStatusRegister, WORD);
@@ -4412,48 +3463,37 @@ int m68000::ExecuteSTOP(int, std::string &trace_record, int trace) {
   if (!(register_value[SR_INDEX] & S_FLAG)) {
     if ((status = ProcessException(8)) != EXECUTE_OK)
       return (status);
-    if (trace)
-      trace_record += "{Mnemonic {Privilege Violation Exception}} ";
+    myExceptionMnemonic = "Privilege Violation Exception";
     return (EXECUTE_PRIVILEGED_OK);
   }
 
   // Stop the processor
   myState = STOP_STATE;
 
-  if (trace) {
-    trace_record += "{Mnemonic {STOP #$";
-    trace_record += IntToString(newStatusRegister, 4);
-    trace_record += "}} ";
-  }
   return (EXECUTE_PRIVILEGED_OK);
 }
 
 // Execute the 'BREAK' instruction
-int m68000::ExecuteBREAK(int, std::string &trace_record, int trace) {
+int m68000::ExecuteBREAK(int) {
 
   // Put the processor in our "fake" break state so the simulator will
   // stop running a program.
   myState = BREAK_STATE;
 
-  if (trace)
-    trace_record += "{Mnemonic {BREAK}} ";
-
   return (EXECUTE_OK);
 }
 
 // Execute the 'SUB' instruction
-int m68000::ExecuteSUB(int opcode, std::string &trace_record, int trace) {
+int m68000::ExecuteSUB(int opcode) {
   int status, size, in_register_flag;
   Address ea_address, register_number;
   unsigned int result, ea_data;
-  std::string mnemonic, ea_description;
 
   size = (opcode & 0x00c0) >> 6;
 
   // Get the <ea> data address
-  if ((status =
-           ComputeEffectiveAddress(ea_address, in_register_flag, ea_description,
-                                   opcode & 0x3f, size, trace)) != EXECUTE_OK) {
+  if ((status = ComputeEffectiveAddress(ea_address, in_register_flag,
+                                        opcode & 0x3f, size)) != EXECUTE_OK) {
     return (status);
   }
 
@@ -4466,23 +3506,8 @@ int m68000::ExecuteSUB(int opcode, std::string &trace_record, int trace) {
   // Get the register number
   register_number = D0_INDEX + ((opcode & 0x0e00) >> 9);
 
-  if (trace) {
-    mnemonic += "{Mnemonic {SUB";
-    if (size == BYTE)
-      mnemonic += ".B ";
-    else if (size == WORD)
-      mnemonic += ".W ";
-    else if (size == LONG)
-      mnemonic += ".L ";
-  }
-
   if (opcode & 0x0100) // <ea> - <Dn> -> <ea>
   {
-    if (trace) {
-      mnemonic += ourRegisterData[register_number].name;
-      mnemonic += ",";
-      mnemonic += ea_description;
-    }
     result = ea_data - register_value[register_number];
     SetConditionCodes(register_value[register_number], ea_data, result, size,
                       SUBTRACTION, C_FLAG | V_FLAG | Z_FLAG | N_FLAG | X_FLAG);
@@ -4490,30 +3515,20 @@ int m68000::ExecuteSUB(int opcode, std::string &trace_record, int trace) {
       return (status);
   } else // <Dn> - <ea> -> <Dn>
   {
-    if (trace) {
-      mnemonic += ea_description;
-      mnemonic += ",";
-      mnemonic += ourRegisterData[register_number].name;
-    }
     result = register_value[register_number] - ea_data;
     SetConditionCodes(ea_data, register_value[register_number], result, size,
                       SUBTRACTION, C_FLAG | V_FLAG | Z_FLAG | N_FLAG | X_FLAG);
     SetRegister(register_number, result, size);
   }
 
-  if (trace) {
-    mnemonic += "}} ";
-    trace_record += mnemonic;
-  }
   return (EXECUTE_OK);
 }
 
 // Execute the 'SUBA' instruction
-int m68000::ExecuteSUBA(int opcode, std::string &trace_record, int trace) {
+int m68000::ExecuteSUBA(int opcode) {
   int status, size, in_register_flag;
   Address ea_address, register_number;
   unsigned int result, ea_data;
-  std::string ea_description;
 
   if (opcode & 0x0100)
     size = LONG;
@@ -4521,9 +3536,8 @@ int m68000::ExecuteSUBA(int opcode, std::string &trace_record, int trace) {
     size = WORD;
 
   // Get the <ea> data address
-  if ((status =
-           ComputeEffectiveAddress(ea_address, in_register_flag, ea_description,
-                                   opcode & 0x3f, size, trace)) != EXECUTE_OK) {
+  if ((status = ComputeEffectiveAddress(ea_address, in_register_flag,
+                                        opcode & 0x3f, size)) != EXECUTE_OK) {
     return (status);
   }
 
@@ -4545,42 +3559,20 @@ int m68000::ExecuteSUBA(int opcode, std::string &trace_record, int trace) {
   result = register_value[register_number] - ea_data;
   SetRegister(register_number, result, LONG);
 
-  if (trace) {
-    trace_record += "{Mnemonic {SUBA";
-    if (size == WORD)
-      trace_record += ".W ";
-    else if (size == LONG)
-      trace_record += ".L ";
-    trace_record += ea_description;
-    trace_record += ",";
-    trace_record += ourRegisterData[register_number].name;
-    trace_record += "}} ";
-  }
   return (EXECUTE_OK);
 }
 
 // Execute the 'SUBI' instruction
-int m68000::ExecuteSUBI(int opcode, std::string &trace_record, int trace) {
+int m68000::ExecuteSUBI(int opcode) {
   int status, size, in_register;
   Address dest_addr, src_addr;
   unsigned int result, src, dest;
-  std::string mnemonic;
 
   size = (opcode & 0x00c0) >> 6;
 
-  if (trace) {
-    mnemonic += "{Mnemonic {SUBI";
-    if (size == BYTE)
-      mnemonic += ".B ";
-    else if (size == WORD)
-      mnemonic += ".W ";
-    else if (size == LONG)
-      mnemonic += ".L ";
-  }
-
   // Get the immediate data pointer
-  if ((status = ComputeEffectiveAddress(src_addr, in_register, mnemonic, 0x3c,
-                                        size, trace)) != EXECUTE_OK) {
+  if ((status = ComputeEffectiveAddress(src_addr, in_register, 0x3c, size)) !=
+      EXECUTE_OK) {
     return (status);
   }
 
@@ -4588,13 +3580,9 @@ int m68000::ExecuteSUBI(int opcode, std::string &trace_record, int trace) {
   if ((status = Peek(src_addr, src, size)) != EXECUTE_OK)
     return (status);
 
-  if (trace)
-    mnemonic += ",";
-
   // Get the destination data pointer
-  if ((status = ComputeEffectiveAddress(dest_addr, in_register, mnemonic,
-                                        opcode & 0x3f, size, trace)) !=
-      EXECUTE_OK) {
+  if ((status = ComputeEffectiveAddress(dest_addr, in_register, opcode & 0x3f,
+                                        size)) != EXECUTE_OK) {
     return (status);
   }
 
@@ -4614,19 +3602,14 @@ int m68000::ExecuteSUBI(int opcode, std::string &trace_record, int trace) {
       return (status);
   }
 
-  if (trace) {
-    mnemonic += "}} ";
-    trace_record += mnemonic;
-  }
   return (EXECUTE_OK);
 }
 
 // Execute the 'SUBQ' instruction
-int m68000::ExecuteSUBQ(int opcode, std::string &trace_record, int trace) {
+int m68000::ExecuteSUBQ(int opcode) {
   int status, size, in_register_flag;
   Address ea_address, immediate_data;
   unsigned int result, ea_data;
-  std::string ea_description;
 
   size = (opcode & 0x00c0) >> 6;
 
@@ -4635,9 +3618,8 @@ int m68000::ExecuteSUBQ(int opcode, std::string &trace_record, int trace) {
     immediate_data = 8;
 
   // Get the <ea> data address
-  if ((status =
-           ComputeEffectiveAddress(ea_address, in_register_flag, ea_description,
-                                   opcode & 0x3f, size, trace)) != EXECUTE_OK) {
+  if ((status = ComputeEffectiveAddress(ea_address, in_register_flag,
+                                        opcode & 0x3f, size)) != EXECUTE_OK) {
     return (status);
   }
 
@@ -4664,56 +3646,29 @@ int m68000::ExecuteSUBQ(int opcode, std::string &trace_record, int trace) {
       return (status);
   }
 
-  if (trace) {
-    trace_record += "{Mnemonic {SUBQ";
-    if (size == BYTE)
-      trace_record += ".B ";
-    else if (size == WORD)
-      trace_record += ".W ";
-    else if (size == LONG)
-      trace_record += ".L ";
-    trace_record += "#$";
-    trace_record += IntToString(immediate_data, 1);
-    trace_record += ",";
-    trace_record += ea_description;
-    trace_record += "}} ";
-  }
   return (EXECUTE_OK);
 }
 
 // Execute the 'SUBX' instruction
-int m68000::ExecuteSUBX(int opcode, std::string &trace_record, int trace) {
+int m68000::ExecuteSUBX(int opcode) {
   int status, size, in_register_flag;
   Address src_address, dest_address;
   unsigned int result, src, dest;
-  std::string mnemonic;
 
+  EvaluateConditionCodes();
   size = (opcode & 0x00c0) >> 6;
 
-  if (trace) {
-    mnemonic += "{Mnemonic {SUBX";
-    if (size == BYTE)
-      mnemonic += ".B ";
-    else if (size == WORD)
-      mnemonic += ".W ";
-    else if (size == LONG)
-      mnemonic += ".L ";
-  }
-
   // Get the addresses
   if (opcode & 8) {
     if ((status = ComputeEffectiveAddress(src_address, in_register_flag,
-                                          mnemonic, 0x20 | (opcode & 7), size,
-                                          trace)) != EXECUTE_OK) {
+                                          0x20 | (opcode & 7), size)) !=
+        EXECUTE_OK) {
       return (status);
     }
 
-    if (trace)
-      mnemonic += ",";
-
-    if ((status = ComputeEffectiveAddress(
-             dest_address, in_register_flag, mnemonic,
-             0x20 | ((opcode & 0x0e00) >> 9), size, trace)) != EXECUTE_OK) {
+    if ((status = ComputeEffectiveAddress(dest_address, in_register_flag,
+                                          0x20 | ((opcode & 0x0e00) >> 9),
+                                          size)) != EXECUTE_OK) {
       return (status);
     }
 
@@ -4726,11 +3681,6 @@ int m68000::ExecuteSUBX(int opcode, std::string &trace_record, int trace) {
     src = register_value[src_address];
     dest_address = D0_INDEX + ((opcode & 0x0e00) >> 9);
     dest = register_value[dest_address];
-    if (trace) {
-      mnemonic += ourRegisterData[src_address].name;
-      mnemonic += ",";
-      mnemonic += ourRegisterData[dest_address].name;
-    }
   }
 
   if (register_value[SR_INDEX] & X_FLAG)
@@ -4745,8 +3695,8 @@ int m68000::ExecuteSUBX(int opcode, std::string &trace_record, int trace) {
   else if (size == LONG)
     result = result & 0xffffffff;
 
-  SetConditionCodes(src, dest, result, size, SUBTRACTION,
-                    C_FLAG | V_FLAG | N_FLAG | X_FLAG);
+  ComputeConditionCodes(src, dest, result, size, SUBTRACTION,
+                        C_FLAG | V_FLAG | N_FLAG | X_FLAG);
   if (result)
     register_value[SR_INDEX] &= ~Z_FLAG;
 
@@ -4757,15 +3707,11 @@ int m68000::ExecuteSUBX(int opcode, std::string &trace_record, int trace) {
     SetRegister(dest_address, result, size);
   }
 
-  if (trace) {
-    mnemonic += "}} ";
-    trace_record += mnemonic;
-  }
   return (EXECUTE_OK);
 }
 
 // Execute the 'SWAP' instruction
-int m68000::ExecuteSWAP(int opcode, std::string &trace_record, int trace) {
+int m68000::ExecuteSWAP(int opcode) {
   int register_number;
   unsigned int data;
 
@@ -4774,63 +3720,48 @@ int m68000::ExecuteSWAP(int opcode, std::string &trace_record, int trace) {
   data = ((data >> 16) & 0xffff) | ((data << 16) & 0xffff0000);
   SetRegister(register_number, data, LONG);
   SetConditionCodes(0, 0, data, LONG, OTHER, C_FLAG | V_FLAG | Z_FLAG | N_FLAG);
-  if (trace) {
-    trace_record += "{Mnemonic {SWAP.W ";
-    trace_record += ourRegisterData[register_number].name;
-    trace_record += "}} ";
-  }
   return (EXECUTE_OK);
 }
 
 // Execute the 'Scc' instruction
-int m68000::ExecuteScc(int opcode, std::string &trace_record, int trace) {
+int m68000::ExecuteScc(int opcode) {
   int status, in_register_flag;
   Address address;
   unsigned int result;
-  std::string mnemonic, ea_description;
-
-  if (trace)
-    trace_record += "{Mnemonic {S";
 
   // Get the effective address
-  if ((status =
-           ComputeEffectiveAddress(address, in_register_flag, ea_description,
-                                   opcode & 0x3f, BYTE, trace)) != EXECUTE_OK) {
+  if ((status = ComputeEffectiveAddress(address, in_register_flag,
+                                        opcode & 0x3f, BYTE)) != EXECUTE_OK) {
     return (status);
   }
 
   // Check to see if the result should be all 1's or 0's
-  if (CheckConditionCodes((opcode & 0x0f00) >> 8, mnemonic, trace))
+  if (CheckConditionCodes((opcode & 0x0f00) >> 8))
     result = 0xff;
   else
     result = 0;
 
-  // Store the result
-  if (in_register_flag)
+  // Store the result, setting a register takes longer
+  if (in_register_flag) {
+    if (result)
+      myCycles += 2;
     SetRegister(address, result, BYTE);
-  else if ((status = Poke(address, result, BYTE)) != EXECUTE_OK)
+  } else if ((status = Poke(address, result, BYTE)) != EXECUTE_OK) {
     return (status);
-
-  if (trace) {
-    mnemonic += ".B ";
-    mnemonic += ea_description;
-    mnemonic += "}} ";
-    trace_record += mnemonic;
   }
+
   return (EXECUTE_OK);
 }
 
 // Execute the 'TAS' instruction
-int m68000::ExecuteTAS(int opcode, std::string &trace_record, int trace) {
+int m68000::ExecuteTAS(int opcode) {
   int status, in_register_flag;
   Address address;
   unsigned int data;
-  std::string ea_description;
 
   // Get the effective address
-  if ((status =
-           ComputeEffectiveAddress(address, in_register_flag, ea_description,
-                                   opcode & 0x3f, BYTE, trace)) != EXECUTE_OK) {
+  if ((status = ComputeEffectiveAddress(address, in_register_flag,
+                                        opcode & 0x3f, BYTE)) != EXECUTE_OK) {
     return (status);
   }
 
@@ -4851,34 +3782,26 @@ int m68000::ExecuteTAS(int opcode, std::string &trace_record, int trace) {
   else if ((status = Poke(address, data, BYTE)) != EXECUTE_OK)
     return (status);
 
-  if (trace) {
-    trace_record += "{Mnemonic {TAS.B ";
-    trace_record += ea_description;
-    trace_record += "}} ";
-  }
   return (EXECUTE_OK);
 }
 
 // Execute the 'TRAP' instruction
-int m68000::ExecuteTRAP(int opcode, std::string &trace_record, int trace) {
+int m68000::ExecuteTRAP(int opcode) {
   int status;
 
   // Process the exception
   if ((status = ProcessException(32 + (opcode & 0xf))) != EXECUTE_OK)
     return (status);
 
-  if (trace) {
-    trace_record += "{Mnemonic {TRAP #$";
-    trace_record += IntToString(32 + (opcode & 0xf), 1);
-    trace_record += "}} ";
-  }
   return (EXECUTE_OK);
 }
 
 // Execute the 'TRAPV' instruction
-int m68000::ExecuteTRAPV(int, std::string &trace_record, int trace) {
+int m68000::ExecuteTRAPV(int) {
   int status;
 
+  EvaluateConditionCodes();
+
   // If the overflow bit is set then trap
   if (register_value[SR_INDEX] & V_FLAG) {
     // Process the exception
@@ -4886,25 +3809,20 @@ int m68000::ExecuteTRAPV(int, std::string &trace_record, int trace) {
       return (status);
   }
 
-  if (trace)
-    trace_record += "{Mnemonic {TRAPV}} ";
-
   return (EXECUTE_OK);
 }
 
 // Execute the 'TST' instruction
-int m68000::ExecuteTST(int opcode, std::string &trace_record, int trace) {
+int m68000::ExecuteTST(int opcode) {
   int status, size, in_register_flag;
   Address address;
   unsigned int data;
-  std::string ea_description;
 
   size = ((opcode & 0x00c0) >> 6);
 
   // Get the effective address
-  if ((status =
-           ComputeEffectiveAddress(address, in_register_flag, ea_description,
-                                   opcode & 0x3f, size, trace)) != EXECUTE_OK) {
+  if ((status = ComputeEffectiveAddress(address, in_register_flag,
+                                        opcode & 0x3f, size)) != EXECUTE_OK) {
     return (status);
   }
 
@@ -4916,22 +3834,11 @@ int m68000::ExecuteTST(int opcode, std::string &trace_record, int trace) {
 
   SetConditionCodes(0, 0, data, size, OTHER, C_FLAG | V_FLAG | Z_FLAG | N_FLAG);
 
-  if (trace) {
-    trace_record += "{Mnemonic {TST";
-    if (size == BYTE)
-      trace_record += ".B ";
-    else if (size == WORD)
-      trace_record += ".W ";
-    else if (size == LONG)
-      trace_record += ".L ";
-    trace_record += ea_description;
-    trace_record += "}} ";
-  }
   return (EXECUTE_OK);
 }
 
 // Execute the 'UNLK' instruction
-int m68000::ExecuteUNLK(int opcode, std::string &trace_record, int trace) {
+int m68000::ExecuteUNLK(int opcode) {
   int status, stack_index;
   unsigned int register_number, fp;
 
@@ -4958,16 +3865,11 @@ int m68000::ExecuteUNLK(int opcode, std::string &trace_record, int trace) {
   SetRegister(register_number, fp, LONG);
   SetRegister(stack_index, register_value[stack_index] + 4, LONG);
 
-  if (trace) {
-    trace_record += "{Mnemonic {UNLK ";
-    trace_record += ourRegisterData[register_number].name;
-    trace_record += "}} ";
-  }
   return (EXECUTE_OK);
 }
 
 // Execute 'Invalid' instructions
-int m68000::ExecuteInvalid(int, std::string &trace_record, int trace) {
+int m68000::ExecuteInvalid(int) {
   int status;
 
   // Move the PC back to the start of the illegal instruction opcode
@@ -4977,9 +3879,6 @@ int m68000::ExecuteInvalid(int, std::string &trace_record, int trace) {
   if ((status = ProcessException(4)) != EXECUTE_OK)
     return (status);
 
-  if (trace)
-    trace_record += "{Mnemonic {Illegal Instruction Exception}} ";
-
   return (EXECUTE_OK);
 }
 
@@ -4987,6 +3886,10 @@ int m68000::ExecuteInvalid(int, std::string &trace_record, int trace) {
 int m68000::ProcessException(int vector) {
   int status;
 
+  EvaluateConditionCodes();
+  myCycles += ExceptionCycles(vector);
+  myStatistics.CountException();
+
   // Copy the SR to a temp
   Register sr = register_value[SR_INDEX];
 
@@ -5018,9 +3921,13 @@ int m68000::ProcessException(int vector) {
 }
 
 // Execute the Address Error Cycle
-int m68000::ExecuteAddressError(int opcode, std::string &trace_record, int trace) {
+int m68000::ExecuteAddressError(int opcode) {
   int status;
 
+  EvaluateConditionCodes();
+  myCycles += ExceptionCycles(3);
+  myStatistics.CountAddressError();
+
   // Copy the SR to a temp
   Register sr = register_value[SR_INDEX];
 
@@ -5071,16 +3978,17 @@ int m68000::ExecuteAddressError(int opcode, std::string &trace_record, int trace
   // Change the program counter to the service routine's address
   SetRegister(PC_INDEX, service_address, LONG);
 
-  if (trace)
-    trace_record += "{Mnemonic {Address Error Exception}} ";
-
   return (EXECUTE_OK);
 }
 
 // Execute the Bus Error Cycle
-int m68000::ExecuteBusError(int opcode, std::string &trace_record, int trace) {
+int m68000::ExecuteBusError(int opcode) {
   int status;
 
+  EvaluateConditionCodes();
+  myCycles += ExceptionCycles(2);
+  myStatistics.CountBusError();
+
   // Copy the SR to a temp
   Register sr = register_value[SR_INDEX];
 
@@ -5131,8 +4039,5 @@ int m68000::ExecuteBusError(int opcode, std::string &trace_record, int trace) {
   // Change the program counter to the service routine's address
   SetRegister(PC_INDEX, service_address, LONG);
 
-  if (trace)
-    trace_record += "{Mnemonic {Bus Error Exception}} ";
-
   return EXECUTE_OK;
 }
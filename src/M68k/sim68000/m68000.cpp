@@ -1,11 +1,15 @@
+#include <chrono>
+
 #include "Framework/AddressSpace.hpp"
 #include "Framework/BasicDevice.hpp"
+#include "Framework/BreakpointList.hpp"
 #include "Framework/RegInfo.hpp"
+#include "Framework/StatInfo.hpp"
 #include "Framework/Tools.hpp"
 #include "M68k/sim68000/m68000.hpp"
 
 // Array of information about each register
-m68000::RegisterData m68000::ourRegisterData[] = {
+const m68000::RegisterData m68000::ourRegisterData[] = {
     {"D0", 0xffffffff, "Data Register 0"},
     {"D1", 0xffffffff, "Data Register 1"},
     {"D2", 0xffffffff, "Data Register 2"},
@@ -30,7 +34,7 @@ m68000::RegisterData m68000::ourRegisterData[] = {
                        "Carry"}};
 
 m68000::m68000()
-    : BasicCPU("68000", 1, *(new std::vector<AddressSpace *>),
+    : BasicCPU("68000", 1, CLOCK_RATE,
                "{InstructionAddress 8} {Mnemonic 35}",
                "InstructionAddress Mnemonic"),
       myNumberOfRegisters(19), C_FLAG(0x0001), // SR flags
@@ -45,16 +49,6 @@ m68000::m68000()
   // Create my single address space object
   myAddressSpaces.push_back(new AddressSpace(0x00ffffff));
 
-  // Build the decode cache if necessary
-  if (ourDecodeCacheTable == 0) {
-    // Allocate memory for the decode cache table
-    ourDecodeCacheTable = new ExecutionPointer[65536];
-
-    // Set all cache entries to invalid (NULL)
-    for (int t = 0; t < 65536; ++t)
-      ourDecodeCacheTable[t] = 0;
-  }
-
   // Allocate array for register values
   register_value = new Register[myNumberOfRegisters];
 
@@ -62,6 +56,16 @@ m68000::m68000()
   for (int i = 0; i < myNumberOfRegisters; ++i)
     register_value[i] = 0;
 
+  myExceptionMnemonic = nullptr;
+  myOperands = nullptr;
+  myOperandAddress = 0;
+  myOperandLength = 0;
+  myStatisticsCycles = 0;
+  mySpecializationsChecked = 0;
+
+  // Specialize hot blocks' handlers unless told otherwise
+  EnableSpecialization(true);
+
   // Reset the system
   Reset();
 }
@@ -83,6 +87,7 @@ void m68000::Reset() {
   myAddressSpaces[0]->Reset();
 
   // Set the Status register to its reset value
+  myPendingConditionCodes.mask = 0;
   register_value[SR_INDEX] = S_FLAG | I0_FLAG | I1_FLAG | I2_FLAG;
 
   // Fetch the Supervisor Stack Pointer from location $00000000
@@ -106,13 +111,43 @@ Address m68000::ValueOfProgramCounter() {
   return register_value[PC_INDEX];
 }
 
+// Returns the registers with the condition codes brought up to date
+const Register *m68000::RegisterFile(size_t &count) {
+  EvaluateConditionCodes();
+  count = myNumberOfRegisters;
+  return register_value;
+}
+
 // Builds the statistics list for the StatisticalInformationList object
-void m68000::BuildStatisticalInformationList(StatisticalInformationList &) {
-  // We're not keeping up with any stupid statistics :-}
+void m68000::BuildStatisticalInformationList(StatisticalInformationList &lst) {
+  lst.Append("Clock Cycles: " + std::to_string(myCycles - myStatisticsCycles));
+  myStatistics.Build(lst, [this](unsigned int opcode) {
+    return DecodeInstruction(opcode).name;
+  });
+  if (myCheckingSpecialization) {
+    lst.Append("Specializations Checked: " +
+               std::to_string(mySpecializationsChecked));
+    if (!mySpecializationMismatch.empty())
+      lst.Append("Specialization Mismatch: " + mySpecializationMismatch);
+  }
+}
+
+// Enables or disables specialized handlers for hot basic blocks
+void m68000::EnableSpecialization(bool enable) {
+  myCheckingSpecialization = false;
+  myBlockCache.SetSpecializer(enable ? &m68000::SpecializeInstruction
+                                     : nullptr);
+}
+
+// Checks hot basic blocks' specialized handlers against the ordinary ones
+void m68000::CheckSpecialization() {
+  myCheckingSpecialization = true;
+  myBlockCache.SetSpecializer(&m68000::CheckedSpecialization);
 }
 
 // Sets the named register to the given value
 void m68000::SetRegister(const std::string &name, const std::string &hexValue) {
+  EvaluateConditionCodes();
   for (int t = 0; t < myNumberOfRegisters; ++t) {
     if (name == ourRegisterData[t].name) {
       register_value[t] = StringToInt(hexValue) & ourRegisterData[t].mask;
@@ -123,6 +158,7 @@ void m68000::SetRegister(const std::string &name, const std::string &hexValue) {
 
 // Append all of the CPU's registers to the RegisterInformationList object
 void m68000::BuildRegisterInformationList(RegisterInformationList &lst) {
+  EvaluateConditionCodes();
   for (unsigned int t = 0; t < (unsigned int)myNumberOfRegisters; ++t) {
     std::string value;
 
@@ -133,15 +169,23 @@ void m68000::BuildRegisterInformationList(RegisterInformationList &lst) {
 
     lst.Append(ourRegisterData[t].name, value, ourRegisterData[t].description);
   }
+
+  // The clock cycle counter is read only
+  std::string cycles =
+      IntToString(myCycles >> 32, 8) + IntToString(myCycles, 8);
+  lst.Append("CYC", cycles, "Clock Cycles Executed");
 }
 
-// Execute the next instruction
-std::string m68000::ExecuteInstruction(std::string &traceRecord, bool tracing) {
-  unsigned int opcode;
+// Execute the next instruction, servicing any pending interrupts first
+bool m68000::ExecuteNextInstruction(std::string &traceRecord, TraceMode mode) {
+  // Bus and address errors push the opcode, which has to be defined even
+  // when fetching it is what failed
+  unsigned int opcode = 0;
   int status;
+  bool disassembled = false;
 
   // Add instruction address to the trace record
-  if (tracing) {
+  if (mode == TRACE_FULL) {
     traceRecord = "{InstructionAddress ";
     traceRecord += IntToString(register_value[PC_INDEX], 8);
     traceRecord += "} ";
@@ -157,47 +201,112 @@ std::string m68000::ExecuteInstruction(std::string &traceRecord, bool tracing) {
     if (!serviceFlag && status == EXECUTE_OK) {
       // Make sure the CPU isn't stopped waiting for exceptions
       if (myState != STOP_STATE) {
-        // Fetch the next instruction
-        status = Peek(register_value[PC_INDEX], opcode, WORD);
+        // Fetch the next instruction, predecoded if we've seen it before
+        Address pc = register_value[PC_INDEX];
+        AddressSpace &space = *myAddressSpaces[0];
+        auto *entry = myBlockCache.Find(pc, space.CodeGeneration());
+        status = EXECUTE_OK;
+        if (entry == nullptr) {
+          status = Peek(pc, opcode, WORD);
+          if (status == EXECUTE_OK) {
+            ExecutionPointer executeMethod = DecodeInstruction(opcode).execute;
+            unsigned int cycles = InstructionCycles(opcode, executeMethod);
+            Byte operands[OPERAND_BYTES];
+            size_t length = space.ReadBlock(pc + 2, operands,
+                                            OperandLength(opcode, pc));
+            entry = myBlockCache.Insert(pc, opcode, executeMethod, cycles,
+                                        EndsBlock(executeMethod), operands,
+                                        length);
+            space.MarkCode(pc, 2 + length);
+          }
+        }
         if (status == EXECUTE_OK) {
+          opcode = entry->opcode;
+          ExecutionPointer executeMethod = entry->execute;
+          if (mode == TRACE_NONE && entry->specialized != nullptr)
+            executeMethod = entry->specialized;
+
+          // Disassemble the instruction before it changes anything
+          std::string mnemonic;
+          if (mode == TRACE_FULL) {
+            Address next = pc + 2;
+            (this->*DecodeInstruction(opcode).disassemble)(opcode, next,
+                                                           mnemonic);
+          }
+          if (mode != TRACE_NONE)
+            myExceptionMnemonic = nullptr;
           register_value[PC_INDEX] += 2;
-
-          // Execute the instruction
-          ExecutionPointer executeMethod = DecodeInstruction(opcode);
-          status = (this->*executeMethod)(opcode, traceRecord, tracing);
+          myCycles += entry->cycles;
+          myStatistics.CountInstruction(opcode);
+
+          // Execute the instruction, its extension words coming from the
+          // block cache
+          myOperands = entry->operands;
+          myOperandAddress = pc + 2;
+          myOperandLength = entry->length;
+          status = (this->*executeMethod)(opcode);
+          myOperandLength = 0;
+
+          if (mode != TRACE_NONE) {
+            if (myExceptionMnemonic != nullptr) {
+              traceRecord += "{Mnemonic {";
+              traceRecord += myExceptionMnemonic;
+              traceRecord += "}} ";
+            } else if ((status == EXECUTE_OK) ||
+                       (status == EXECUTE_PRIVILEGED_OK)) {
+              traceRecord += mnemonic;
+              disassembled = true;
+            }
+          }
 
           // If the last instruction was not priviledged then check for trace
           if ((status == EXECUTE_OK) && (register_value[SR_INDEX] & T_FLAG))
             status = ProcessException(9);
         }
       } else {
-        if (tracing)
+        // Nothing can happen until the next event, so skip straight to it
+        uint64_t steps = 1;
+        const uint64_t deadline = myEventHandler.Deadline();
+        if (deadline != EventHandler::NEVER && deadline > myCycles)
+          steps = (deadline - myCycles + STOPPED_CYCLES - 1) / STOPPED_CYCLES;
+        myCycles += steps * STOPPED_CYCLES;
+        if (mode != TRACE_NONE)
           traceRecord += "{Mnemonic {CPU is stopped}} ";
       }
     }
 
     if (status == EXECUTE_BUS_ERROR) {
-      if (ExecuteBusError(opcode, traceRecord, tracing) != EXECUTE_OK) {
+      if (ExecuteBusError(opcode) != EXECUTE_OK) {
         // Oh, no the cpu has fallen and it can't get up!
         myState = HALT_STATE;
-        if (tracing)
+        if (mode != TRACE_NONE)
           traceRecord += "{Mnemonic {Double Bus/Address Error CPU halted}} ";
+      } else if (mode != TRACE_NONE) {
+        traceRecord += "{Mnemonic {Bus Error Exception}} ";
       }
     } else if (status == EXECUTE_ADDRESS_ERROR) {
-      if (ExecuteAddressError(opcode, traceRecord, tracing) != EXECUTE_OK) {
+      if (ExecuteAddressError(opcode) != EXECUTE_OK) {
         // Now, where's that reset button???
         myState = HALT_STATE;
-        if (tracing)
+        if (mode != TRACE_NONE)
           traceRecord += "{Mnemonic {Double Bus/Address Error CPU halted}} ";
+      } else if (mode != TRACE_NONE) {
+        traceRecord += "{Mnemonic {Address Error Exception}} ";
       }
     }
   } else {
-    if (tracing)
+    if (mode != TRACE_NONE)
       traceRecord += "{Mnemonic {CPU has halted}} ";
   }
+  return disassembled;
+}
 
-  // Check the event list
-  myEventHandler.Check();
+// Execute the next instruction
+std::string m68000::ExecuteInstruction(std::string &traceRecord, bool tracing) {
+  ExecuteNextInstruction(traceRecord, tracing ? TRACE_FULL : TRACE_NONE);
+
+  // Let the event list know time has passed
+  myEventHandler.Advance();
 
   // Signal if the processor is in a wierd state
   if (myState == HALT_STATE) {
@@ -213,6 +322,82 @@ std::string m68000::ExecuteInstruction(std::string &traceRecord, bool tracing) {
   return "";
 }
 
+// Execute the next instruction for a trace recorder
+BasicCPU::StopReason m68000::RecordInstruction(bool &disassembled,
+                                          std::string &note) {
+  note.clear();
+  disassembled = ExecuteNextInstruction(note, TRACE_RECORD);
+
+  // Dispatch device events when the next one is due
+  myEventHandler.Advance();
+
+  if (myState == HALT_STATE)
+    return STOP_HALTED;
+  if (myState == BREAK_STATE) {
+    myState = NORMAL_STATE;
+    return STOP_BREAK;
+  }
+  return STOP_LIMIT;
+}
+
+// Execute instructions until the limit or one of the stop conditions
+BasicCPU::ExecuteResult m68000::Execute(size_t maxInstructions,
+                                        const StopConditions &stop) {
+  const auto start = std::chrono::steady_clock::now();
+  std::string traceRecord;
+  StopReason reason = STOP_LIMIT;
+  size_t count = 0;
+
+  // There's no need to look for breakpoints if there aren't any
+  const BreakpointList *breakpoints = stop.breakpoints;
+  if (breakpoints != nullptr && breakpoints->Empty())
+    breakpoints = nullptr;
+  const std::atomic<bool> *interrupt = stop.interrupt;
+
+  // Forget the last idle loop, breakpoints may have changed since
+  myIdleLoop.Forget();
+
+  while (count < maxInstructions) {
+    const Address pc = register_value[PC_INDEX];
+    ExecuteNextInstruction(traceRecord, TRACE_NONE);
+    ++count;
+
+    // Dispatch device events when the next one is due
+    myEventHandler.Advance();
+
+    if (myState == HALT_STATE) {
+      reason = STOP_HALTED;
+      break;
+    }
+    if (myState == BREAK_STATE) {
+      myState = NORMAL_STATE;
+      reason = STOP_BREAK;
+      break;
+    }
+    if (breakpoints != nullptr &&
+        breakpoints->Check(register_value[PC_INDEX])) {
+      reason = STOP_BREAKPOINT;
+      break;
+    }
+    if (interrupt != nullptr && interrupt->load(std::memory_order_relaxed)) {
+      reason = STOP_INTERRUPTED;
+      break;
+    }
+
+    // Short backward branches may close an idle loop
+    if (register_value[PC_INDEX] < pc &&
+        pc - register_value[PC_INDEX] <= myIdleLoop.MAX_BYTES)
+      count += myIdleLoop.Skip(*this, pc, count, maxInstructions - count);
+  }
+
+  // Keep track of how fast we're running
+  const auto elapsed = std::chrono::steady_clock::now() - start;
+  myStatistics.CountRun(
+      count,
+      std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+  return {reason, count};
+}
+
 // Handle an interrupt request from a device
 void m68000::InterruptRequest(BasicDevice *device, int level) {
   // The 68000 has seven levels of interrupts
@@ -221,7 +406,7 @@ void m68000::InterruptRequest(BasicDevice *device, int level) {
   else if (level < 1)
     level = 1;
 
-  pending_interrupts.push(PendingInterrupt(level, device));
+  myInterrupts.Request(device, level);
 }
 
 // Service pending interrupts, serviceFlag set true iff something serviced
@@ -229,17 +414,16 @@ int m68000::ServiceInterrupts(bool &serviceFlag) {
   serviceFlag = false;
 
   // If there are no pending interupts, return normally.
-  if (pending_interrupts.empty()) {
+  const int level = myInterrupts.Highest();
+  if (level == 0) {
     return EXECUTE_OK;
   }
 
-  const PendingInterrupt &interrupt = pending_interrupts.top();
-
-  // Also return normally if any of the currently pending interrupts
-  // are masked.  Note that a check against the top of the queue is
-  // sufficient, as the top entry has the highest level.
+  // Also return normally if all of the currently pending interrupts
+  // are masked.  Note that a check against the highest level is
+  // sufficient.
   const int interrupt_mask = (register_value[SR_INDEX] & 0x0700) >> 8;
-  if (interrupt.level < interrupt_mask && interrupt.level != 7) {
+  if (level < interrupt_mask && level != 7) {
     return EXECUTE_OK;
   }
 
@@ -249,11 +433,12 @@ int m68000::ServiceInterrupts(bool &serviceFlag) {
 
   // Save a copy of the current SR so it can be stacked for entry
   // to the interrupt service subroutine
+  EvaluateConditionCodes();
   Register tmp_sr = register_value[SR_INDEX];
 
   // Set the Interrupt Mask in SR
   register_value[SR_INDEX] &= 0x0000f8ff;
-  register_value[SR_INDEX] |= (interrupt.level << 8);
+  register_value[SR_INDEX] |= (level << 8);
 
   // Change to Supervisor mode and clear the Trace mode
   register_value[SR_INDEX] |= S_FLAG;
@@ -271,9 +456,9 @@ int m68000::ServiceInterrupts(bool &serviceFlag) {
     return status;
 
   // Get the vector number by acknowledging to the device
-  int vector = interrupt.device->InterruptAcknowledge(interrupt.level);
+  int vector = myInterrupts.Device(level)->InterruptAcknowledge(level);
   if (vector == AUTOVECTOR_INTERRUPT)
-    vector = 24 + interrupt.level;
+    vector = 24 + level;
   else if (vector == SPURIOUS_INTERRUPT)
     vector = 24;
 
@@ -287,9 +472,11 @@ int m68000::ServiceInterrupts(bool &serviceFlag) {
   SetRegister(PC_INDEX, service_address, LONG);
 
   // Indicate that an interrupt was serviced and remove it from
-  // the queue of pending interrupts
+  // the pending interrupts
   serviceFlag = true;
-  pending_interrupts.pop();
+  myInterrupts.Acknowledge(level);
+  myCycles += INTERRUPT_CYCLES;
+  myStatistics.CountInterrupt();
 
   return EXECUTE_OK;
 }
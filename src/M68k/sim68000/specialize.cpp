@@ -0,0 +1,234 @@
+//
+// Specialized handlers for hot basic blocks.  This is not a code generator:
+// nothing is compiled to host code.  Once a block is hot, the common
+// register-only forms of its instructions get handlers that skip effective
+// address decoding and trace generation.  Everything else, including
+// anything that may touch memory or raise an exception, keeps its ordinary
+// handler.  The specialized handlers only run when nothing is traced, so
+// they can be checked against the ordinary ones with CheckSpecialization.
+//
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "Framework/Tools.hpp"
+#include "M68k/sim68000/m68000.hpp"
+
+// Returns a specialized handler for the instruction or nullptr
+m68000::ExecutionPointer
+m68000::SpecializeInstruction(unsigned int opcode, ExecutionPointer execute) {
+  const bool ea_data_register = (opcode & 0x0038) == 0;
+
+  if (execute == &m68000::ExecuteMOVEQ)
+    return &m68000::SpecializedMOVEQ;
+
+  if (execute == &m68000::ExecuteBcc && (opcode & 0xff) != 0)
+    return &m68000::SpecializedBcc;
+
+  if (!ea_data_register)
+    return nullptr;
+
+  if (execute == &m68000::ExecuteMOVE && (opcode & 0x01c0) == 0)
+    return &m68000::SpecializedMOVE;
+  if (execute == &m68000::ExecuteADDQ)
+    return &m68000::SpecializedADDQ;
+  if (execute == &m68000::ExecuteSUBQ)
+    return &m68000::SpecializedSUBQ;
+  if (execute == &m68000::ExecuteEOR)
+    return &m68000::SpecializedEOR;
+  if (execute == &m68000::ExecuteCMP)
+    return &m68000::SpecializedCMP;
+
+  // Only the <ea> op <Dn> -> <Dn> direction
+  if (opcode & 0x0100)
+    return nullptr;
+
+  if (execute == &m68000::ExecuteADD)
+    return &m68000::SpecializedADD;
+  if (execute == &m68000::ExecuteSUB)
+    return &m68000::SpecializedSUB;
+  if (execute == &m68000::ExecuteAND)
+    return &m68000::SpecializedAND;
+  if (execute == &m68000::ExecuteOR)
+    return &m68000::SpecializedOR;
+
+  return nullptr;
+}
+
+// Returns ExecuteChecked for the instructions which have specialized handlers
+m68000::ExecutionPointer
+m68000::CheckedSpecialization(unsigned int opcode, ExecutionPointer execute) {
+  if (SpecializeInstruction(opcode, execute) == nullptr)
+    return nullptr;
+  return &m68000::ExecuteChecked;
+}
+
+// Runs the specialized handler, then puts the registers back and runs the
+// ordinary handler, whose results are kept.  Neither touches memory.
+int m68000::ExecuteChecked(int opcode) {
+  const DecodeEntry &entry = DecodeInstruction(opcode);
+  const ExecutionPointer specialized =
+      SpecializeInstruction(opcode, entry.execute);
+
+  EvaluateConditionCodes();
+  const std::vector<Register> before(register_value,
+                                     register_value + myNumberOfRegisters);
+  const uint64_t cycles = myCycles;
+  const int specializedStatus = (this->*specialized)(opcode);
+  EvaluateConditionCodes();
+  const std::vector<Register> after(register_value,
+                                    register_value + myNumberOfRegisters);
+  const uint64_t specializedCycles = myCycles;
+
+  std::copy(before.begin(), before.end(), register_value);
+  myCycles = cycles;
+  const int status = (this->*entry.execute)(opcode);
+  EvaluateConditionCodes();
+
+  ++mySpecializationsChecked;
+  if (status != specializedStatus || myCycles != specializedCycles ||
+      !std::equal(after.begin(), after.end(), register_value)) {
+    if (mySpecializationMismatch.empty()) {
+      mySpecializationMismatch = std::string(entry.name) + " at " +
+                              IntToString(before[PC_INDEX] - 2, 8);
+    }
+    myState = HALT_STATE;
+  }
+  return status;
+}
+
+// MOVE.<size> Dn,Dm
+int m68000::SpecializedMOVE(int opcode) {
+  static const int sizes[] = {0, BYTE, LONG, WORD};
+  const int size = sizes[(opcode & 0x3000) >> 12];
+  const unsigned int src = register_value[D0_INDEX + (opcode & 7)];
+
+  SetRegister(D0_INDEX + ((opcode & 0x0e00) >> 9), src, size);
+  SetConditionCodes(0, 0, src, size, OTHER, N_FLAG | Z_FLAG | V_FLAG | C_FLAG);
+  return EXECUTE_OK;
+}
+
+// MOVEQ #<data>,Dn
+int m68000::SpecializedMOVEQ(int opcode) {
+  const unsigned int data = SignExtend(opcode & 0xff, BYTE);
+
+  SetConditionCodes(0, 0, data, LONG, OTHER, C_FLAG | V_FLAG | Z_FLAG | N_FLAG);
+  register_value[D0_INDEX + ((opcode >> 9) & 0x07)] = data;
+  return EXECUTE_OK;
+}
+
+// ADDQ.<size> #<data>,Dn
+int m68000::SpecializedADDQ(int opcode) {
+  const int size = (opcode & 0x00c0) >> 6;
+  const int register_number = D0_INDEX + (opcode & 7);
+  const unsigned int data = ((opcode & 0x0e00) >> 9) ? (opcode & 0x0e00) >> 9 : 8;
+  const unsigned int ea_data = register_value[register_number];
+  const unsigned int result = data + ea_data;
+
+  SetConditionCodes(data, ea_data, result, size, ADDITION,
+                    C_FLAG | V_FLAG | Z_FLAG | N_FLAG | X_FLAG);
+  SetRegister(register_number, result, size);
+  return EXECUTE_OK;
+}
+
+// SUBQ.<size> #<data>,Dn
+int m68000::SpecializedSUBQ(int opcode) {
+  const int size = (opcode & 0x00c0) >> 6;
+  const int register_number = D0_INDEX + (opcode & 7);
+  const unsigned int data = ((opcode & 0x0e00) >> 9) ? (opcode & 0x0e00) >> 9 : 8;
+  const unsigned int ea_data = register_value[register_number];
+  const unsigned int result = ea_data - data;
+
+  SetConditionCodes(data, ea_data, result, size, SUBTRACTION,
+                    C_FLAG | V_FLAG | Z_FLAG | N_FLAG | X_FLAG);
+  SetRegister(register_number, result, size);
+  return EXECUTE_OK;
+}
+
+// ADD.<size> Dm,Dn
+int m68000::SpecializedADD(int opcode) {
+  const int size = (opcode & 0x00c0) >> 6;
+  const int register_number = D0_INDEX + ((opcode & 0x0e00) >> 9);
+  const unsigned int ea_data = register_value[D0_INDEX + (opcode & 7)];
+  const unsigned int result = ea_data + register_value[register_number];
+
+  SetConditionCodes(ea_data, register_value[register_number], result, size,
+                    ADDITION, C_FLAG | V_FLAG | Z_FLAG | N_FLAG | X_FLAG);
+  SetRegister(register_number, result, size);
+  return EXECUTE_OK;
+}
+
+// SUB.<size> Dm,Dn
+int m68000::SpecializedSUB(int opcode) {
+  const int size = (opcode & 0x00c0) >> 6;
+  const int register_number = D0_INDEX + ((opcode & 0x0e00) >> 9);
+  const unsigned int ea_data = register_value[D0_INDEX + (opcode & 7)];
+  const unsigned int result = register_value[register_number] - ea_data;
+
+  SetConditionCodes(ea_data, register_value[register_number], result, size,
+                    SUBTRACTION, C_FLAG | V_FLAG | Z_FLAG | N_FLAG | X_FLAG);
+  SetRegister(register_number, result, size);
+  return EXECUTE_OK;
+}
+
+// AND.<size> Dm,Dn
+int m68000::SpecializedAND(int opcode) {
+  const int size = (opcode & 0x00c0) >> 6;
+  const int register_number = D0_INDEX + ((opcode & 0x0e00) >> 9);
+  const unsigned int ea_data = register_value[D0_INDEX + (opcode & 7)];
+  const unsigned int result = ea_data & register_value[register_number];
+
+  SetConditionCodes(ea_data, register_value[register_number], result, size,
+                    OTHER, V_FLAG | C_FLAG | Z_FLAG | N_FLAG);
+  SetRegister(register_number, result, size);
+  return EXECUTE_OK;
+}
+
+// OR.<size> Dm,Dn
+int m68000::SpecializedOR(int opcode) {
+  const int size = (opcode & 0x00c0) >> 6;
+  const int register_number = D0_INDEX + ((opcode & 0x0e00) >> 9);
+  const unsigned int ea_data = register_value[D0_INDEX + (opcode & 7)];
+  const unsigned int result = ea_data | register_value[register_number];
+
+  SetConditionCodes(ea_data, register_value[register_number], result, size,
+                    OTHER, V_FLAG | C_FLAG | Z_FLAG | N_FLAG);
+  SetRegister(register_number, result, size);
+  return EXECUTE_OK;
+}
+
+// EOR.<size> Dn,Dm
+int m68000::SpecializedEOR(int opcode) {
+  const int size = (opcode & 0x00c0) >> 6;
+  const int register_number = D0_INDEX + ((opcode & 0x0e00) >> 9);
+  const int ea_register = D0_INDEX + (opcode & 7);
+  const unsigned int ea_data = register_value[ea_register];
+  const unsigned int result = register_value[register_number] ^ ea_data;
+
+  SetConditionCodes(register_value[register_number], ea_data, result, size,
+                    OTHER, V_FLAG | C_FLAG | Z_FLAG | N_FLAG);
+  SetRegister(ea_register, result, size);
+  return EXECUTE_OK;
+}
+
+// CMP.<size> Dm,Dn
+int m68000::SpecializedCMP(int opcode) {
+  const int size = (opcode & 0x00c0) >> 6;
+  const int register_number = D0_INDEX + ((opcode & 0x0e00) >> 9);
+  const unsigned int ea_data = register_value[D0_INDEX + (opcode & 7)];
+  const unsigned int result = register_value[register_number] - ea_data;
+
+  SetConditionCodes(ea_data, register_value[register_number], result, size,
+                    SUBTRACTION, C_FLAG | V_FLAG | Z_FLAG | N_FLAG);
+  return EXECUTE_OK;
+}
+
+// Bcc.B <label>
+int m68000::SpecializedBcc(int opcode) {
+  if (CheckConditionCodes((opcode & 0x0f00) >> 8)) {
+    register_value[PC_INDEX] += SignExtend(opcode & 0xff, BYTE);
+    myCycles += 2;
+  }
+  return EXECUTE_OK;
+}
@@ -0,0 +1,266 @@
+//
+// Instruction timing.  Instructions are charged the clock cycles given in
+// the instruction execution timing tables of the MC68000 User's Manual for
+// their form and effective address.  Costs that depend on the data, such as
+// shift counts, MOVEM register lists and whether a branch is taken, are
+// added by the instructions themselves.
+//
+
+#include "M68k/sim68000/m68000.hpp"
+
+namespace {
+
+// Returns the row of the tables below for the mode and register bits of an
+// effective address: Dn, An, (An), (An)+, -(An), d16(An), d8(An,Xn), abs.W,
+// abs.L, d16(PC), d8(PC,Xn) and #<data>
+int AddressingMode(int mode_register) {
+  const int mode = (mode_register >> 3) & 7;
+  const int reg = mode_register & 7;
+
+  if (mode < 7)
+    return mode;
+  return (reg < 4) ? 7 + reg : 11;
+}
+
+// Cycles to calculate the effective address and fetch a byte or word
+const unsigned char ourFetchWordCycles[] = {0, 0, 4, 4, 6, 8,
+                                            10, 8, 12, 8, 10, 4};
+
+// Cycles to calculate the effective address and fetch a long word
+const unsigned char ourFetchLongCycles[] = {0, 0, 8, 8, 10, 12,
+                                            14, 12, 16, 12, 14, 8};
+
+// Cycles to calculate and write the destination of a MOVE
+const unsigned char ourWriteWordCycles[] = {0, 0, 4, 4, 4, 8,
+                                            10, 8, 12, 0, 0, 0};
+const unsigned char ourWriteLongCycles[] = {0, 0, 8, 8, 8, 12,
+                                            14, 12, 16, 0, 0, 0};
+
+// Cycles for the instructions which take control addressing modes
+const unsigned char ourJMPCycles[] = {0, 0, 8, 0, 0, 10, 14, 10, 12, 10, 14, 0};
+const unsigned char ourJSRCycles[] = {0, 0, 16, 0, 0, 18,
+                                      22, 18, 20, 18, 22, 0};
+const unsigned char ourLEACycles[] = {0, 0, 4, 0, 0, 8, 12, 8, 12, 8, 12, 0};
+const unsigned char ourPEACycles[] = {0, 0, 12, 0, 0, 16,
+                                      20, 16, 20, 16, 20, 0};
+
+// Cycles for MOVEM not counting the registers transferred
+const unsigned char ourMOVEMToRegisterCycles[] = {0, 0, 12, 12, 0, 16,
+                                                  18, 16, 20, 16, 18, 0};
+const unsigned char ourMOVEMToMemoryCycles[] = {0, 0, 8, 0, 8, 12,
+                                                14, 12, 16, 0, 0, 0};
+}
+
+// Returns the number of clock cycles the instruction takes, not counting
+// the ones which depend on the data
+unsigned int m68000::InstructionCycles(unsigned int opcode,
+                                       ExecutionPointer execute) {
+  const int mode = AddressingMode(opcode & 0x3f);
+  const bool register_direct = (mode <= 1);
+  const int size = (opcode & 0x00c0) >> 6;
+  const unsigned int ea = (size == LONG) ? ourFetchLongCycles[mode]
+                                         : ourFetchWordCycles[mode];
+
+  // MOVE and MOVEA have their own size encoding and two addresses
+  if (execute == &m68000::ExecuteMOVE || execute == &m68000::ExecuteMOVEA) {
+    const bool long_size = ((opcode & 0x3000) == 0x2000);
+    const int destination =
+        AddressingMode(((opcode >> 3) & 0x38) | ((opcode >> 9) & 7));
+    if (long_size)
+      return 4 + ourFetchLongCycles[mode] + ourWriteLongCycles[destination];
+    return 4 + ourFetchWordCycles[mode] + ourWriteWordCycles[destination];
+  }
+  if (execute == &m68000::ExecuteMOVEQ)
+    return 4;
+
+  // <ea>,Dn and Dn,<ea> arithmetic and logical instructions
+  if (execute == &m68000::ExecuteADD || execute == &m68000::ExecuteSUB ||
+      execute == &m68000::ExecuteAND || execute == &m68000::ExecuteOR) {
+    if (opcode & 0x0100)
+      return ((size == LONG) ? 12 : 8) + ea;
+    if (size == LONG)
+      return ((register_direct || mode == 11) ? 8 : 6) + ea;
+    return 4 + ea;
+  }
+  if (execute == &m68000::ExecuteEOR) {
+    if (register_direct)
+      return (size == LONG) ? 8 : 4;
+    return ((size == LONG) ? 12 : 8) + ea;
+  }
+  if (execute == &m68000::ExecuteCMP)
+    return ((size == LONG) ? 6 : 4) + ea;
+
+  // Address register destinations
+  if (execute == &m68000::ExecuteADDA || execute == &m68000::ExecuteSUBA) {
+    if (!(opcode & 0x0100))
+      return 8 + ourFetchWordCycles[mode];
+    return ((register_direct || mode == 11) ? 8 : 6) + ourFetchLongCycles[mode];
+  }
+  if (execute == &m68000::ExecuteCMPA) {
+    if (opcode & 0x0100)
+      return 6 + ourFetchLongCycles[mode];
+    return 6 + ourFetchWordCycles[mode];
+  }
+
+  // Immediate instructions
+  if (execute == &m68000::ExecuteADDI || execute == &m68000::ExecuteSUBI ||
+      execute == &m68000::ExecuteANDI || execute == &m68000::ExecuteORI ||
+      execute == &m68000::ExecuteEORI) {
+    if (register_direct && size == LONG)
+      return (execute == &m68000::ExecuteANDI) ? 14 : 16;
+    if (register_direct)
+      return 8;
+    return ((size == LONG) ? 20 : 12) + ea;
+  }
+  if (execute == &m68000::ExecuteCMPI) {
+    if (register_direct)
+      return (size == LONG) ? 14 : 8;
+    return ((size == LONG) ? 12 : 8) + ea;
+  }
+  if (execute == &m68000::ExecuteADDQ || execute == &m68000::ExecuteSUBQ) {
+    if (mode == 1)
+      return 8;
+    if (mode == 0)
+      return (size == LONG) ? 8 : 4;
+    return ((size == LONG) ? 12 : 8) + ea;
+  }
+
+  // Multiprecision instructions
+  if (execute == &m68000::ExecuteADDX || execute == &m68000::ExecuteSUBX) {
+    if (opcode & 0x0008)
+      return (size == LONG) ? 30 : 18;
+    return (size == LONG) ? 8 : 4;
+  }
+  if (execute == &m68000::ExecuteABCD)
+    return (opcode & 0x0008) ? 18 : 6;
+  if (execute == &m68000::ExecuteCMPM)
+    return (size == LONG) ? 20 : 12;
+
+  // Single operand instructions
+  if (execute == &m68000::ExecuteCLR || execute == &m68000::ExecuteNEG ||
+      execute == &m68000::ExecuteNEGX || execute == &m68000::ExecuteNOT) {
+    if (register_direct)
+      return (size == LONG) ? 6 : 4;
+    return ((size == LONG) ? 12 : 8) + ea;
+  }
+  if (execute == &m68000::ExecuteScc)
+    return register_direct ? 4 : 8 + ea;
+  if (execute == &m68000::ExecuteTAS)
+    return register_direct ? 4 : 14 + ea;
+  if (execute == &m68000::ExecuteTST)
+    return 4 + ea;
+
+  // Shifts and rotates, register shifts are charged for the count later
+  if (execute == &m68000::ExecuteASL || execute == &m68000::ExecuteASR ||
+      execute == &m68000::ExecuteLSL || execute == &m68000::ExecuteLSR ||
+      execute == &m68000::ExecuteROL || execute == &m68000::ExecuteROR ||
+      execute == &m68000::ExecuteROXL || execute == &m68000::ExecuteROXR) {
+    if (size == 3)
+      return 8 + ourFetchWordCycles[mode];
+    return (size == LONG) ? 8 : 6;
+  }
+
+  // Bit manipulation, the register forms take the maximum time
+  if (execute == &m68000::ExecuteBit) {
+    const bool dynamic = (opcode & 0x0100) != 0;
+    const unsigned int byte_ea = ourFetchWordCycles[mode];
+    switch (size) {
+    case 0:  // BTST
+      if (register_direct)
+        return dynamic ? 6 : 10;
+      return (dynamic ? 4 : 8) + byte_ea;
+    case 2:  // BCLR
+      if (register_direct)
+        return dynamic ? 10 : 14;
+      return (dynamic ? 8 : 12) + byte_ea;
+    default:  // BCHG and BSET
+      if (register_direct)
+        return dynamic ? 8 : 12;
+      return (dynamic ? 8 : 12) + byte_ea;
+    }
+  }
+
+  // Branches, charged for the quicker outcome
+  if (execute == &m68000::ExecuteBcc)
+    return (opcode & 0xff) ? 8 : 10;
+  if (execute == &m68000::ExecuteBRA)
+    return 10;
+  if (execute == &m68000::ExecuteBSR)
+    return 18;
+  if (execute == &m68000::ExecuteDBcc)
+    return 10;
+  if (execute == &m68000::ExecuteJMP)
+    return ourJMPCycles[mode];
+  if (execute == &m68000::ExecuteJSR)
+    return ourJSRCycles[mode];
+  if (execute == &m68000::ExecuteLEA)
+    return ourLEACycles[mode];
+  if (execute == &m68000::ExecutePEA)
+    return ourPEACycles[mode];
+  if (execute == &m68000::ExecuteRTE || execute == &m68000::ExecuteRTR)
+    return 20;
+  if (execute == &m68000::ExecuteRTS)
+    return 16;
+
+  // MOVEM is charged for each register transferred later
+  if (execute == &m68000::ExecuteMOVEM) {
+    if (opcode & 0x0400)
+      return ourMOVEMToRegisterCycles[mode];
+    return ourMOVEMToMemoryCycles[mode];
+  }
+  if (execute == &m68000::ExecuteMOVEP)
+    return (opcode & 0x0040) ? 24 : 16;
+
+  // Multiply and divide are charged for the operands later
+  if (execute == &m68000::ExecuteMULS || execute == &m68000::ExecuteMULU)
+    return 38 + ourFetchWordCycles[mode];
+  if (execute == &m68000::ExecuteDIVS || execute == &m68000::ExecuteDIVU)
+    return ourFetchWordCycles[mode];
+
+  // Status register instructions
+  if (execute == &m68000::ExecuteANDItoCCR ||
+      execute == &m68000::ExecuteANDItoSR ||
+      execute == &m68000::ExecuteEORItoCCR ||
+      execute == &m68000::ExecuteEORItoSR ||
+      execute == &m68000::ExecuteORItoCCR || execute == &m68000::ExecuteORItoSR)
+    return 20;
+  if (execute == &m68000::ExecuteMOVEfromSR)
+    return register_direct ? 6 : 8 + ea;
+  if (execute == &m68000::ExecuteMOVEtoCCR ||
+      execute == &m68000::ExecuteMOVEtoSR)
+    return 12 + ourFetchWordCycles[mode];
+  if (execute == &m68000::ExecuteMOVEUSP)
+    return 4;
+
+  // Miscellaneous instructions
+  if (execute == &m68000::ExecuteEXG)
+    return 6;
+  if (execute == &m68000::ExecuteEXT || execute == &m68000::ExecuteSWAP ||
+      execute == &m68000::ExecuteNOP || execute == &m68000::ExecuteSTOP ||
+      execute == &m68000::ExecuteTRAPV)
+    return 4;
+  if (execute == &m68000::ExecuteLINK)
+    return 16;
+  if (execute == &m68000::ExecuteUNLK)
+    return 12;
+  if (execute == &m68000::ExecuteRESET)
+    return 132;
+
+  // Everything else only raises an exception, which is charged for then
+  return 0;
+}
+
+// Returns the number of clock cycles needed to process the exception
+unsigned int m68000::ExceptionCycles(int vector) {
+  switch (vector) {
+  case 2:  // Bus error
+  case 3:  // Address error
+    return 50;
+  case 5:  // Divide by zero
+    return 38;
+  case 7:  // TRAPV has already been charged for the instruction
+    return 30;
+  default:
+    return 34;
+  }
+}
@@ -1,10 +1,14 @@
 #ifndef M68K_SIM68360_CPU32_HPP_
 #define M68K_SIM68360_CPU32_HPP_
 
-#include <queue>
 #include <string>
+#include <vector>
 
 #include "Framework/BasicCPU.hpp"
+#include "Framework/BlockCache.hpp"
+#include "Framework/ExecutionStatistics.hpp"
+#include "Framework/InterruptController.hpp"
+#include "M68k/common/IdleLoop.hpp"
 
 class BasicDevice;
 
@@ -21,6 +25,12 @@ public:
   // Executes the next instruction. Returns an error message or the empty string.
   std::string ExecuteInstruction(std::string &traceRecord, bool tracing);
 
+  // Executes instructions until the limit or one of the stop conditions.
+  ExecuteResult Execute(size_t maxInstructions, const StopConditions &stop);
+
+  // Executes the next instruction for a trace recorder.
+  StopReason RecordInstruction(bool &disassembled, std::string &note);
+
   // Services pending interrupts. Sets serviceFlag true iff something serviced.
   int ServiceInterrupts(bool &serviceFlag);
 
@@ -33,11 +43,20 @@ public:
   // Returns the value of the program counter register.
   Address ValueOfProgramCounter();
 
+  // Returns the registers, setting count to how many there are.
+  const Register *RegisterFile(size_t &count);
+
+  // Appends the disassembly of the instruction at the address to mnemonic.
+  void DisassembleInstruction(Address address, std::string &mnemonic);
+
   // Sets named register to the given hexidecimal value.
   void SetRegister(const std::string &name, const std::string &hexValue);
 
   // Clears the CPU's Statistics.
-  void ClearStatistics() {}
+  void ClearStatistics() {
+    myStatisticsCycles = myCycles;
+    myStatistics.Clear();
+  }
 
   // Appends all of the CPU's registers to the RegisterInformationList object.
   void BuildRegisterInformationList(RegisterInformationList &list);
@@ -58,7 +77,7 @@ private:
   const int myNumberOfRegisters;
 
   // Array of static information for each register.
-  static RegisterData ourRegisterData[];
+  static const RegisterData ourRegisterData[];
 
   // Pointer to an array of values for each register.
   Register *register_value;
@@ -104,159 +123,376 @@ private:
   const unsigned int BREAK_STATE;
 
   // Pointer to an instruction execution routine
-  typedef int (cpu32::*ExecutionPointer)(int, std::string &, int);
+  typedef int (cpu32::*ExecutionPointer)(int);
+
+  // Pointer to an instruction disassembly routine
+  typedef void (cpu32::*DisassemblePointer)(int, unsigned long &,
+                                            std::string &);
 
   // DecodeEntry structure for the Decode Table
   struct DecodeEntry {
     unsigned int mask;
     unsigned int signature;
     ExecutionPointer execute;
+    DisassemblePointer disassemble;
+    const char *name;
   };
 
-  static DecodeEntry ourDecodeTable[];
-  static ExecutionPointer *ourDecodeCacheTable;
+  // Instructions followed by the index into them for every opcode, both
+  // built by the instruction program from instruction.list
+  static const DecodeEntry ourDecodeTable[];
+  static const uint16_t ourDispatchTable[65536];
+
+  // How much of a trace record ExecuteNextInstruction builds: none of it,
+  // only what a trace recorder keeps, or all of it
+  enum TraceMode { TRACE_NONE, TRACE_RECORD, TRACE_FULL };
+
+  // Executes the next instruction, servicing any pending interrupts first.
+  // Returns true iff the trace record has the instruction's disassembly, or
+  // would have when only recording
+  bool ExecuteNextInstruction(std::string &traceRecord, TraceMode mode);
 
   // Decode the given instruction
-  ExecutionPointer DecodeInstruction(int opcode);
+  const DecodeEntry &DecodeInstruction(int opcode) {
+    return ourDecodeTable[ourDispatchTable[opcode & 0xffff]];
+  }
+
+  // Returns true iff the instruction may transfer control elsewhere
+  static bool EndsBlock(ExecutionPointer execute);
+
+  // Most bytes of an instruction after its opcode word
+  static const size_t OPERAND_BYTES = 20;
+
+  // Predecoded instructions grouped into basic blocks
+  BlockCache<ExecutionPointer, OPERAND_BYTES> myBlockCache;
+
+  // Returns the number of bytes the instruction has after its opcode word
+  size_t OperandLength(unsigned int opcode, Address pc);
+
+  // The bytes after the opcode word of the instruction being executed, kept
+  // by the block cache, and where they start.  Peek reads its extension
+  // words and immediate data from them.
+  const Byte *myOperands;
+  Address myOperandAddress;
+  size_t myOperandLength;
+
+  // Reads the width bytes at the address from the operands of the
+  // instruction being executed.  Returns true iff they lie there.
+  bool PeekOperand(Address address, unsigned int &value, int width) const {
+    const Address offset = address - myOperandAddress;
+    if (offset >= myOperandLength || myOperandLength - offset < size_t(width))
+      return false;
+    value = (unsigned int)ReadBigEndian(myOperands + offset, width);
+    return true;
+  }
+
+  // Returns the number of clock cycles the instruction takes, not counting
+  // the ones which depend on the data
+  static unsigned int InstructionCycles(unsigned int opcode,
+                                        ExecutionPointer execute);
+
+  // Returns the number of clock cycles needed to process the exception
+  static unsigned int ExceptionCycles(int vector);
+
+  // Clock cycles per second, used to time device events, for a 25 MHz part
+  static const unsigned long CLOCK_RATE = 25000000;
+
+  // Clock cycles for taking an interrupt and for each step spent stopped
+  static const unsigned int INTERRUPT_CYCLES = 44;
+  static const unsigned int STOPPED_CYCLES = 4;
+
+  // The last loop checked for being idle
+  friend class IdleLoop<cpu32>;
+  IdleLoop<cpu32> myIdleLoop;
+
+  // Clock cycles when the statistics were last cleared
+  uint64_t myStatisticsCycles;
+
+  // Counts of what has been executed
+  ExecutionStatistics myStatistics;
+
+  // Last operation whose condition codes haven't been computed yet.
+  struct PendingConditionCodes {
+    unsigned int src;
+    unsigned int dest;
+    unsigned int result;
+    int size;
+    int operation;
+    int mask;
+  };
+  PendingConditionCodes myPendingConditionCodes;
 
   // Routines to simulate the execution of the instruction
-  int ExecuteABCD(int opcode, std::string &description, int trace);
-  int ExecuteADD(int opcode, std::string &description, int trace);
-  int ExecuteADDA(int opcode, std::string &description, int trace);
-  int ExecuteADDI(int opcode, std::string &description, int trace);
-  int ExecuteADDQ(int opcode, std::string &description, int trace);
-  int ExecuteADDX(int opcode, std::string &description, int trace);
-  int ExecuteAND(int opcode, std::string &description, int trace);
-  int ExecuteANDI(int opcode, std::string &description, int trace);
-  int ExecuteANDItoCCR(int opcode, std::string &description, int trace);
-  int ExecuteANDItoSR(int opcode, std::string &description, int trace);
-  int ExecuteASL(int opcode, std::string &description, int trace);
-  int ExecuteASR(int opcode, std::string &description, int trace);
-  int ExecuteBRA(int opcode, std::string &description, int trace);
-  int ExecuteBREAK(int opcode, std::string &description, int trace);
-  int ExecuteBSR(int opcode, std::string &description, int trace);
-  int ExecuteBcc(int opcode, std::string &description, int trace);
-  int ExecuteBit(int opcode, std::string &description, int trace);
-  int ExecuteCHK(int opcode, std::string &description, int trace);
-  int ExecuteCLR(int opcode, std::string &description, int trace);
-  int ExecuteCMP(int opcode, std::string &description, int trace);
-  int ExecuteCMPA(int opcode, std::string &description, int trace);
-  int ExecuteCMPI(int opcode, std::string &description, int trace);
-  int ExecuteCMPM(int opcode, std::string &description, int trace);
-  int ExecuteDBcc(int opcode, std::string &description, int trace);
-  int ExecuteDIVS(int opcode, std::string &description, int trace);
-  int ExecuteDIVU(int opcode, std::string &description, int trace);
+  int ExecuteABCD(int opcode);
+  int ExecuteADD(int opcode);
+  int ExecuteADDA(int opcode);
+  int ExecuteADDI(int opcode);
+  int ExecuteADDQ(int opcode);
+  int ExecuteADDX(int opcode);
+  int ExecuteAND(int opcode);
+  int ExecuteANDI(int opcode);
+  int ExecuteANDItoCCR(int opcode);
+  int ExecuteANDItoSR(int opcode);
+  int ExecuteASL(int opcode);
+  int ExecuteASR(int opcode);
+  int ExecuteBRA(int opcode);
+  int ExecuteBREAK(int opcode);
+  int ExecuteBSR(int opcode);
+  int ExecuteBcc(int opcode);
+  int ExecuteBit(int opcode);
+  int ExecuteCHK(int opcode);
+  int ExecuteCLR(int opcode);
+  int ExecuteCMP(int opcode);
+  int ExecuteCMPA(int opcode);
+  int ExecuteCMPI(int opcode);
+  int ExecuteCMPM(int opcode);
+  int ExecuteDBcc(int opcode);
+  int ExecuteDIVS(int opcode);
+  int ExecuteDIVU(int opcode);
   // DIVL: long division, S or U.
-  int ExecuteDIVL(int opcode, std::string &description, int trace);
-  int ExecuteEOR(int opcode, std::string &description, int trace);
-  int ExecuteEORI(int opcode, std::string &description, int trace);
-  int ExecuteEORItoCCR(int opcode, std::string &description, int trace);
-  int ExecuteEORItoSR(int opcode, std::string &description, int trace);
-  int ExecuteEXG(int opcode, std::string &description, int trace);
-  int ExecuteEXT(int opcode, std::string &description, int trace);
-  int ExecuteILLEGAL(int opcode, std::string &description, int trace);
-  int ExecuteJMP(int opcode, std::string &description, int trace);
-  int ExecuteJSR(int opcode, std::string &description, int trace);
-  int ExecuteLEA(int opcode, std::string &description, int trace);
-  int ExecuteLINK(int opcode, std::string &description, int trace);
-  int ExecuteLSL(int opcode, std::string &description, int trace);
-  int ExecuteLSR(int opcode, std::string &description, int trace);
-  int ExecuteMOVE(int opcode, std::string &description, int trace);
-  int ExecuteMOVEA(int opcode, std::string &description, int trace);
+  int ExecuteDIVL(int opcode);
+  int ExecuteEOR(int opcode);
+  int ExecuteEORI(int opcode);
+  int ExecuteEORItoCCR(int opcode);
+  int ExecuteEORItoSR(int opcode);
+  int ExecuteEXG(int opcode);
+  int ExecuteEXT(int opcode);
+  int ExecuteILLEGAL(int opcode);
+  int ExecuteJMP(int opcode);
+  int ExecuteJSR(int opcode);
+  int ExecuteLEA(int opcode);
+  int ExecuteLINK(int opcode);
+  int ExecuteLSL(int opcode);
+  int ExecuteLSR(int opcode);
+  int ExecuteMOVE(int opcode);
+  int ExecuteMOVEA(int opcode);
   // MOVES: move between address spaces
-  int ExecuteMOVES(int opcode, std::string &description, int trace);
+  int ExecuteMOVES(int opcode);
   // MOVEC: move from and to special registers VBR,SFC, DFC
-  int ExecuteMOVEC(int opcode, std::string &description, int trace);
-  int ExecuteMOVEM(int opcode, std::string &description, int trace);
-  int ExecuteMOVEP(int opcode, std::string &description, int trace);
-  int ExecuteMOVEQ(int opcode, std::string &description, int trace);
-  int ExecuteMOVEUSP(int opcode, std::string &description, int trace);
-  int ExecuteMOVEfromSR(int opcode, std::string &description, int trace);
-  int ExecuteMOVEtoCCR(int opcode, std::string &description, int trace);
-  int ExecuteMOVEtoSR(int opcode, std::string &description, int trace);
-  int ExecuteMULS(int opcode, std::string &description, int trace);
+  int ExecuteMOVEC(int opcode);
+  int ExecuteMOVEM(int opcode);
+  int ExecuteMOVEP(int opcode);
+  int ExecuteMOVEQ(int opcode);
+  int ExecuteMOVEUSP(int opcode);
+  int ExecuteMOVEfromSR(int opcode);
+  int ExecuteMOVEtoCCR(int opcode);
+  int ExecuteMOVEtoSR(int opcode);
+  int ExecuteMULS(int opcode);
   // MULL: long multiplication, S or U.
-  int ExecuteMULL(int opcode, std::string &description, int trace);
-  int ExecuteMULU(int opcode, std::string &description, int trace);
-  int ExecuteNBCD(int opcode, std::string &description, int trace);
-  int ExecuteNEG(int opcode, std::string &description, int trace);
-  int ExecuteNEGX(int opcode, std::string &description, int trace);
-  int ExecuteNOP(int opcode, std::string &description, int trace);
-  int ExecuteNOT(int opcode, std::string &description, int trace);
-  int ExecuteOR(int opcode, std::string &description, int trace);
-  int ExecuteORI(int opcode, std::string &description, int trace);
-  int ExecuteORItoCCR(int opcode, std::string &description, int trace);
-  int ExecuteORItoSR(int opcode, std::string &description, int trace);
-  int ExecutePEA(int opcode, std::string &description, int trace);
-  int ExecuteRESET(int opcode, std::string &description, int trace);
-  int ExecuteROL(int opcode, std::string &description, int trace);
-  int ExecuteROR(int opcode, std::string &description, int trace);
-  int ExecuteROXL(int opcode, std::string &description, int trace);
-  int ExecuteROXR(int opcode, std::string &description, int trace);
-  int ExecuteRTE(int opcode, std::string &description, int trace);
+  int ExecuteMULL(int opcode);
+  int ExecuteMULU(int opcode);
+  int ExecuteNBCD(int opcode);
+  int ExecuteNEG(int opcode);
+  int ExecuteNEGX(int opcode);
+  int ExecuteNOP(int opcode);
+  int ExecuteNOT(int opcode);
+  int ExecuteOR(int opcode);
+  int ExecuteORI(int opcode);
+  int ExecuteORItoCCR(int opcode);
+  int ExecuteORItoSR(int opcode);
+  int ExecutePEA(int opcode);
+  int ExecuteRESET(int opcode);
+  int ExecuteROL(int opcode);
+  int ExecuteROR(int opcode);
+  int ExecuteROXL(int opcode);
+  int ExecuteROXR(int opcode);
+  int ExecuteRTE(int opcode);
   // RTD: return and deallocate
-  int ExecuteRTD(int opcode, std::string &description, int trace);
-  int ExecuteRTR(int opcode, std::string &description, int trace);
-  int ExecuteRTS(int opcode, std::string &description, int trace);
-  int ExecuteSBCD(int opcode, std::string &description, int trace);
-  int ExecuteSTOP(int opcode, std::string &description, int trace);
-  int ExecuteSUB(int opcode, std::string &description, int trace);
-  int ExecuteSUBA(int opcode, std::string &description, int trace);
-  int ExecuteSUBI(int opcode, std::string &description, int trace);
-  int ExecuteSUBQ(int opcode, std::string &description, int trace);
-  int ExecuteSUBX(int opcode, std::string &description, int trace);
-  int ExecuteSWAP(int opcode, std::string &description, int trace);
-  int ExecuteScc(int opcode, std::string &description, int trace);
-  int ExecuteTAS(int opcode, std::string &description, int trace);
-  int ExecuteTRAP(int opcode, std::string &description, int trace);
-  int ExecuteTRAPV(int opcode, std::string &description, int trace);
-  int ExecuteTST(int opcode, std::string &description, int trace);
-  int ExecuteUNLK(int opcode, std::string &description, int trace);
-  int ExecuteInvalid(int opcode, std::string &description, int trace);
-
-  int ExecuteBusError(int opcode, std::string &description, int trace);
-  int ExecuteAddressError(int opcode, std::string &description, int trace);
+  int ExecuteRTD(int opcode);
+  int ExecuteRTR(int opcode);
+  int ExecuteRTS(int opcode);
+  int ExecuteSBCD(int opcode);
+  int ExecuteSTOP(int opcode);
+  int ExecuteSUB(int opcode);
+  int ExecuteSUBA(int opcode);
+  int ExecuteSUBI(int opcode);
+  int ExecuteSUBQ(int opcode);
+  int ExecuteSUBX(int opcode);
+  int ExecuteSWAP(int opcode);
+  int ExecuteScc(int opcode);
+  int ExecuteTAS(int opcode);
+  int ExecuteTRAP(int opcode);
+  int ExecuteTRAPV(int opcode);
+  int ExecuteTST(int opcode);
+  int ExecuteUNLK(int opcode);
+  int ExecuteInvalid(int opcode);
+
+  // Routines to disassemble the instruction at pc, which is advanced past
+  // any extension words
+  void DisassembleABCD(int opcode, unsigned long &pc, std::string &mnemonic);
+  void DisassembleADD(int opcode, unsigned long &pc, std::string &mnemonic);
+  void DisassembleADDA(int opcode, unsigned long &pc, std::string &mnemonic);
+  void DisassembleADDI(int opcode, unsigned long &pc, std::string &mnemonic);
+  void DisassembleADDQ(int opcode, unsigned long &pc, std::string &mnemonic);
+  void DisassembleADDX(int opcode, unsigned long &pc, std::string &mnemonic);
+  void DisassembleAND(int opcode, unsigned long &pc, std::string &mnemonic);
+  void DisassembleANDI(int opcode, unsigned long &pc, std::string &mnemonic);
+  void DisassembleANDItoCCR(int opcode, unsigned long &pc,
+                            std::string &mnemonic);
+  void DisassembleANDItoSR(int opcode, unsigned long &pc,
+                           std::string &mnemonic);
+  void DisassembleASL(int opcode, unsigned long &pc, std::string &mnemonic);
+  void DisassembleASR(int opcode, unsigned long &pc, std::string &mnemonic);
+  void DisassembleBRA(int opcode, unsigned long &pc, std::string &mnemonic);
+  void DisassembleBREAK(int opcode, unsigned long &pc, std::string &mnemonic);
+  void DisassembleBSR(int opcode, unsigned long &pc, std::string &mnemonic);
+  void DisassembleBcc(int opcode, unsigned long &pc, std::string &mnemonic);
+  void DisassembleBit(int opcode, unsigned long &pc, std::string &mnemonic);
+  void DisassembleCHK(int opcode, unsigned long &pc, std::string &mnemonic);
+  void DisassembleCLR(int opcode, unsigned long &pc, std::string &mnemonic);
+  void DisassembleCMP(int opcode, unsigned long &pc, std::string &mnemonic);
+  void DisassembleCMPA(int opcode, unsigned long &pc, std::string &mnemonic);
+  void DisassembleCMPI(int opcode, unsigned long &pc, std::string &mnemonic);
+  void DisassembleCMPM(int opcode, unsigned long &pc, std::string &mnemonic);
+  void DisassembleDBcc(int opcode, unsigned long &pc, std::string &mnemonic);
+  void DisassembleDIVS(int opcode, unsigned long &pc, std::string &mnemonic);
+  void DisassembleDIVU(int opcode, unsigned long &pc, std::string &mnemonic);
+  void DisassembleDIVL(int opcode, unsigned long &pc, std::string &mnemonic);
+  void DisassembleEOR(int opcode, unsigned long &pc, std::string &mnemonic);
+  void DisassembleEORI(int opcode, unsigned long &pc, std::string &mnemonic);
+  void DisassembleEORItoCCR(int opcode, unsigned long &pc,
+                            std::string &mnemonic);
+  void DisassembleEORItoSR(int opcode, unsigned long &pc,
+                           std::string &mnemonic);
+  void DisassembleEXG(int opcode, unsigned long &pc, std::string &mnemonic);
+  void DisassembleEXT(int opcode, unsigned long &pc, std::string &mnemonic);
+  void DisassembleILLEGAL(int opcode, unsigned long &pc, std::string &mnemonic);
+  void DisassembleJMP(int opcode, unsigned long &pc, std::string &mnemonic);
+  void DisassembleJSR(int opcode, unsigned long &pc, std::string &mnemonic);
+  void DisassembleLEA(int opcode, unsigned long &pc, std::string &mnemonic);
+  void DisassembleLINK(int opcode, unsigned long &pc, std::string &mnemonic);
+  void DisassembleLSL(int opcode, unsigned long &pc, std::string &mnemonic);
+  void DisassembleLSR(int opcode, unsigned long &pc, std::string &mnemonic);
+  void DisassembleMOVE(int opcode, unsigned long &pc, std::string &mnemonic);
+  void DisassembleMOVEA(int opcode, unsigned long &pc, std::string &mnemonic);
+  void DisassembleMOVES(int opcode, unsigned long &pc, std::string &mnemonic);
+  void DisassembleMOVEC(int opcode, unsigned long &pc, std::string &mnemonic);
+  void DisassembleMOVEM(int opcode, unsigned long &pc, std::string &mnemonic);
+  void DisassembleMOVEP(int opcode, unsigned long &pc, std::string &mnemonic);
+  void DisassembleMOVEQ(int opcode, unsigned long &pc, std::string &mnemonic);
+  void DisassembleMOVEUSP(int opcode, unsigned long &pc, std::string &mnemonic);
+  void DisassembleMOVEfromSR(int opcode, unsigned long &pc,
+                             std::string &mnemonic);
+  void DisassembleMOVEtoCCR(int opcode, unsigned long &pc,
+                            std::string &mnemonic);
+  void DisassembleMOVEtoSR(int opcode, unsigned long &pc,
+                           std::string &mnemonic);
+  void DisassembleMULS(int opcode, unsigned long &pc, std::string &mnemonic);
+  void DisassembleMULL(int opcode, unsigned long &pc, std::string &mnemonic);
+  void DisassembleMULU(int opcode, unsigned long &pc, std::string &mnemonic);
+  void DisassembleNBCD(int opcode, unsigned long &pc, std::string &mnemonic);
+  void DisassembleNEG(int opcode, unsigned long &pc, std::string &mnemonic);
+  void DisassembleNEGX(int opcode, unsigned long &pc, std::string &mnemonic);
+  void DisassembleNOP(int opcode, unsigned long &pc, std::string &mnemonic);
+  void DisassembleNOT(int opcode, unsigned long &pc, std::string &mnemonic);
+  void DisassembleOR(int opcode, unsigned long &pc, std::string &mnemonic);
+  void DisassembleORI(int opcode, unsigned long &pc, std::string &mnemonic);
+  void DisassembleORItoCCR(int opcode, unsigned long &pc,
+                           std::string &mnemonic);
+  void DisassembleORItoSR(int opcode, unsigned long &pc, std::string &mnemonic);
+  void DisassemblePEA(int opcode, unsigned long &pc, std::string &mnemonic);
+  void DisassembleRESET(int opcode, unsigned long &pc, std::string &mnemonic);
+  void DisassembleROL(int opcode, unsigned long &pc, std::string &mnemonic);
+  void DisassembleROR(int opcode, unsigned long &pc, std::string &mnemonic);
+  void DisassembleROXL(int opcode, unsigned long &pc, std::string &mnemonic);
+  void DisassembleROXR(int opcode, unsigned long &pc, std::string &mnemonic);
+  void DisassembleRTE(int opcode, unsigned long &pc, std::string &mnemonic);
+  void DisassembleRTD(int opcode, unsigned long &pc, std::string &mnemonic);
+  void DisassembleRTR(int opcode, unsigned long &pc, std::string &mnemonic);
+  void DisassembleRTS(int opcode, unsigned long &pc, std::string &mnemonic);
+  void DisassembleSBCD(int opcode, unsigned long &pc, std::string &mnemonic);
+  void DisassembleSTOP(int opcode, unsigned long &pc, std::string &mnemonic);
+  void DisassembleSUB(int opcode, unsigned long &pc, std::string &mnemonic);
+  void DisassembleSUBA(int opcode, unsigned long &pc, std::string &mnemonic);
+  void DisassembleSUBI(int opcode, unsigned long &pc, std::string &mnemonic);
+  void DisassembleSUBQ(int opcode, unsigned long &pc, std::string &mnemonic);
+  void DisassembleSUBX(int opcode, unsigned long &pc, std::string &mnemonic);
+  void DisassembleSWAP(int opcode, unsigned long &pc, std::string &mnemonic);
+  void DisassembleScc(int opcode, unsigned long &pc, std::string &mnemonic);
+  void DisassembleTAS(int opcode, unsigned long &pc, std::string &mnemonic);
+  void DisassembleTRAP(int opcode, unsigned long &pc, std::string &mnemonic);
+  void DisassembleTRAPV(int opcode, unsigned long &pc, std::string &mnemonic);
+  void DisassembleTST(int opcode, unsigned long &pc, std::string &mnemonic);
+  void DisassembleUNLK(int opcode, unsigned long &pc, std::string &mnemonic);
+  void DisassembleInvalid(int opcode, unsigned long &pc, std::string &mnemonic);
+
+  // Disassembly routines shared by similar instructions
+  void DisassembleArithmetic(const char *name, int opcode, unsigned long &pc,
+                             std::string &mnemonic);
+  void DisassembleMultiply(const char *name, int opcode, unsigned long &pc,
+                           std::string &mnemonic);
+  void DisassembleShift(const char *name, int opcode, unsigned long &pc,
+                        std::string &mnemonic);
+  void DisassembleUnary(const char *name, int opcode, unsigned long &pc,
+                        std::string &mnemonic);
+
+  int ExecuteBusError(int opcode);
+  int ExecuteAddressError(int opcode);
 
   // Helpful routines for executing instructions
   int ComputeEffectiveAddress(unsigned long &address, int &in_register,
-                              std::string &description, int mode_register, int size,
-                              int trace);
+                              int mode_register, int size);
+
+  // Appends the effective address given by the mode and register bits to
+  // the description, advancing pc past its extension words
+  void DescribeEffectiveAddress(unsigned long &pc, std::string &description,
+                                int mode_register, int size);
+
+  // Appends the index register, size and scale of an extension word to the
+  // description
+  void DescribeIndexRegister(unsigned int extend_word,
+                             std::string &description);
+
+  // Returns the base displacement of an index extension word, advancing pc
+  // past any displacement words
+  unsigned int IndexDisplacement(unsigned long &pc, unsigned int extend_word);
+
+  // Returns the name of address register An (A7' in supervisor mode)
+  const std::string &AddressRegisterName(int number);
 
   int Peek(unsigned long address, unsigned int &value, int size);
   int Poke(unsigned long address, unsigned int value, int size);
 
   unsigned int SignExtend(unsigned int value, int size);
 
+  // Records the operation so the condition codes given by the mask can be
+  // computed when they're needed
   void SetConditionCodes(unsigned int src, unsigned int dest,
                          unsigned int result, int size, int operation,
                          int mask);
 
+  // Sets the condition codes given by the mask in the status register
+  void ComputeConditionCodes(unsigned int src, unsigned int dest,
+                             unsigned int result, int size, int operation,
+                             int mask);
+
+  // Brings the condition codes in the status register up to date
+  void EvaluateConditionCodes() {
+    if (myPendingConditionCodes.mask != 0) {
+      const PendingConditionCodes &p = myPendingConditionCodes;
+      ComputeConditionCodes(p.src, p.dest, p.result, p.size, p.operation,
+                            p.mask);
+      myPendingConditionCodes.mask = 0;
+    }
+  }
+
   void ClearConditionCodes(int mask);
 
-  int CheckConditionCodes(int code, std::string &mnemonic, int trace);
+  int CheckConditionCodes(int code);
+
+  // Condition names for Bcc, DBcc and Scc indexed by the condition code
+  static const char *ourConditionNames[];
+
+  // Exception raised by the last instruction, reported in place of its
+  // disassembly in the trace record
+  const char *myExceptionMnemonic;
 
   void SetRegister(int register_number, unsigned int value, int size);
 
   int ProcessException(int vector);
 
-  struct PendingInterrupt {
-    PendingInterrupt(long l, BasicDevice *d) : level(l), device(d) { }
-    long level;
-    BasicDevice *device;
-    bool operator==(const PendingInterrupt &a) {
-      return level == a.level && device == a.device;
-    }
-    struct Compare {
-      bool operator()(const PendingInterrupt &a, const PendingInterrupt &b) {
-        return a.level > b.level;
-      }
-    };
-  };
-
-  std::priority_queue<
-      PendingInterrupt,
-      std::vector<PendingInterrupt>,
-      PendingInterrupt::Compare> pending_interrupts;
+  // Interrupts requested by devices and not yet serviced
+  InterruptController myInterrupts;
 };
 
 #endif  // M68K_SIM68360_CPU32_H_
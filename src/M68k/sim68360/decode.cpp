@@ -1,24 +1,30 @@
+#include <algorithm>
+#include <string>
+
 #include "M68k/sim68360/cpu32.hpp"
 
-cpu32::DecodeEntry cpu32::ourDecodeTable[] = {
 #include "M68k/sim68360/DecodeTable.hpp"
-};
-
-cpu32::ExecutionPointer *cpu32::ourDecodeCacheTable = nullptr;
-
-cpu32::ExecutionPointer cpu32::DecodeInstruction(int opcode) {
-  // Check to see if this opcode needs to be decoded
-  if (ourDecodeCacheTable[opcode] == 0) {
-    // Decode the opcode using a linear search (slow :-{ )
-    for (size_t s = 0; s < (sizeof(ourDecodeTable) / sizeof(DecodeEntry)); ++s) {
-      if ((opcode & ourDecodeTable[s].mask) == ourDecodeTable[s].signature) {
-        ourDecodeCacheTable[opcode] = ourDecodeTable[s].execute;
-      }
-    }
 
-    // If not found then it's an invalid instruction
-    if (ourDecodeCacheTable[opcode] == 0)
-      ourDecodeCacheTable[opcode] = &cpu32::ExecuteInvalid;
+bool cpu32::EndsBlock(ExecutionPointer execute) {
+  static const ExecutionPointer branches[] = {
+      &cpu32::ExecuteBRA,   &cpu32::ExecuteBSR,     &cpu32::ExecuteBcc,
+      &cpu32::ExecuteDBcc,  &cpu32::ExecuteJMP,     &cpu32::ExecuteJSR,
+      &cpu32::ExecuteRTE,   &cpu32::ExecuteRTR,     &cpu32::ExecuteRTS,
+      &cpu32::ExecuteRTD,   &cpu32::ExecuteTRAP,    &cpu32::ExecuteTRAPV,
+      &cpu32::ExecuteCHK,   &cpu32::ExecuteSTOP,    &cpu32::ExecuteBREAK,
+      &cpu32::ExecuteILLEGAL, &cpu32::ExecuteInvalid};
+  for (auto branch : branches) {
+    if (execute == branch)
+      return true;
   }
-  return ourDecodeCacheTable[opcode];
+  return false;
+}
+
+// Answers the number of bytes the instruction has after its opcode word,
+// which the disassembler works out
+size_t cpu32::OperandLength(unsigned int opcode, Address pc) {
+  std::string mnemonic;
+  unsigned long next = pc + 2;
+  (this->*DecodeInstruction(opcode).disassemble)(opcode, next, mnemonic);
+  return std::min<size_t>(Address(next - pc - 2), OPERAND_BYTES);
 }
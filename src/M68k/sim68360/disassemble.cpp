@@ -0,0 +1,1308 @@
+//
+// Functions to disassemble CPU32 instructions for the trace record.  Each
+// routine appends the {Mnemonic ...} field for an instruction and advances
+// the pc past its extension words without changing the CPU's state.
+//
+
+#include <string>
+
+#include "Framework/AddressSpace.hpp"
+#include "Framework/Tools.hpp"
+#include "M68k/sim68360/cpu32.hpp"
+
+// Condition names indexed by the condition code field
+const char *cpu32::ourConditionNames[] = {
+    "T",  "F",  "HI", "LS", "CC", "CS", "NE", "EQ",
+    "VC", "VS", "PL", "MI", "GE", "LT", "GT", "LE"};
+
+namespace {
+
+// Returns the size suffix of the mnemonic
+const char *SizeSuffix(int size) {
+  switch (size) {
+  case BYTE:
+    return ".B ";
+  case WORD:
+    return ".W ";
+  case LONG:
+    return ".L ";
+  default:
+    return "";
+  }
+}
+
+} // namespace
+
+// Disassemble the instruction at the given address
+void cpu32::DisassembleInstruction(Address address, std::string &mnemonic) {
+  unsigned int opcode;
+
+  if (Peek(address, opcode, WORD) != EXECUTE_OK)
+    return;
+
+  unsigned long pc = address + 2;
+  (this->*DecodeInstruction(opcode).disassemble)(opcode, pc, mnemonic);
+}
+
+// Get the name of the address register
+const std::string &cpu32::AddressRegisterName(int number) {
+  if ((number == 7) && (register_value[SR_INDEX] & S_FLAG))
+    return ourRegisterData[SSP_INDEX].name;
+  else
+    return ourRegisterData[A0_INDEX + number].name;
+}
+
+// Describe the index register, size and scale of an extension word
+void cpu32::DescribeIndexRegister(unsigned int extend_word,
+                                  std::string &description) {
+  if (extend_word & 0x8000)
+    description += AddressRegisterName((extend_word >> 12) & 7);
+  else
+    description += ourRegisterData[D0_INDEX + ((extend_word >> 12) & 7)].name;
+
+  if (extend_word & 0x0800)
+    description += ".L";
+  else
+    description += ".W";
+
+  if ((extend_word & 0x600) == 0x600)
+    description += "*8";
+  else if (extend_word & 0x400)
+    description += "*4";
+  else if (extend_word & 0x200)
+    description += "*2";
+  description += ")";
+}
+
+// Get the base displacement of an index extension word
+unsigned int cpu32::IndexDisplacement(unsigned long &pc,
+                                      unsigned int extend_word) {
+  unsigned int displacement = 0;
+
+  // Brief Extension Word Format
+  if (!(extend_word & 0x100))
+    return SignExtend(extend_word & 0xff, BYTE);
+
+  // Full Extension Word Format
+  if ((extend_word & 0x30) == 0x20) {
+    Peek(pc, displacement, WORD);
+    pc += 2;
+    displacement = SignExtend(displacement, WORD);
+  } else if ((extend_word & 0x30) == 0x30) {
+    Peek(pc, displacement, LONG);
+    pc += 4;
+  }
+  return displacement;
+}
+
+// Describe the effective address, given the mode and register bits
+void cpu32::DescribeEffectiveAddress(unsigned long &pc,
+                                     std::string &description,
+                                     int mode_register, int size) {
+  unsigned int extend_word = 0;
+
+  switch (mode_register >> 3) {
+  case 0: // Data Register Direct
+    description += ourRegisterData[D0_INDEX + (mode_register & 7)].name;
+    break;
+
+  case 1: // Address Register Direct
+    description += AddressRegisterName(mode_register & 7);
+    break;
+
+  case 2: // Address Register Indirect
+    description += "(";
+    description += AddressRegisterName(mode_register & 7);
+    description += ")";
+    break;
+
+  case 3: // Address Register Indirect with Post-Increment
+    description += "(";
+    description += AddressRegisterName(mode_register & 7);
+    description += ")+";
+    break;
+
+  case 4: // Address Register Indirect with Pre-Decrement
+    description += "-(";
+    description += AddressRegisterName(mode_register & 7);
+    description += ")";
+    break;
+
+  case 5: // Address Register Indirect with Displacement
+    Peek(pc, extend_word, WORD);
+    pc += 2;
+    description += "($";
+    description += IntToString(extend_word, 4);
+    description += ",";
+    description += AddressRegisterName(mode_register & 7);
+    description += ")";
+    break;
+
+  case 6: // Address Register Indirect with Index and n-bit Displacement
+    Peek(pc, extend_word, WORD);
+    pc += 2;
+    description += "($";
+    if (!(extend_word & 0x100))
+      description += IntToString(IndexDisplacement(pc, extend_word), 2);
+    else if ((extend_word & 0x30) == 0x20)
+      description += IntToString(IndexDisplacement(pc, extend_word), 4);
+    else if ((extend_word & 0x30) == 0x30)
+      description += IntToString(IndexDisplacement(pc, extend_word), 8);
+    else
+      description += "0";
+    // 0x180 is full extension format + base register suppress
+    if ((extend_word & 0x180) != 0x180) {
+      description += ",";
+      description += AddressRegisterName(mode_register & 7);
+    }
+    description += ",";
+    DescribeIndexRegister(extend_word, description);
+    break;
+
+  case 7:
+    switch (mode_register & 7) {
+    case 0: // Absolute Short Address
+      Peek(pc, extend_word, WORD);
+      pc += 2;
+      description += IntToString(extend_word, 4);
+      description += ".W";
+      break;
+
+    case 1: // Absolute Long Address
+      Peek(pc, extend_word, LONG);
+      pc += 4;
+      description += IntToString(extend_word, 8);
+      description += ".L";
+      break;
+
+    case 2: // Program Counter with Displacement
+      Peek(pc, extend_word, WORD);
+      pc += 2;
+      description += "($";
+      description += IntToString(extend_word, 4);
+      description += ",PC)";
+      break;
+
+    case 3: // Program Counter with Index and n-bit Displacement
+      Peek(pc, extend_word, WORD);
+      pc += 2;
+      description += "($";
+      description += IntToString(IndexDisplacement(pc, extend_word), 4);
+      description += ",";
+      // Not 'PC suppress'
+      if ((extend_word & 0x180) != 0x180)
+        description += "PC,";
+      DescribeIndexRegister(extend_word, description);
+      break;
+
+    case 4: // Immediate Data
+      description += "#$";
+      if (size == BYTE) {
+        Peek(pc + 1, extend_word, BYTE);
+        description += IntToString(extend_word, 2);
+      } else if (size == WORD) {
+        Peek(pc, extend_word, WORD);
+        description += IntToString(extend_word, 4);
+      } else {
+        Peek(pc, extend_word, LONG);
+        description += IntToString(extend_word, 8);
+      }
+      pc += (size == LONG) ? 4 : 2;
+      break;
+    }
+    break;
+  }
+}
+
+// Disassemble the 'ABCD' instruction
+void cpu32::DisassembleABCD(int opcode, unsigned long &pc,
+                            std::string &mnemonic) {
+  mnemonic += "{Mnemonic {ABCD.B ";
+  if (opcode & 8) {
+    DescribeEffectiveAddress(pc, mnemonic, 0x20 | (opcode & 7), BYTE);
+    mnemonic += ",";
+    DescribeEffectiveAddress(pc, mnemonic, 0x20 | ((opcode & 0x0e00) >> 9),
+                             BYTE);
+  } else {
+    mnemonic += ourRegisterData[D0_INDEX + (opcode & 7)].name;
+    mnemonic += ",";
+    mnemonic += ourRegisterData[D0_INDEX + ((opcode & 0x0e00) >> 9)].name;
+  }
+  mnemonic += "}} ";
+}
+
+// Disassemble the ADD, AND, OR and SUB instructions
+void cpu32::DisassembleArithmetic(const char *name, int opcode,
+                                  unsigned long &pc, std::string &mnemonic) {
+  const int size = (opcode & 0x00c0) >> 6;
+  const std::string &register_name =
+      ourRegisterData[D0_INDEX + ((opcode & 0x0e00) >> 9)].name;
+
+  mnemonic += "{Mnemonic {";
+  mnemonic += name;
+  mnemonic += SizeSuffix(size);
+  if (opcode & 0x0100) {
+    mnemonic += register_name;
+    mnemonic += ",";
+    DescribeEffectiveAddress(pc, mnemonic, opcode & 0x3f, size);
+  } else {
+    DescribeEffectiveAddress(pc, mnemonic, opcode & 0x3f, size);
+    mnemonic += ",";
+    mnemonic += register_name;
+  }
+  mnemonic += "}} ";
+}
+
+// Disassemble the 'ADD' instruction
+void cpu32::DisassembleADD(int opcode, unsigned long &pc,
+                           std::string &mnemonic) {
+  DisassembleArithmetic("ADD", opcode, pc, mnemonic);
+}
+
+// Disassemble the 'ADDA' instruction
+void cpu32::DisassembleADDA(int opcode, unsigned long &pc,
+                            std::string &mnemonic) {
+  const int size = (opcode & 0x0100) ? LONG : WORD;
+
+  mnemonic += "{Mnemonic {ADDA";
+  mnemonic += SizeSuffix(size);
+  DescribeEffectiveAddress(pc, mnemonic, opcode & 0x3f, size);
+  mnemonic += ",";
+  mnemonic += AddressRegisterName((opcode & 0x0e00) >> 9);
+  mnemonic += "}} ";
+}
+
+// Disassemble the 'ADDI' instruction
+void cpu32::DisassembleADDI(int opcode, unsigned long &pc,
+                            std::string &mnemonic) {
+  const int size = (opcode & 0x00c0) >> 6;
+
+  mnemonic += "{Mnemonic {ADDI";
+  mnemonic += SizeSuffix(size);
+  DescribeEffectiveAddress(pc, mnemonic, 0x3c, size);
+  mnemonic += ",";
+  DescribeEffectiveAddress(pc, mnemonic, opcode & 0x3f, size);
+  mnemonic += "}} ";
+}
+
+// Disassemble the 'ADDQ' instruction
+void cpu32::DisassembleADDQ(int opcode, unsigned long &pc,
+                            std::string &mnemonic) {
+  const int size = (opcode & 0x00c0) >> 6;
+  const int data = ((opcode & 0x0e00) >> 9) ? (opcode & 0x0e00) >> 9 : 8;
+
+  mnemonic += "{Mnemonic {ADDQ";
+  mnemonic += SizeSuffix(size);
+  mnemonic += "#$";
+  mnemonic += IntToString(data, 1);
+  mnemonic += ",";
+  DescribeEffectiveAddress(pc, mnemonic, opcode & 0x3f, size);
+  mnemonic += "}} ";
+}
+
+// Disassemble the 'ADDX' instruction
+void cpu32::DisassembleADDX(int opcode, unsigned long &pc,
+                            std::string &mnemonic) {
+  const int size = (opcode & 0x00c0) >> 6;
+
+  mnemonic += "{Mnemonic {ADDX";
+  mnemonic += SizeSuffix(size);
+  if (opcode & 8) {
+    DescribeEffectiveAddress(pc, mnemonic, 0x20 | (opcode & 7), size);
+    mnemonic += ",";
+    DescribeEffectiveAddress(pc, mnemonic, 0x20 | ((opcode & 0x0e00) >> 9),
+                             size);
+  } else {
+    mnemonic += ourRegisterData[D0_INDEX + (opcode & 7)].name;
+    mnemonic += ",";
+    mnemonic += ourRegisterData[D0_INDEX + ((opcode & 0x0e00) >> 9)].name;
+  }
+  mnemonic += "}} ";
+}
+
+// Disassemble the 'AND' instruction
+void cpu32::DisassembleAND(int opcode, unsigned long &pc,
+                           std::string &mnemonic) {
+  DisassembleArithmetic("AND", opcode, pc, mnemonic);
+}
+
+// Disassemble the 'ANDI' instruction
+void cpu32::DisassembleANDI(int opcode, unsigned long &pc,
+                            std::string &mnemonic) {
+  const int size = (opcode & 0x00c0) >> 6;
+
+  mnemonic += "{Mnemonic {ANDI";
+  mnemonic += SizeSuffix(size);
+  DescribeEffectiveAddress(pc, mnemonic, 0x3c, size);
+  mnemonic += ",";
+  DescribeEffectiveAddress(pc, mnemonic, opcode & 0x3f, size);
+  mnemonic += "}} ";
+}
+
+// Disassemble the 'ANDItoCCR' instruction
+void cpu32::DisassembleANDItoCCR(int, unsigned long &pc,
+                                 std::string &mnemonic) {
+  mnemonic += "{Mnemonic {ANDI.B ";
+  DescribeEffectiveAddress(pc, mnemonic, 0x3c, BYTE);
+  mnemonic += ",CCR}} ";
+}
+
+// Disassemble the 'ANDItoSR' instruction
+void cpu32::DisassembleANDItoSR(int, unsigned long &pc, std::string &mnemonic) {
+  mnemonic += "{Mnemonic {ANDI.W ";
+  DescribeEffectiveAddress(pc, mnemonic, 0x3c, WORD);
+  mnemonic += ",SR}} ";
+}
+
+// Disassemble the shift and rotate instructions
+void cpu32::DisassembleShift(const char *name, int opcode, unsigned long &pc,
+                             std::string &mnemonic) {
+  mnemonic += "{Mnemonic {";
+  mnemonic += name;
+
+  // Check to see if this is a memory or register shift
+  if (((opcode & 0x00c0) >> 6) == 3) {
+    mnemonic += ".W ";
+    DescribeEffectiveAddress(pc, mnemonic, opcode & 0x3f, WORD);
+  } else {
+    mnemonic += SizeSuffix((opcode & 0x00c0) >> 6);
+    if (opcode & 32) {
+      mnemonic += ourRegisterData[D0_INDEX + ((opcode & 0x0e00) >> 9)].name;
+    } else {
+      mnemonic += "#$";
+      mnemonic += IntToString(((opcode & 0x0e00) >> 9) ? (opcode & 0x0e00) >> 9
+                                                       : 8,
+                              1);
+    }
+    mnemonic += ",";
+    mnemonic += ourRegisterData[D0_INDEX + (opcode & 7)].name;
+  }
+  mnemonic += "}} ";
+}
+
+// Disassemble the 'ASL' instruction
+void cpu32::DisassembleASL(int opcode, unsigned long &pc,
+                           std::string &mnemonic) {
+  DisassembleShift("ASL", opcode, pc, mnemonic);
+}
+
+// Disassemble the 'ASR' instruction
+void cpu32::DisassembleASR(int opcode, unsigned long &pc,
+                           std::string &mnemonic) {
+  DisassembleShift("ASR", opcode, pc, mnemonic);
+}
+
+// Disassemble the 'BRA' instruction
+void cpu32::DisassembleBRA(int opcode, unsigned long &pc,
+                           std::string &mnemonic) {
+  unsigned int displacement = opcode & 0xff;
+
+  mnemonic += "{Mnemonic {BRA";
+  if (displacement == 0xff) {
+    Peek(pc, displacement, LONG);
+    pc += 4;
+    mnemonic += ".L $";
+    mnemonic += IntToString(displacement, 8);
+  } else if (displacement == 0) {
+    Peek(pc, displacement, WORD);
+    pc += 2;
+    mnemonic += ".W $";
+    mnemonic += IntToString(SignExtend(displacement, WORD), 4);
+  } else {
+    mnemonic += ".B $";
+    mnemonic += IntToString(SignExtend(displacement, BYTE), 2);
+  }
+  mnemonic += "}} ";
+}
+
+// Disassemble the 'BREAK' instruction
+void cpu32::DisassembleBREAK(int, unsigned long &, std::string &mnemonic) {
+  mnemonic += "{Mnemonic {BREAK}} ";
+}
+
+// Disassemble the 'BSR' instruction
+void cpu32::DisassembleBSR(int opcode, unsigned long &pc,
+                           std::string &mnemonic) {
+  unsigned int displacement = opcode & 0xff;
+
+  mnemonic += "{Mnemonic {BSR";
+  if (displacement == 0xff) {
+    Peek(pc, displacement, LONG);
+    pc += 4;
+    mnemonic += ".L $";
+    mnemonic += IntToString(displacement, 8);
+    mnemonic += "}} ";
+  } else if (displacement == 0) {
+    Peek(pc, displacement, WORD);
+    pc += 2;
+    mnemonic += ".W $";
+    mnemonic += IntToString(SignExtend(displacement, WORD), 4);
+    mnemonic += "}} ";
+  } else {
+    mnemonic += ".B $";
+    mnemonic += IntToString(SignExtend(displacement, BYTE), 2);
+    mnemonic += "}}  ";
+  }
+}
+
+// Disassemble the 'Bcc' instructions
+void cpu32::DisassembleBcc(int opcode, unsigned long &pc,
+                           std::string &mnemonic) {
+  unsigned int displacement = opcode & 0xff;
+
+  mnemonic += "{Mnemonic {B";
+  mnemonic += ourConditionNames[(opcode & 0x0f00) >> 8];
+  if (displacement == 0xff) {
+    Peek(pc, displacement, LONG);
+    pc += 4;
+    mnemonic += ".L $";
+    mnemonic += IntToString(displacement, 8);
+  } else if (displacement == 0) {
+    Peek(pc, displacement, WORD);
+    pc += 2;
+    mnemonic += ".W $";
+    mnemonic += IntToString(displacement, 4);
+  } else {
+    mnemonic += ".B $";
+    mnemonic += IntToString(displacement, 2);
+  }
+  mnemonic += "}} ";
+}
+
+// Disassemble the bit instructions (BTST, BCHG, BCLR and BSET)
+void cpu32::DisassembleBit(int opcode, unsigned long &pc,
+                           std::string &mnemonic) {
+  static const char *names[] = {"BTST", "BCHG", "BCLR", "BSET"};
+  std::string description;
+  int size;
+
+  // Get the bit number
+  if (opcode & 0x0100)
+    description = ourRegisterData[D0_INDEX + ((opcode & 0x0e00) >> 9)].name;
+  else
+    DescribeEffectiveAddress(pc, description, 0x3c, WORD);
+  description += ",";
+
+  // Data registers are LONG, everything else is BYTE
+  size = (opcode & 0x38) ? BYTE : LONG;
+  DescribeEffectiveAddress(pc, description, opcode & 0x3f, size);
+
+  mnemonic += "{Mnemonic {";
+  mnemonic += names[(opcode >> 6) & 3];
+  mnemonic += SizeSuffix(size);
+  mnemonic += description;
+  mnemonic += "}} ";
+}
+
+// Disassemble the 'CHK' instruction
+void cpu32::DisassembleCHK(int opcode, unsigned long &pc,
+                           std::string &mnemonic) {
+  DisassembleInvalid(opcode, pc, mnemonic);
+}
+
+// Disassemble the 'CLR' instruction
+void cpu32::DisassembleCLR(int opcode, unsigned long &pc,
+                           std::string &mnemonic) {
+  DisassembleUnary("CLR", opcode, pc, mnemonic);
+}
+
+// Disassemble the 'CMP' instruction
+void cpu32::DisassembleCMP(int opcode, unsigned long &pc,
+                           std::string &mnemonic) {
+  const int size = (opcode & 0x00c0) >> 6;
+
+  mnemonic += "{Mnemonic {CMP";
+  mnemonic += SizeSuffix(size);
+  DescribeEffectiveAddress(pc, mnemonic, opcode & 0x3f, size);
+  mnemonic += ",";
+  mnemonic += ourRegisterData[D0_INDEX + ((opcode & 0x0e00) >> 9)].name;
+  mnemonic += "}} ";
+}
+
+// Disassemble the 'CMPA' instruction
+void cpu32::DisassembleCMPA(int opcode, unsigned long &pc,
+                            std::string &mnemonic) {
+  const int size = (opcode & 0x0100) ? LONG : WORD;
+
+  mnemonic += "{Mnemonic {CMPA";
+  mnemonic += SizeSuffix(size);
+  DescribeEffectiveAddress(pc, mnemonic, opcode & 0x3f, size);
+  mnemonic += ",";
+  mnemonic += AddressRegisterName((opcode & 0x0e00) >> 9);
+  mnemonic += "}} ";
+}
+
+// Disassemble the 'CMPI' instruction
+void cpu32::DisassembleCMPI(int opcode, unsigned long &pc,
+                            std::string &mnemonic) {
+  const int size = (opcode & 0x00c0) >> 6;
+
+  mnemonic += "{Mnemonic {CMPI";
+  mnemonic += SizeSuffix(size);
+  DescribeEffectiveAddress(pc, mnemonic, 0x3c, size);
+  mnemonic += ",";
+  DescribeEffectiveAddress(pc, mnemonic, opcode & 0x3f, size);
+  mnemonic += "}} ";
+}
+
+// Disassemble the 'CMPM' instruction
+void cpu32::DisassembleCMPM(int opcode, unsigned long &pc,
+                            std::string &mnemonic) {
+  const int size = (opcode & 0x00c0) >> 6;
+
+  mnemonic += "{Mnemonic {CMPM";
+  mnemonic += SizeSuffix(size);
+  DescribeEffectiveAddress(pc, mnemonic, 0x18 | (opcode & 7), size);
+  mnemonic += ",";
+  DescribeEffectiveAddress(pc, mnemonic, 0x18 | ((opcode & 0x0e00) >> 9),
+                           size);
+  mnemonic += "}} ";
+}
+
+// Disassemble the 'DBcc' instructions
+void cpu32::DisassembleDBcc(int opcode, unsigned long &pc,
+                            std::string &mnemonic) {
+  unsigned int displacement = 0;
+
+  Peek(pc, displacement, WORD);
+  pc += 2;
+
+  mnemonic += "{Mnemonic {DB";
+  mnemonic += ourConditionNames[(opcode & 0x0f00) >> 8];
+  mnemonic += ".W ";
+  mnemonic += ourRegisterData[D0_INDEX + (opcode & 7)].name;
+  mnemonic += ",$";
+  mnemonic += IntToString(SignExtend(displacement, WORD), 4);
+  mnemonic += "}} ";
+}
+
+// Disassemble the 'DIVS' instruction
+void cpu32::DisassembleDIVS(int opcode, unsigned long &pc,
+                            std::string &mnemonic) {
+  DisassembleMultiply("DIVS", opcode, pc, mnemonic);
+}
+
+// Disassemble the 'DIVU' instruction
+void cpu32::DisassembleDIVU(int opcode, unsigned long &pc,
+                            std::string &mnemonic) {
+  DisassembleMultiply("DIVU", opcode, pc, mnemonic);
+}
+
+// Disassemble the 'DIVL' instruction
+void cpu32::DisassembleDIVL(int opcode, unsigned long &pc,
+                            std::string &mnemonic) {
+  unsigned int opcode2 = 0;
+
+  Peek(pc, opcode2, WORD);
+  pc += 2;
+
+  mnemonic += "{Mnemonic {";
+  if (opcode2 & (1 << 10))
+    mnemonic += (opcode2 & (1 << 11)) ? "DIVSL.L " : "DIVUL.L ";
+  else
+    mnemonic += (opcode2 & (1 << 11)) ? "DIVS.L " : "DIVU.L ";
+  DescribeEffectiveAddress(pc, mnemonic, opcode & 0x3f, LONG);
+  mnemonic += ",";
+  mnemonic += ourRegisterData[D0_INDEX + (opcode2 & 0x7)].name;
+  mnemonic += ":";
+  mnemonic += ourRegisterData[D0_INDEX + ((opcode2 & 0x7000) >> 12)].name;
+  mnemonic += "}} ";
+}
+
+// Disassemble the 'EOR' instruction
+void cpu32::DisassembleEOR(int opcode, unsigned long &pc,
+                           std::string &mnemonic) {
+  const int size = (opcode & 0x00c0) >> 6;
+
+  mnemonic += "{Mnemonic {EOR";
+  mnemonic += SizeSuffix(size);
+  mnemonic += ourRegisterData[D0_INDEX + ((opcode & 0x0e00) >> 9)].name;
+  mnemonic += ",";
+  DescribeEffectiveAddress(pc, mnemonic, opcode & 0x3f, size);
+  mnemonic += "}} ";
+}
+
+// Disassemble the 'EORI' instruction
+void cpu32::DisassembleEORI(int opcode, unsigned long &pc,
+                            std::string &mnemonic) {
+  const int size = (opcode & 0x00c0) >> 6;
+
+  mnemonic += "{Mnemonic {EORI";
+  mnemonic += SizeSuffix(size);
+  DescribeEffectiveAddress(pc, mnemonic, 0x3c, size);
+  mnemonic += ",";
+  DescribeEffectiveAddress(pc, mnemonic, opcode & 0x3f, size);
+  mnemonic += "}} ";
+}
+
+// Disassemble the 'EORItoCCR' instruction
+void cpu32::DisassembleEORItoCCR(int, unsigned long &pc,
+                                 std::string &mnemonic) {
+  mnemonic += "{Mnemonic {EORI.B ";
+  DescribeEffectiveAddress(pc, mnemonic, 0x3c, BYTE);
+  mnemonic += ",CCR}} ";
+}
+
+// Disassemble the 'EORItoSR' instruction
+void cpu32::DisassembleEORItoSR(int, unsigned long &pc, std::string &mnemonic) {
+  mnemonic += "{Mnemonic {EORI.W ";
+  DescribeEffectiveAddress(pc, mnemonic, 0x3c, WORD);
+  mnemonic += ",SR}} ";
+}
+
+// Disassemble the 'EXG' instruction
+void cpu32::DisassembleEXG(int opcode, unsigned long &,
+                           std::string &mnemonic) {
+  const int rx = (opcode & 0x0e00) >> 9;
+  const int ry = opcode & 0x0007;
+
+  mnemonic += "{Mnemonic {EXG.L ";
+  switch ((opcode & 0x00f8) >> 3) {
+  case 8: // Data Registers
+    mnemonic += ourRegisterData[D0_INDEX + rx].name;
+    mnemonic += ",";
+    mnemonic += ourRegisterData[D0_INDEX + ry].name;
+    break;
+  case 9: // Address Registers
+    mnemonic += AddressRegisterName(rx);
+    mnemonic += ",";
+    mnemonic += AddressRegisterName(ry);
+    break;
+  case 17: // Data register and Address register
+    mnemonic += ourRegisterData[D0_INDEX + rx].name;
+    mnemonic += ",";
+    mnemonic += AddressRegisterName(ry);
+    break;
+  default:
+    mnemonic += ourRegisterData[D0_INDEX].name;
+    mnemonic += ",";
+    mnemonic += ourRegisterData[D0_INDEX].name;
+  }
+  mnemonic += "}} ";
+}
+
+// Disassemble the 'EXT' instruction
+void cpu32::DisassembleEXT(int opcode, unsigned long &,
+                           std::string &mnemonic) {
+  mnemonic += "{Mnemonic {EXT";
+  if (((opcode & 0x01c0) >> 6) == 2)
+    mnemonic += ".W ";
+  else if (((opcode & 0x01c0) >> 6) == 3)
+    mnemonic += ".L ";
+  else
+    mnemonic += "B.L ";
+  mnemonic += ourRegisterData[D0_INDEX + (opcode & 7)].name;
+  mnemonic += "}} ";
+}
+
+// Disassemble the 'ILLEGAL' instruction
+void cpu32::DisassembleILLEGAL(int, unsigned long &, std::string &mnemonic) {
+  mnemonic += "{Mnemonic {ILLEGAL}} ";
+}
+
+// Disassemble the 'JMP' instruction
+void cpu32::DisassembleJMP(int opcode, unsigned long &pc,
+                           std::string &mnemonic) {
+  mnemonic += "{Mnemonic {JMP ";
+  DescribeEffectiveAddress(pc, mnemonic, opcode & 0x3f, LONG);
+  mnemonic += "}} ";
+}
+
+// Disassemble the 'JSR' instruction
+void cpu32::DisassembleJSR(int opcode, unsigned long &pc,
+                           std::string &mnemonic) {
+  mnemonic += "{Mnemonic {JSR ";
+  DescribeEffectiveAddress(pc, mnemonic, opcode & 0x3f, LONG);
+  mnemonic += "}} ";
+}
+
+// Disassemble the 'LEA' instruction
+void cpu32::DisassembleLEA(int opcode, unsigned long &pc,
+                           std::string &mnemonic) {
+  // LEA with a data register is the EXTB instruction
+  if ((opcode & 0x38) == 0)
+    return DisassembleEXT(opcode, pc, mnemonic);
+
+  mnemonic += "{Mnemonic {LEA.L ";
+  DescribeEffectiveAddress(pc, mnemonic, opcode & 0x3f, LONG);
+  mnemonic += ",";
+  mnemonic += AddressRegisterName((opcode & 0x0e00) >> 9);
+  mnemonic += "}} ";
+}
+
+// Disassemble the 'LINK' instruction
+void cpu32::DisassembleLINK(int opcode, unsigned long &pc,
+                            std::string &mnemonic) {
+  mnemonic += "{Mnemonic {LINK ";
+  mnemonic += AddressRegisterName(opcode & 7);
+  mnemonic += ",";
+  DescribeEffectiveAddress(pc, mnemonic, 0x3c, WORD);
+  mnemonic += "}} ";
+}
+
+// Disassemble the 'LSL' instruction
+void cpu32::DisassembleLSL(int opcode, unsigned long &pc,
+                           std::string &mnemonic) {
+  DisassembleShift("LSL", opcode, pc, mnemonic);
+}
+
+// Disassemble the 'LSR' instruction
+void cpu32::DisassembleLSR(int opcode, unsigned long &pc,
+                           std::string &mnemonic) {
+  DisassembleShift("LSR", opcode, pc, mnemonic);
+}
+
+// Disassemble the 'MOVE' instruction
+void cpu32::DisassembleMOVE(int opcode, unsigned long &pc,
+                            std::string &mnemonic) {
+  static const int sizes[] = {0, BYTE, LONG, WORD};
+  const int size = sizes[(opcode & 0x3000) >> 12];
+
+  mnemonic += "{Mnemonic {MOVE";
+  mnemonic += SizeSuffix(size);
+  DescribeEffectiveAddress(pc, mnemonic, opcode & 0x3f, size);
+  mnemonic += ",";
+  DescribeEffectiveAddress(pc, mnemonic,
+                           ((opcode & 0x01c0) >> 3) | ((opcode & 0x0e00) >> 9),
+                           size);
+  mnemonic += "}} ";
+}
+
+// Disassemble the 'MOVEA' instruction
+void cpu32::DisassembleMOVEA(int opcode, unsigned long &pc,
+                             std::string &mnemonic) {
+  const int size = (((opcode & 0x3000) >> 12) == 3) ? WORD : LONG;
+
+  mnemonic += "{Mnemonic {MOVEA";
+  mnemonic += SizeSuffix(size);
+  DescribeEffectiveAddress(pc, mnemonic, opcode & 0x3f, size);
+  mnemonic += ",";
+  mnemonic += AddressRegisterName((opcode & 0x0e00) >> 9);
+  mnemonic += "}} ";
+}
+
+// Disassemble the 'MOVES' instruction
+void cpu32::DisassembleMOVES(int opcode, unsigned long &pc,
+                             std::string &mnemonic) {
+  static const int sizes[] = {BYTE, BYTE, LONG, WORD};
+  const int size = sizes[(opcode >> 6) & 0x3];
+  unsigned int opcode2 = 0;
+
+  Peek(pc, opcode2, WORD);
+  pc += 2;
+
+  const std::string &register_name =
+      ourRegisterData[((opcode2 & 0x8000) ? A0_INDEX : D0_INDEX) +
+                      ((opcode2 & 0x7000) >> 12)]
+          .name;
+
+  // Bit 11 gives the direction of the transfer
+  if (opcode2 & (1 << 11)) {
+    mnemonic += "{Mnemonic {MOVES";
+    mnemonic += SizeSuffix(size);
+    mnemonic += register_name;
+    mnemonic += ",";
+    DescribeEffectiveAddress(pc, mnemonic, opcode & 0x3f, size);
+  } else {
+    mnemonic += "{Mnemonic {MOVES ";
+    mnemonic += SizeSuffix(size);
+    DescribeEffectiveAddress(pc, mnemonic, opcode & 0x3f, size);
+    mnemonic += ",";
+    mnemonic += register_name;
+  }
+  mnemonic += "}} ";
+}
+
+// Disassemble the 'MOVEC' instruction
+void cpu32::DisassembleMOVEC(int opcode, unsigned long &pc,
+                             std::string &mnemonic) {
+  unsigned int opcode2 = 0;
+  unsigned int special_index;
+
+  Peek(pc, opcode2, WORD);
+  pc += 2;
+
+  switch (opcode2 & 0xfff) {
+  case 0x0:
+    special_index = SFC_INDEX;
+    break;
+  case 0x1:
+    special_index = DFC_INDEX;
+    break;
+  case 0x800:
+    special_index = USP_INDEX;
+    break;
+  case 0x801:
+    special_index = VBR_INDEX;
+    break;
+  default:
+    return;
+  }
+
+  const std::string &general_name =
+      ourRegisterData[((opcode2 & 0x8000) ? A0_INDEX : D0_INDEX) +
+                      ((opcode2 & 0x7000) >> 12)]
+          .name;
+
+  mnemonic += "{Mnemonic {MOVEC ";
+  // Bit 0 gives the direction of the transfer
+  if (opcode & 1) {
+    mnemonic += general_name;
+    mnemonic += ",";
+    mnemonic += ourRegisterData[special_index].name;
+  } else {
+    mnemonic += ourRegisterData[special_index].name;
+    mnemonic += ",";
+    mnemonic += general_name;
+  }
+  mnemonic += "}} ";
+}
+
+// Disassemble the 'MOVEM' instruction
+void cpu32::DisassembleMOVEM(int opcode, unsigned long &pc,
+                             std::string &mnemonic) {
+  const int size = (opcode & 64) ? LONG : WORD;
+  unsigned int list = 0;
+
+  mnemonic += "{Mnemonic {MOVEM";
+  mnemonic += SizeSuffix(size);
+
+  // Get the register list mask
+  Peek(pc, list, WORD);
+  pc += 2;
+
+  if ((opcode & 0x38) == 32) // Predecrement mode
+  {
+    for (int t = 7; t >= 0; --t) {
+      if (list & (1 << (7 - t))) {
+        mnemonic += AddressRegisterName(t);
+        mnemonic += " ";
+      }
+    }
+    for (int t = 7; t >= 0; --t) {
+      if (list & (1 << (15 - t))) {
+        mnemonic += ourRegisterData[D0_INDEX + t].name;
+        mnemonic += " ";
+      }
+    }
+    mnemonic += ",";
+    DescribeEffectiveAddress(pc, mnemonic, opcode & 0x3f, size);
+  } else // Postincrement or Control mode
+  {
+    DescribeEffectiveAddress(pc, mnemonic, opcode & 0x3f, size);
+    mnemonic += ",";
+    for (int t = 0; t < 8; ++t) {
+      if (list & (1 << t)) {
+        mnemonic += ourRegisterData[D0_INDEX + t].name;
+        mnemonic += " ";
+      }
+    }
+    for (int t = 0; t < 8; ++t) {
+      if (list & (1 << (8 + t))) {
+        mnemonic += AddressRegisterName(t);
+        mnemonic += " ";
+      }
+    }
+  }
+  mnemonic += "}} ";
+}
+
+// Disassemble the 'MOVEP' instruction
+void cpu32::DisassembleMOVEP(int opcode, unsigned long &pc,
+                             std::string &mnemonic) {
+  const int op_mode = (opcode & 0x01c0) >> 6;
+  const int size = (op_mode & 1) ? LONG : WORD;
+  const std::string data_register = IntToString((opcode & 0x0e00) >> 9, 1);
+
+  mnemonic += "{Mnemonic {MOVEP";
+  mnemonic += SizeSuffix(size);
+  if (op_mode < 6) { // Memory to Register
+    DescribeEffectiveAddress(pc, mnemonic, 0x28 | (opcode & 7), size);
+    mnemonic += ",D";
+    mnemonic += data_register;
+  } else { // Register to Memory
+    mnemonic += "D";
+    mnemonic += data_register;
+    mnemonic += ",";
+    DescribeEffectiveAddress(pc, mnemonic, 0x28 | (opcode & 7), size);
+  }
+  mnemonic += "}} ";
+}
+
+// Disassemble the 'MOVEQ' instruction
+void cpu32::DisassembleMOVEQ(int opcode, unsigned long &,
+                             std::string &mnemonic) {
+  mnemonic += "{Mnemonic {MOVEQ.L #$";
+  mnemonic += IntToString(SignExtend(opcode & 0xff, BYTE), 2);
+  mnemonic += ",";
+  mnemonic += ourRegisterData[D0_INDEX + ((opcode >> 9) & 7)].name;
+  mnemonic += "}} ";
+}
+
+// Disassemble the 'MOVE USP' instruction
+void cpu32::DisassembleMOVEUSP(int opcode, unsigned long &,
+                               std::string &mnemonic) {
+  const std::string &name = ((opcode & 7) == 7)
+                                ? ourRegisterData[SSP_INDEX].name
+                                : ourRegisterData[A0_INDEX + (opcode & 7)].name;
+
+  mnemonic += "{Mnemonic {MOVE.L ";
+  if (opcode & 8) {
+    mnemonic += "USP,";
+    mnemonic += name;
+  } else {
+    mnemonic += name;
+    mnemonic += ",USP";
+  }
+  mnemonic += "}} ";
+}
+
+// Disassemble the 'MOVE from SR' instruction
+void cpu32::DisassembleMOVEfromSR(int opcode, unsigned long &pc,
+                                  std::string &mnemonic) {
+  mnemonic += "{Mnemonic {MOVE.W SR,";
+  DescribeEffectiveAddress(pc, mnemonic, opcode & 0x3f, WORD);
+  mnemonic += "}} ";
+}
+
+// Disassemble the 'MOVE to CCR' instruction
+void cpu32::DisassembleMOVEtoCCR(int opcode, unsigned long &pc,
+                                 std::string &mnemonic) {
+  mnemonic += "{Mnemonic {MOVE.W ";
+  DescribeEffectiveAddress(pc, mnemonic, opcode & 0x3f, WORD);
+  mnemonic += ",CCR}} ";
+}
+
+// Disassemble the 'MOVE to SR' instruction
+void cpu32::DisassembleMOVEtoSR(int opcode, unsigned long &pc,
+                                std::string &mnemonic) {
+  mnemonic += "{Mnemonic {MOVE.W ";
+  DescribeEffectiveAddress(pc, mnemonic, opcode & 0x3f, WORD);
+  mnemonic += ",SR}} ";
+}
+
+// Disassemble the multiply and divide instructions
+void cpu32::DisassembleMultiply(const char *name, int opcode, unsigned long &pc,
+                                std::string &mnemonic) {
+  mnemonic += "{Mnemonic {";
+  mnemonic += name;
+  mnemonic += ".W ";
+  DescribeEffectiveAddress(pc, mnemonic, opcode & 0x3f, WORD);
+  mnemonic += ",";
+  mnemonic += ourRegisterData[D0_INDEX + ((opcode & 0x0e00) >> 9)].name;
+  mnemonic += "}} ";
+}
+
+// Disassemble the 'MULS' instruction
+void cpu32::DisassembleMULS(int opcode, unsigned long &pc,
+                            std::string &mnemonic) {
+  DisassembleMultiply("MULS", opcode, pc, mnemonic);
+}
+
+// Disassemble the 'MULL' instruction
+void cpu32::DisassembleMULL(int opcode, unsigned long &pc,
+                            std::string &mnemonic) {
+  unsigned int opcode2 = 0;
+
+  Peek(pc, opcode2, WORD);
+  pc += 2;
+
+  mnemonic += "{Mnemonic {";
+  mnemonic += (opcode2 & (1 << 11)) ? "MULS.L " : "MULU.L ";
+  DescribeEffectiveAddress(pc, mnemonic, opcode & 0x3f, LONG);
+  mnemonic += ",";
+  // The 64 bit form also names the register holding the high long word
+  if (opcode2 & (1 << 10)) {
+    mnemonic += ourRegisterData[D0_INDEX + (opcode2 & 0x7)].name;
+    mnemonic += ":";
+  }
+  mnemonic += ourRegisterData[D0_INDEX + ((opcode2 & 0x7000) >> 12)].name;
+  mnemonic += "}} ";
+}
+
+// Disassemble the 'MULU' instruction
+void cpu32::DisassembleMULU(int opcode, unsigned long &pc,
+                            std::string &mnemonic) {
+  DisassembleMultiply("MULU", opcode, pc, mnemonic);
+}
+
+// Disassemble the 'NBCD' instruction
+void cpu32::DisassembleNBCD(int opcode, unsigned long &pc,
+                            std::string &mnemonic) {
+  DisassembleInvalid(opcode, pc, mnemonic);
+}
+
+// Disassemble the single operand instructions (CLR, NEG, NEGX, NOT and TST)
+void cpu32::DisassembleUnary(const char *name, int opcode, unsigned long &pc,
+                             std::string &mnemonic) {
+  const int size = (opcode & 0x00c0) >> 6;
+
+  mnemonic += "{Mnemonic {";
+  mnemonic += name;
+  mnemonic += SizeSuffix(size);
+  DescribeEffectiveAddress(pc, mnemonic, opcode & 0x3f, size);
+  mnemonic += "}} ";
+}
+
+// Disassemble the 'NEG' instruction
+void cpu32::DisassembleNEG(int opcode, unsigned long &pc,
+                           std::string &mnemonic) {
+  DisassembleUnary("NEG", opcode, pc, mnemonic);
+}
+
+// Disassemble the 'NEGX' instruction
+void cpu32::DisassembleNEGX(int opcode, unsigned long &pc,
+                            std::string &mnemonic) {
+  DisassembleUnary("NEGX", opcode, pc, mnemonic);
+}
+
+// Disassemble the 'NOP' instruction
+void cpu32::DisassembleNOP(int, unsigned long &, std::string &mnemonic) {
+  mnemonic += "{Mnemonic {NOP}}";
+}
+
+// Disassemble the 'NOT' instruction
+void cpu32::DisassembleNOT(int opcode, unsigned long &pc,
+                           std::string &mnemonic) {
+  DisassembleUnary("NOT", opcode, pc, mnemonic);
+}
+
+// Disassemble the 'OR' instruction
+void cpu32::DisassembleOR(int opcode, unsigned long &pc,
+                          std::string &mnemonic) {
+  DisassembleArithmetic("OR", opcode, pc, mnemonic);
+}
+
+// Disassemble the 'ORI' instruction
+void cpu32::DisassembleORI(int opcode, unsigned long &pc,
+                           std::string &mnemonic) {
+  const int size = (opcode & 0x00c0) >> 6;
+
+  mnemonic += "{Mnemonic {ORI";
+  mnemonic += SizeSuffix(size);
+  DescribeEffectiveAddress(pc, mnemonic, 0x3c, size);
+  mnemonic += ",";
+  DescribeEffectiveAddress(pc, mnemonic, opcode & 0x3f, size);
+  mnemonic += "}} ";
+}
+
+// Disassemble the 'ORItoCCR' instruction
+void cpu32::DisassembleORItoCCR(int, unsigned long &pc, std::string &mnemonic) {
+  mnemonic += "{Mnemonic {ORI.B ";
+  DescribeEffectiveAddress(pc, mnemonic, 0x3c, BYTE);
+  mnemonic += ",CCR}} ";
+}
+
+// Disassemble the 'ORItoSR' instruction
+void cpu32::DisassembleORItoSR(int, unsigned long &pc, std::string &mnemonic) {
+  mnemonic += "{Mnemonic {ORI.W ";
+  DescribeEffectiveAddress(pc, mnemonic, 0x3c, WORD);
+  mnemonic += ",SR}} ";
+}
+
+// Disassemble the 'PEA' instruction
+void cpu32::DisassemblePEA(int opcode, unsigned long &pc,
+                           std::string &mnemonic) {
+  mnemonic += "{Mnemonic {PEA.L ";
+  DescribeEffectiveAddress(pc, mnemonic, opcode & 0x3f, LONG);
+  mnemonic += "}} ";
+}
+
+// Disassemble the 'RESET' instruction
+void cpu32::DisassembleRESET(int, unsigned long &, std::string &mnemonic) {
+  mnemonic += "{Mnemonic {RESET}} ";
+}
+
+// Disassemble the 'ROL' instruction
+void cpu32::DisassembleROL(int opcode, unsigned long &pc,
+                           std::string &mnemonic) {
+  DisassembleShift("ROL", opcode, pc, mnemonic);
+}
+
+// Disassemble the 'ROR' instruction
+void cpu32::DisassembleROR(int opcode, unsigned long &pc,
+                           std::string &mnemonic) {
+  DisassembleShift("ROR", opcode, pc, mnemonic);
+}
+
+// Disassemble the 'ROXL' instruction
+void cpu32::DisassembleROXL(int opcode, unsigned long &pc,
+                            std::string &mnemonic) {
+  DisassembleShift("ROXL", opcode, pc, mnemonic);
+}
+
+// Disassemble the 'ROXR' instruction
+void cpu32::DisassembleROXR(int opcode, unsigned long &pc,
+                            std::string &mnemonic) {
+  DisassembleShift("ROXR", opcode, pc, mnemonic);
+}
+
+// Disassemble the 'RTE' instruction
+void cpu32::DisassembleRTE(int, unsigned long &, std::string &mnemonic) {
+  mnemonic += "{Mnemonic {RTE}} ";
+}
+
+// Disassemble the 'RTD' instruction
+void cpu32::DisassembleRTD(int, unsigned long &pc, std::string &mnemonic) {
+  unsigned int extend_word = 0;
+
+  Peek(pc, extend_word, WORD);
+  pc += 2;
+
+  mnemonic += "{Mnemonic {RTD #";
+  mnemonic += IntToString(SignExtend(extend_word, WORD), 4);
+  mnemonic += "}} ";
+}
+
+// Disassemble the 'RTR' instruction
+void cpu32::DisassembleRTR(int, unsigned long &, std::string &mnemonic) {
+  mnemonic += "{Mnemonic {RTR}} ";
+}
+
+// Disassemble the 'RTS' instruction
+void cpu32::DisassembleRTS(int, unsigned long &, std::string &mnemonic) {
+  mnemonic += "{Mnemonic {RTS}} ";
+}
+
+// Disassemble the 'SBCD' instruction
+void cpu32::DisassembleSBCD(int opcode, unsigned long &pc,
+                            std::string &mnemonic) {
+  DisassembleInvalid(opcode, pc, mnemonic);
+}
+
+// Disassemble the 'STOP' instruction
+void cpu32::DisassembleSTOP(int, unsigned long &pc, std::string &mnemonic) {
+  unsigned int data = 0;
+
+  Peek(pc, data, WORD);
+  pc += 2;
+
+  mnemonic += "{Mnemonic {STOP #$";
+  mnemonic += IntToString(data, 4);
+  mnemonic += "}} ";
+}
+
+// Disassemble the 'SUB' instruction
+void cpu32::DisassembleSUB(int opcode, unsigned long &pc,
+                           std::string &mnemonic) {
+  DisassembleArithmetic("SUB", opcode, pc, mnemonic);
+}
+
+// Disassemble the 'SUBA' instruction
+void cpu32::DisassembleSUBA(int opcode, unsigned long &pc,
+                            std::string &mnemonic) {
+  const int size = (opcode & 0x0100) ? LONG : WORD;
+
+  mnemonic += "{Mnemonic {SUBA";
+  mnemonic += SizeSuffix(size);
+  DescribeEffectiveAddress(pc, mnemonic, opcode & 0x3f, size);
+  mnemonic += ",";
+  mnemonic += AddressRegisterName((opcode & 0x0e00) >> 9);
+  mnemonic += "}} ";
+}
+
+// Disassemble the 'SUBI' instruction
+void cpu32::DisassembleSUBI(int opcode, unsigned long &pc,
+                            std::string &mnemonic) {
+  const int size = (opcode & 0x00c0) >> 6;
+
+  mnemonic += "{Mnemonic {SUBI";
+  mnemonic += SizeSuffix(size);
+  DescribeEffectiveAddress(pc, mnemonic, 0x3c, size);
+  mnemonic += ",";
+  DescribeEffectiveAddress(pc, mnemonic, opcode & 0x3f, size);
+  mnemonic += "}} ";
+}
+
+// Disassemble the 'SUBQ' instruction
+void cpu32::DisassembleSUBQ(int opcode, unsigned long &pc,
+                            std::string &mnemonic) {
+  const int size = (opcode & 0x00c0) >> 6;
+  const int data = ((opcode & 0x0e00) >> 9) ? (opcode & 0x0e00) >> 9 : 8;
+
+  mnemonic += "{Mnemonic {SUBQ";
+  mnemonic += SizeSuffix(size);
+  mnemonic += "#$";
+  mnemonic += IntToString(data, 1);
+  mnemonic += ",";
+  DescribeEffectiveAddress(pc, mnemonic, opcode & 0x3f, size);
+  mnemonic += "}} ";
+}
+
+// Disassemble the 'SUBX' instruction
+void cpu32::DisassembleSUBX(int opcode, unsigned long &pc,
+                            std::string &mnemonic) {
+  const int size = (opcode & 0x00c0) >> 6;
+
+  mnemonic += "{Mnemonic {SUBX";
+  mnemonic += SizeSuffix(size);
+  if (opcode & 8) {
+    DescribeEffectiveAddress(pc, mnemonic, 0x20 | (opcode & 7), size);
+    mnemonic += ",";
+    DescribeEffectiveAddress(pc, mnemonic, 0x20 | ((opcode & 0x0e00) >> 9),
+                             size);
+  } else {
+    mnemonic += ourRegisterData[D0_INDEX + (opcode & 7)].name;
+    mnemonic += ",";
+    mnemonic += ourRegisterData[D0_INDEX + ((opcode & 0x0e00) >> 9)].name;
+  }
+  mnemonic += "}} ";
+}
+
+// Disassemble the 'SWAP' instruction
+void cpu32::DisassembleSWAP(int opcode, unsigned long &,
+                            std::string &mnemonic) {
+  mnemonic += "{Mnemonic {SWAP.W ";
+  mnemonic += ourRegisterData[D0_INDEX + (opcode & 7)].name;
+  mnemonic += "}} ";
+}
+
+// Disassemble the 'Scc' instructions
+void cpu32::DisassembleScc(int opcode, unsigned long &pc,
+                           std::string &mnemonic) {
+  mnemonic += "{Mnemonic {S";
+  mnemonic += ourConditionNames[(opcode & 0x0f00) >> 8];
+  mnemonic += ".B ";
+  DescribeEffectiveAddress(pc, mnemonic, opcode & 0x3f, BYTE);
+  mnemonic += "}} ";
+}
+
+// Disassemble the 'TAS' instruction
+void cpu32::DisassembleTAS(int opcode, unsigned long &pc,
+                           std::string &mnemonic) {
+  mnemonic += "{Mnemonic {TAS.B ";
+  DescribeEffectiveAddress(pc, mnemonic, opcode & 0x3f, BYTE);
+  mnemonic += "}} ";
+}
+
+// Disassemble the 'TRAP' instruction
+void cpu32::DisassembleTRAP(int opcode, unsigned long &,
+                            std::string &mnemonic) {
+  mnemonic += "{Mnemonic {TRAP #$";
+  mnemonic += IntToString(32 + (opcode & 0xf), 1);
+  mnemonic += "}} ";
+}
+
+// Disassemble the 'TRAPV' instruction
+void cpu32::DisassembleTRAPV(int, unsigned long &, std::string &mnemonic) {
+  mnemonic += "{Mnemonic {TRAPV}} ";
+}
+
+// Disassemble the 'TST' instruction
+void cpu32::DisassembleTST(int opcode, unsigned long &pc,
+                           std::string &mnemonic) {
+  DisassembleUnary("TST", opcode, pc, mnemonic);
+}
+
+// Disassemble the 'UNLK' instruction
+void cpu32::DisassembleUNLK(int opcode, unsigned long &,
+                            std::string &mnemonic) {
+  mnemonic += "{Mnemonic {UNLK ";
+  mnemonic += AddressRegisterName(opcode & 7);
+  mnemonic += "}} ";
+}
+
+// Disassemble an invalid instruction
+void cpu32::DisassembleInvalid(int, unsigned long &, std::string &mnemonic) {
+  mnemonic += "{Mnemonic {Illegal Instruction Exception}} ";
+}
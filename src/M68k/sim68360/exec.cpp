@@ -5,8 +5,7 @@
 #include "M68k/sim68360/cpu32.hpp"
 
 int cpu32::ComputeEffectiveAddress(unsigned long &address, int &in_register,
-                                   std::string &description, int mode_register,
-                                   int size, int trace) {
+                                   int mode_register, int size) {
   unsigned long tmp = 0;
   unsigned int extend_word;
   int status;
@@ -16,9 +15,6 @@ int cpu32::ComputeEffectiveAddress(unsigned long &address, int &in_register,
   switch (mode_register >> 3) {
   case 0: // Data Register Direct
     address = (mode_register & 0x7) + D0_INDEX;
-    if (trace) {
-      description += ourRegisterData[address].name;
-    }
     in_register = 1;
     return (EXECUTE_OK);
     break;
@@ -29,9 +25,6 @@ int cpu32::ComputeEffectiveAddress(unsigned long &address, int &in_register,
       address = SSP_INDEX;
     else
       address += A0_INDEX;
-    if (trace) {
-      description += ourRegisterData[address].name;
-    }
     in_register = 1;
     return (EXECUTE_OK);
     break;
@@ -43,11 +36,6 @@ int cpu32::ComputeEffectiveAddress(unsigned long &address, int &in_register,
     else
       tmp += A0_INDEX;
     address = register_value[tmp];
-    if (trace) {
-      description += "(";
-      description += ourRegisterData[tmp].name;
-      description += ")";
-    }
     in_register = 0;
     return (EXECUTE_OK);
     break;
@@ -76,11 +64,6 @@ int cpu32::ComputeEffectiveAddress(unsigned long &address, int &in_register,
       register_value[tmp] += 4;
       break;
     }
-    if (trace) {
-      description += "(";
-      description += ourRegisterData[tmp].name;
-      description += ")+";
-    }
     in_register = 0;
     return (EXECUTE_OK);
     break;
@@ -109,11 +92,6 @@ int cpu32::ComputeEffectiveAddress(unsigned long &address, int &in_register,
       break;
     }
     address = register_value[tmp];
-    if (trace) {
-      description += "-(";
-      description += ourRegisterData[tmp].name;
-      description += ")";
-    }
     in_register = 0;
     return (EXECUTE_OK);
     break;
@@ -135,13 +113,6 @@ int cpu32::ComputeEffectiveAddress(unsigned long &address, int &in_register,
     }
 
     address += SignExtend(extend_word, WORD);
-    if (trace) {
-      description += "($";
-      description += IntToString(extend_word, 4);
-      description += ",";
-      description += ourRegisterData[tmp].name;
-      description += ")";
-    }
     in_register = 0;
     return (EXECUTE_OK);
     break;
@@ -167,10 +138,6 @@ int cpu32::ComputeEffectiveAddress(unsigned long &address, int &in_register,
       address = 0L;
     }
 
-    if (trace) {
-      description += "($";
-    }
-
     // either 8 bits or 16/32bits displacement
     if (extend_word & 0x100) {
       // Full  Extension Word Format
@@ -199,9 +166,6 @@ int cpu32::ComputeEffectiveAddress(unsigned long &address, int &in_register,
         }
         register_value[PC_INDEX] += 2;
         displacement = SignExtend(displacement, WORD);
-        if (trace) {
-          description += IntToString(displacement, 4);
-        }
       } else if ((extend_word & 0x30) == 0x30) {
         // long displacement
         if ((status = Peek(register_value[PC_INDEX], displacement, LONG)) !=
@@ -210,39 +174,20 @@ int cpu32::ComputeEffectiveAddress(unsigned long &address, int &in_register,
           return (status);
         }
         register_value[PC_INDEX] += 4;
-        if (trace) {
-          description += IntToString(displacement, 8);
-        }
       } else if ((extend_word & 0x30) == 0x10) {
         // suppress displacement
         displacement = 0;
-        if (trace) {
-          description += "0";
-        }
       } else {
         //**CPU_DEBUG_PRINT0(this,"[CPU32] ERROR: bad BD Size");
         // NOT ALLOWED (bad BD size)
         return (EXECUTE_ILLEGAL_INSTRUCTION);
       }
-
     } else {
       // Brief Extension Word Format
       displacement = SignExtend(extend_word & 0xff, BYTE);
-      if (trace) {
-        description += IntToString(displacement, 2);
-      }
     }
 
     address += displacement;
-    if (trace) {
-      if ((extend_word & 0x180) !=
-          0x180) // 0x180 is full extension format + base reg. suppress
-      {
-        description += ",";
-        description += ourRegisterData[tmp].name;
-      }
-      description += ",";
-    }
 
     if (extend_word & 0x8000) // Get register number
     {
@@ -268,21 +213,6 @@ int cpu32::ComputeEffectiveAddress(unsigned long &address, int &in_register,
     else
       address += SignExtend(register_value[tmp], WORD) * scale;
 
-    if (trace) {
-      description += ourRegisterData[tmp].name;
-      if (extend_word & 0x800)
-        description += ".L";
-      else
-        description += ".W";
-
-      if ((extend_word & 0x600) == 0x600)
-        description += "*8";
-      else if (extend_word & 0x400)
-        description += "*4";
-      else if (extend_word & 0x200)
-        description += "*2";
-      description += ")";
-    }
     in_register = 0;
     return (EXECUTE_OK);
     break;
@@ -298,10 +228,6 @@ int cpu32::ComputeEffectiveAddress(unsigned long &address, int &in_register,
         register_value[PC_INDEX] += 2;
       }
       address = SignExtend(extend_word, WORD);
-      if (trace) {
-        description += IntToString(extend_word, 4);
-        description += ".W";
-      }
       in_register = 0;
       return (EXECUTE_OK);
       break;
@@ -315,10 +241,6 @@ int cpu32::ComputeEffectiveAddress(unsigned long &address, int &in_register,
         register_value[PC_INDEX] += 4;
       }
       address = extend_word;
-      if (trace) {
-        description += IntToString(extend_word, 8);
-        description += ".L";
-      }
       in_register = 0;
       return (EXECUTE_OK);
       break;
@@ -333,11 +255,6 @@ int cpu32::ComputeEffectiveAddress(unsigned long &address, int &in_register,
         register_value[PC_INDEX] += 2;
       }
       address += SignExtend(extend_word, WORD);
-      if (trace) {
-        description += "($";
-        description += IntToString(extend_word, 4);
-        description += ",PC)";
-      }
       in_register = 0;
       return (EXECUTE_OK);
       break;
@@ -408,15 +325,6 @@ int cpu32::ComputeEffectiveAddress(unsigned long &address, int &in_register,
       }
 
       address += displacement;
-      if (trace) {
-        description += "($";
-        description += IntToString(displacement, 4);
-        description += ",";
-        if ((extend_word & 0x180) != 0x180) {
-          // not 'PC suppress'
-          description += "PC,";
-        }
-      }
 
       if (extend_word & 0x8000) // Get register number
       {
@@ -442,20 +350,6 @@ int cpu32::ComputeEffectiveAddress(unsigned long &address, int &in_register,
       else
         address += SignExtend(register_value[tmp], WORD) * scale;
 
-      if (trace) {
-        description += ourRegisterData[tmp].name;
-        if (extend_word & 0x0800)
-          description += ".L";
-        else
-          description += ".W";
-        if ((extend_word & 0x600) == 0x600)
-          description += "*8";
-        else if (extend_word & 0x400)
-          description += "*4";
-        else if (extend_word & 0x200)
-          description += "*2";
-        description += ")";
-      }
       in_register = 0;
       return (EXECUTE_OK);
       break;
@@ -471,19 +365,6 @@ int cpu32::ComputeEffectiveAddress(unsigned long &address, int &in_register,
       else
         register_value[PC_INDEX] += 4;
 
-      if (trace) {
-        // Fetch the immediate data
-        if ((status = Peek(address, extend_word, size)) != EXECUTE_OK)
-          return (status);
-
-        description += "#$";
-        if (size == BYTE)
-          description += IntToString(extend_word, 2);
-        else if (size == WORD)
-          description += IntToString(extend_word, 4);
-        else if (size == LONG)
-          description += IntToString(extend_word, 8);
-      }
       in_register = 0;
       return (EXECUTE_OK);
       break;
@@ -517,6 +398,10 @@ unsigned int cpu32::SignExtend(unsigned int value, int size) {
 int cpu32::Peek(unsigned long address, unsigned int &value, int size) {
   unsigned long data;
 
+  // Extension words come from the block cache
+  if (PeekOperand(address, value, size == BYTE ? 1 : size == WORD ? 2 : 4))
+    return (EXECUTE_OK);
+
   // for CPU32, should use SFC to choose address space...
   if (myAddressSpaces[0]->Peek(address, data, size)) {
     value = (unsigned int)data;
@@ -534,6 +419,8 @@ int cpu32::Poke(unsigned long address, unsigned int value, int size) {
 }
 
 void cpu32::ClearConditionCodes(int mask) {
+  EvaluateConditionCodes();
+
   if (mask & C_FLAG)
     register_value[SR_INDEX] &= ~C_FLAG;
   else if (mask & V_FLAG)
@@ -550,9 +437,23 @@ void cpu32::ClearConditionCodes(int mask) {
     register_value[SR_INDEX] &= ~S_FLAG;
 }
 
+// Record the operation so its condition codes can be computed lazily.  Any
+// flags of the previous operation that this one doesn't set are computed now.
 void cpu32::SetConditionCodes(unsigned int src, unsigned int dest,
                               unsigned int result, int size, int operation,
                               int mask) {
+  const PendingConditionCodes &p = myPendingConditionCodes;
+  const int stale = p.mask & ~mask;
+
+  if (stale)
+    ComputeConditionCodes(p.src, p.dest, p.result, p.size, p.operation, stale);
+
+  myPendingConditionCodes = {src, dest, result, size, operation, mask};
+}
+
+void cpu32::ComputeConditionCodes(unsigned int src, unsigned int dest,
+                                  unsigned int result, int size, int operation,
+                                  int mask) {
   int S, D, R;
 
   switch (size) {
@@ -658,130 +559,88 @@ void cpu32::SetRegister(int register_number, unsigned int value, int size) {
   }
 }
 
-int cpu32::CheckConditionCodes(int code, std::string &mnemonic, int trace) {
+int cpu32::CheckConditionCodes(int code) {
   int branch = 0;
   unsigned long sr;
 
+  EvaluateConditionCodes();
   sr = register_value[SR_INDEX];
   switch (code) {
   case 4:
     branch = !(sr & C_FLAG);
-    if (trace)
-      mnemonic += "CC";
     break;
   case 5:
     branch = (sr & C_FLAG);
-    if (trace)
-      mnemonic += "CS";
     break;
   case 7:
     branch = (sr & Z_FLAG);
-    if (trace)
-      mnemonic += "EQ";
     break;
   case 1:
     branch = 0;
-    if (trace)
-      mnemonic += "F";
     break;
   case 12:
     branch =
         ((sr & N_FLAG) && (sr & V_FLAG)) || (!(sr & N_FLAG) && !(sr & V_FLAG));
-    if (trace)
-      mnemonic += "GE";
     break;
   case 14:
     branch = ((sr & N_FLAG) && (sr & V_FLAG) && !(sr & Z_FLAG)) ||
              (!(sr & N_FLAG) && !(sr & V_FLAG) && !(sr & Z_FLAG));
-    if (trace)
-      mnemonic += "GT";
     break;
   case 2:
     branch = (!(sr & C_FLAG) && !(sr & Z_FLAG));
-    if (trace)
-      mnemonic += "HI";
     break;
   case 15:
     branch = (sr & Z_FLAG) || ((sr & N_FLAG) && !(sr & V_FLAG)) ||
              (!(sr & N_FLAG) && (sr & V_FLAG));
-    if (trace)
-      mnemonic += "LE";
     break;
   case 3:
     branch = (sr & C_FLAG) || (sr & Z_FLAG);
-    if (trace)
-      mnemonic += "LS";
     break;
   case 13:
     branch =
         ((sr & N_FLAG) && !(sr & V_FLAG)) || (!(sr & N_FLAG) && (sr & V_FLAG));
-    if (trace)
-      mnemonic += "LT";
     break;
   case 11:
     branch = (sr & N_FLAG);
-    if (trace)
-      mnemonic += "MI";
     break;
   case 6:
     branch = !(sr & Z_FLAG);
-    if (trace)
-      mnemonic += "NE";
     break;
   case 10:
     branch = !(sr & N_FLAG);
-    if (trace)
-      mnemonic += "PL";
     break;
   case 0:
     branch = 1;
-    if (trace)
-      mnemonic += "T";
     break;
   case 8:
     branch = !(sr & V_FLAG);
-    if (trace)
-      mnemonic += "VC";
     break;
   case 9:
     branch = (sr & V_FLAG);
-    if (trace)
-      mnemonic += "VS";
     break;
   }
   return (branch);
 }
 
-int cpu32::ExecuteABCD(int opcode, std::string &trace_record, int trace) {
+int cpu32::ExecuteABCD(int opcode) {
   int status, size, in_register_flag;
   unsigned long src_address, dest_address;
   unsigned int result, src, dest, zw_resultat, zw_uebertrag; // T_M change
-  std::string mnemonic;
 
+  EvaluateConditionCodes();
   size = (opcode & 0x00c0) >> 6;
 
-  if (trace) {
-    mnemonic += "{Mnemonic {ABCD";
-    if (size == BYTE)
-      mnemonic += ".B ";
-    else
-      return (ExecuteInvalid(opcode, trace_record, trace));
-  }
-
   // Get the addresses
   if (opcode & 8) {
     if ((status = ComputeEffectiveAddress(src_address, in_register_flag,
-                                          mnemonic, 0x20 | (opcode & 7), size,
-                                          trace)) != EXECUTE_OK) {
+                                          0x20 | (opcode & 7), size)) !=
+        EXECUTE_OK) {
       return (status);
     }
 
-    if (trace)
-      mnemonic += ",";
-
-    if ((status = ComputeEffectiveAddress(
-             dest_address, in_register_flag, mnemonic,
-             0x20 | ((opcode & 0x0e00) >> 9), size, trace)) != EXECUTE_OK) {
+    if ((status = ComputeEffectiveAddress(dest_address, in_register_flag,
+                                          0x20 | ((opcode & 0x0e00) >> 9),
+                                          size)) != EXECUTE_OK) {
       return (status);
     }
 
@@ -794,11 +653,6 @@ int cpu32::ExecuteABCD(int opcode, std::string &trace_record, int trace) {
     src = register_value[src_address];
     dest_address = D0_INDEX + ((opcode & 0x0e00) >> 9);
     dest = register_value[dest_address];
-    if (trace) {
-      mnemonic += ourRegisterData[src_address].name;
-      mnemonic += ",";
-      mnemonic += ourRegisterData[dest_address].name;
-    }
   }
 
   if (register_value[SR_INDEX] & X_FLAG)
@@ -829,8 +683,8 @@ int cpu32::ExecuteABCD(int opcode, std::string &trace_record, int trace) {
   // only BYTE data !!
   result = result & 0xff;
 
-  SetConditionCodes(src, dest, result, size, ADDITION,
-                    C_FLAG | V_FLAG | N_FLAG | X_FLAG);
+  ComputeConditionCodes(src, dest, result, size, ADDITION,
+                        C_FLAG | V_FLAG | N_FLAG | X_FLAG);
   if (result)
     register_value[SR_INDEX] &= ~Z_FLAG;
 
@@ -841,25 +695,19 @@ int cpu32::ExecuteABCD(int opcode, std::string &trace_record, int trace) {
     SetRegister(dest_address, result, size);
   }
 
-  if (trace) {
-    mnemonic += "}} ";
-    trace_record += mnemonic;
-  }
   return EXECUTE_OK;
 }
 
-int cpu32::ExecuteADD(int opcode, std::string &trace_record, int trace) {
+int cpu32::ExecuteADD(int opcode) {
   int status, size, in_register_flag;
   unsigned long ea_address, register_number;
   unsigned int result, ea_data;
-  std::string mnemonic, ea_description;
 
   size = (opcode & 0x00c0) >> 6;
 
   // Get the <ea> data address
-  if ((status =
-           ComputeEffectiveAddress(ea_address, in_register_flag, ea_description,
-                                   opcode & 0x3f, size, trace)) != EXECUTE_OK) {
+  if ((status = ComputeEffectiveAddress(ea_address, in_register_flag,
+                                        opcode & 0x3f, size)) != EXECUTE_OK) {
     return (status);
   }
 
@@ -872,23 +720,8 @@ int cpu32::ExecuteADD(int opcode, std::string &trace_record, int trace) {
   // Get the register number
   register_number = D0_INDEX + ((opcode & 0x0e00) >> 9);
 
-  if (trace) {
-    mnemonic += "{Mnemonic {ADD";
-    if (size == BYTE)
-      mnemonic += ".B ";
-    else if (size == WORD)
-      mnemonic += ".W ";
-    else if (size == LONG)
-      mnemonic += ".L ";
-  }
-
   if (opcode & 0x0100) // <Dn> + <ea> -> <ea>
   {
-    if (trace) {
-      mnemonic += ourRegisterData[register_number].name;
-      mnemonic += ",";
-      mnemonic += ea_description;
-    }
     result = register_value[register_number] + ea_data;
     SetConditionCodes(register_value[register_number], ea_data, result, size,
                       ADDITION, C_FLAG | V_FLAG | Z_FLAG | N_FLAG | X_FLAG);
@@ -896,29 +729,19 @@ int cpu32::ExecuteADD(int opcode, std::string &trace_record, int trace) {
       return (status);
   } else // <ea> + <Dn> -> <Dn>
   {
-    if (trace) {
-      mnemonic += ea_description;
-      mnemonic += ",";
-      mnemonic += ourRegisterData[register_number].name;
-    }
     result = ea_data + register_value[register_number];
     SetConditionCodes(ea_data, register_value[register_number], result, size,
                       ADDITION, C_FLAG | V_FLAG | Z_FLAG | N_FLAG | X_FLAG);
     SetRegister(register_number, result, size);
   }
 
-  if (trace) {
-    mnemonic += "}} ";
-    trace_record += mnemonic;
-  }
   return (EXECUTE_OK);
 }
 
-int cpu32::ExecuteADDA(int opcode, std::string &trace_record, int trace) {
+int cpu32::ExecuteADDA(int opcode) {
   int status, size, in_register_flag;
   unsigned long ea_address, register_number;
   unsigned int result, ea_data;
-  std::string mnemonic, ea_description;
 
   if (opcode & 0x0100)
     size = LONG;
@@ -926,9 +749,8 @@ int cpu32::ExecuteADDA(int opcode, std::string &trace_record, int trace) {
     size = WORD;
 
   // Get the <ea> data address
-  if ((status =
-           ComputeEffectiveAddress(ea_address, in_register_flag, ea_description,
-                                   opcode & 0x3f, size, trace)) != EXECUTE_OK) {
+  if ((status = ComputeEffectiveAddress(ea_address, in_register_flag,
+                                        opcode & 0x3f, size)) != EXECUTE_OK) {
     return (status);
   }
 
@@ -951,43 +773,19 @@ int cpu32::ExecuteADDA(int opcode, std::string &trace_record, int trace) {
   result = ea_data + register_value[register_number];
   SetRegister(register_number, result, LONG);
 
-  if (trace) {
-    mnemonic += "{Mnemonic {ADDA";
-    if (size == WORD)
-      mnemonic += ".W ";
-    else if (size == LONG)
-      mnemonic += ".L ";
-
-    mnemonic += ea_description;
-    mnemonic += ",";
-    mnemonic += ourRegisterData[register_number].name;
-    mnemonic += "}} ";
-    trace_record += mnemonic;
-  }
   return (EXECUTE_OK);
 }
 
-int cpu32::ExecuteADDI(int opcode, std::string &trace_record, int trace) {
+int cpu32::ExecuteADDI(int opcode) {
   int status, size, in_register;
   unsigned long dest_addr, src_addr;
   unsigned int result, src, dest;
-  std::string mnemonic;
 
   size = (opcode & 0x00c0) >> 6;
 
-  if (trace) {
-    mnemonic += "{Mnemonic {ADDI";
-    if (size == BYTE)
-      mnemonic += ".B ";
-    else if (size == WORD)
-      mnemonic += ".W ";
-    else if (size == LONG)
-      mnemonic += ".L ";
-  }
-
   // Get the immediate data pointer
-  if ((status = ComputeEffectiveAddress(src_addr, in_register, mnemonic, 0x3c,
-                                        size, trace)) != EXECUTE_OK) {
+  if ((status = ComputeEffectiveAddress(src_addr, in_register, 0x3c, size)) !=
+      EXECUTE_OK) {
     return (status);
   }
 
@@ -995,13 +793,9 @@ int cpu32::ExecuteADDI(int opcode, std::string &trace_record, int trace) {
   if ((status = Peek(src_addr, src, size)) != EXECUTE_OK)
     return (status);
 
-  if (trace)
-    mnemonic += ",";
-
   // Get the destination data pointer
-  if ((status = ComputeEffectiveAddress(dest_addr, in_register, mnemonic,
-                                        opcode & 0x3f, size, trace)) !=
-      EXECUTE_OK) {
+  if ((status = ComputeEffectiveAddress(dest_addr, in_register, opcode & 0x3f,
+                                        size)) != EXECUTE_OK) {
     return (status);
   }
 
@@ -1021,18 +815,13 @@ int cpu32::ExecuteADDI(int opcode, std::string &trace_record, int trace) {
       return (status);
   }
 
-  if (trace) {
-    mnemonic += "}} ";
-    trace_record += mnemonic;
-  }
   return (EXECUTE_OK);
 }
 
-int cpu32::ExecuteADDQ(int opcode, std::string &trace_record, int trace) {
+int cpu32::ExecuteADDQ(int opcode) {
   int status, size, in_register_flag;
   unsigned long ea_address, immediate_data;
   unsigned int result, ea_data;
-  std::string ea_description;
 
   size = (opcode & 0x00c0) >> 6;
 
@@ -1041,9 +830,8 @@ int cpu32::ExecuteADDQ(int opcode, std::string &trace_record, int trace) {
     immediate_data = 8;
 
   // Get the <ea> data address
-  if ((status =
-           ComputeEffectiveAddress(ea_address, in_register_flag, ea_description,
-                                   opcode & 0x3f, size, trace)) != EXECUTE_OK) {
+  if ((status = ComputeEffectiveAddress(ea_address, in_register_flag,
+                                        opcode & 0x3f, size)) != EXECUTE_OK) {
     return (status);
   }
 
@@ -1070,55 +858,28 @@ int cpu32::ExecuteADDQ(int opcode, std::string &trace_record, int trace) {
       return (status);
   }
 
-  if (trace) {
-    trace_record += "{Mnemonic {ADDQ";
-    if (size == BYTE)
-      trace_record += ".B ";
-    else if (size == WORD)
-      trace_record += ".W ";
-    else if (size == LONG)
-      trace_record += ".L ";
-    trace_record += "#$";
-    trace_record += IntToString(immediate_data, 1);
-    trace_record += ",";
-    trace_record += ea_description;
-    trace_record += "}} ";
-  }
   return (EXECUTE_OK);
 }
 
-int cpu32::ExecuteADDX(int opcode, std::string &trace_record, int trace) {
+int cpu32::ExecuteADDX(int opcode) {
   int status, size, in_register_flag;
   unsigned long src_address, dest_address;
   unsigned int result, src, dest;
-  std::string mnemonic;
 
+  EvaluateConditionCodes();
   size = (opcode & 0x00c0) >> 6;
 
-  if (trace) {
-    mnemonic += "{Mnemonic {ADDX";
-    if (size == BYTE)
-      mnemonic += ".B ";
-    else if (size == WORD)
-      mnemonic += ".W ";
-    else if (size == LONG)
-      mnemonic += ".L ";
-  }
-
   // Get the addresses
   if (opcode & 8) {
     if ((status = ComputeEffectiveAddress(src_address, in_register_flag,
-                                          mnemonic, 0x20 | (opcode & 7), size,
-                                          trace)) != EXECUTE_OK) {
+                                          0x20 | (opcode & 7), size)) !=
+        EXECUTE_OK) {
       return (status);
     }
 
-    if (trace)
-      mnemonic += ",";
-
-    if ((status = ComputeEffectiveAddress(
-             dest_address, in_register_flag, mnemonic,
-             0x20 | ((opcode & 0x0e00) >> 9), size, trace)) != EXECUTE_OK) {
+    if ((status = ComputeEffectiveAddress(dest_address, in_register_flag,
+                                          0x20 | ((opcode & 0x0e00) >> 9),
+                                          size)) != EXECUTE_OK) {
       return (status);
     }
 
@@ -1131,11 +892,6 @@ int cpu32::ExecuteADDX(int opcode, std::string &trace_record, int trace) {
     src = register_value[src_address];
     dest_address = D0_INDEX + ((opcode & 0x0e00) >> 9);
     dest = register_value[dest_address];
-    if (trace) {
-      mnemonic += ourRegisterData[src_address].name;
-      mnemonic += ",";
-      mnemonic += ourRegisterData[dest_address].name;
-    }
   }
 
   if (register_value[SR_INDEX] & X_FLAG)
@@ -1150,8 +906,8 @@ int cpu32::ExecuteADDX(int opcode, std::string &trace_record, int trace) {
   else if (size == LONG)
     result = result & 0xffffffff;
 
-  SetConditionCodes(src, dest, result, size, ADDITION,
-                    C_FLAG | V_FLAG | N_FLAG | X_FLAG);
+  ComputeConditionCodes(src, dest, result, size, ADDITION,
+                        C_FLAG | V_FLAG | N_FLAG | X_FLAG);
   if (result)
     register_value[SR_INDEX] &= ~Z_FLAG;
 
@@ -1162,25 +918,19 @@ int cpu32::ExecuteADDX(int opcode, std::string &trace_record, int trace) {
     SetRegister(dest_address, result, size);
   }
 
-  if (trace) {
-    mnemonic += "}} ";
-    trace_record += mnemonic;
-  }
   return (EXECUTE_OK);
 }
 
-int cpu32::ExecuteAND(int opcode, std::string &trace_record, int trace) {
+int cpu32::ExecuteAND(int opcode) {
   int status, size, in_register_flag;
   unsigned long ea_address, register_number;
   unsigned int result, ea_data;
-  std::string mnemonic, ea_description;
 
   size = (opcode & 0x00c0) >> 6;
 
   // Get the <ea> data address
-  if ((status =
-           ComputeEffectiveAddress(ea_address, in_register_flag, ea_description,
-                                   opcode & 0x3f, size, trace)) != EXECUTE_OK) {
+  if ((status = ComputeEffectiveAddress(ea_address, in_register_flag,
+                                        opcode & 0x3f, size)) != EXECUTE_OK) {
     return (status);
   }
 
@@ -1193,23 +943,8 @@ int cpu32::ExecuteAND(int opcode, std::string &trace_record, int trace) {
   // Get the register number
   register_number = D0_INDEX + ((opcode & 0x0e00) >> 9);
 
-  if (trace) {
-    mnemonic += "{Mnemonic {AND";
-    if (size == BYTE)
-      mnemonic += ".B ";
-    else if (size == WORD)
-      mnemonic += ".W ";
-    else if (size == LONG)
-      mnemonic += ".L ";
-  }
-
   if (opcode & 0x0100) // <Dn> & <ea> -> <ea>
   {
-    if (trace) {
-      mnemonic += ourRegisterData[register_number].name;
-      mnemonic += ",";
-      mnemonic += ea_description;
-    }
     result = register_value[register_number] & ea_data;
     SetConditionCodes(register_value[register_number], ea_data, result, size,
                       OTHER, V_FLAG | C_FLAG | Z_FLAG | N_FLAG);
@@ -1217,45 +952,25 @@ int cpu32::ExecuteAND(int opcode, std::string &trace_record, int trace) {
       return (status);
   } else // <ea> & <Dn> -> <Dn>
   {
-    if (trace) {
-      mnemonic += ea_description;
-      mnemonic += ",";
-      mnemonic += ourRegisterData[register_number].name;
-    }
     result = ea_data & register_value[register_number];
     SetConditionCodes(ea_data, register_value[register_number], result, size,
                       OTHER, V_FLAG | C_FLAG | Z_FLAG | N_FLAG);
     SetRegister(register_number, result, size);
   }
 
-  if (trace) {
-    mnemonic += "}} ";
-    trace_record += mnemonic;
-  }
   return (EXECUTE_OK);
 }
 
-int cpu32::ExecuteANDI(int opcode, std::string &trace_record, int trace) {
+int cpu32::ExecuteANDI(int opcode) {
   int status, size, in_register;
   unsigned long dest_addr, src_addr;
   unsigned int result, src, dest;
-  std::string mnemonic;
 
   size = (opcode & 0x00c0) >> 6;
 
-  if (trace) {
-    mnemonic += "{Mnemonic {ANDI";
-    if (size == BYTE)
-      mnemonic += ".B ";
-    else if (size == WORD)
-      mnemonic += ".W ";
-    else if (size == LONG)
-      mnemonic += ".L ";
-  }
-
   // Get the immediate data pointer
-  if ((status = ComputeEffectiveAddress(src_addr, in_register, mnemonic, 0x3c,
-                                        size, trace)) != EXECUTE_OK) {
+  if ((status = ComputeEffectiveAddress(src_addr, in_register, 0x3c, size)) !=
+      EXECUTE_OK) {
     return (status);
   }
 
@@ -1263,13 +978,9 @@ int cpu32::ExecuteANDI(int opcode, std::string &trace_record, int trace) {
   if ((status = Peek(src_addr, src, size)) != EXECUTE_OK)
     return (status);
 
-  if (trace)
-    mnemonic += ",";
-
   // Get the destination data pointer
-  if ((status = ComputeEffectiveAddress(dest_addr, in_register, mnemonic,
-                                        opcode & 0x3f, size, trace)) !=
-      EXECUTE_OK) {
+  if ((status = ComputeEffectiveAddress(dest_addr, in_register, opcode & 0x3f,
+                                        size)) != EXECUTE_OK) {
     return (status);
   }
 
@@ -1289,27 +1000,20 @@ int cpu32::ExecuteANDI(int opcode, std::string &trace_record, int trace) {
       return (status);
   }
 
-  if (trace) {
-    mnemonic += "}} ";
-    trace_record += mnemonic;
-  }
   return (EXECUTE_OK);
 }
 
-int cpu32::ExecuteANDItoCCR(int, std::string &trace_record, int trace) {
+int cpu32::ExecuteANDItoCCR(int) {
   int status, size, in_register_flag;
   unsigned long src_addr;
   unsigned int src;
-  std::string mnemonic;
 
+  EvaluateConditionCodes();
   size = BYTE;
 
-  if (trace)
-    mnemonic += "{Mnemonic {ANDI.B ";
-
   // Get the immediate data pointer
-  if ((status = ComputeEffectiveAddress(src_addr, in_register_flag, mnemonic,
-                                        0x3c, size, trace)) != EXECUTE_OK) {
+  if ((status = ComputeEffectiveAddress(src_addr, in_register_flag, 0x3c,
+                                        size)) != EXECUTE_OK) {
     return (status);
   }
 
@@ -1318,38 +1022,30 @@ int cpu32::ExecuteANDItoCCR(int, std::string &trace_record, int trace) {
     return (status);
 
   SetRegister(SR_INDEX, (register_value[SR_INDEX] & src), BYTE);
-  if (trace) {
-    mnemonic += ",CCR}} ";
-    trace_record += mnemonic;
-  }
   return (EXECUTE_OK);
 }
 
-int cpu32::ExecuteANDItoSR(int, std::string &trace_record, int trace) {
+int cpu32::ExecuteANDItoSR(int) {
   int status, size, in_register_flag;
   unsigned long src_addr;
   unsigned int src;
-  std::string mnemonic;
+
+  EvaluateConditionCodes();
 
   // Make sure we're in supervisor mode or trap
   if (!(register_value[SR_INDEX] & S_FLAG)) {
     SetRegister(PC_INDEX, register_value[PC_INDEX] - 2, LONG);
     if ((status = ProcessException(8)) != EXECUTE_OK)
       return (status);
-    if (trace)
-      ;
-    trace_record += "{Mnemonic {Privilege Violation Exception}} ";
+    myExceptionMnemonic = "Privilege Violation Exception";
     return (EXECUTE_PRIVILEGED_OK);
   }
 
   size = WORD;
 
-  if (trace)
-    mnemonic += "{Mnemonic {ANDI.W ";
-
   // Get the immediate data pointer
-  if ((status = ComputeEffectiveAddress(src_addr, in_register_flag, mnemonic,
-                                        0x3c, size, trace)) != EXECUTE_OK) {
+  if ((status = ComputeEffectiveAddress(src_addr, in_register_flag, 0x3c,
+                                        size)) != EXECUTE_OK) {
     return (status);
   }
 
@@ -1359,19 +1055,15 @@ int cpu32::ExecuteANDItoSR(int, std::string &trace_record, int trace) {
 
   SetRegister(SR_INDEX, register_value[SR_INDEX] & src, WORD);
 
-  if (trace) {
-    mnemonic += ",SR}} ";
-    trace_record += mnemonic;
-  }
   return (EXECUTE_PRIVILEGED_OK);
 }
 
-int cpu32::ExecuteASL(int opcode, std::string &trace_record, int trace) {
+int cpu32::ExecuteASL(int opcode) {
   int status, size, in_register_flag, shift_count;
   unsigned long address;
   unsigned int data;
-  std::string ea_description;
 
+  EvaluateConditionCodes();
   size = (opcode & 0x00c0) >> 6;
 
   // Check to see if this is a memory or register shift
@@ -1380,8 +1072,7 @@ int cpu32::ExecuteASL(int opcode, std::string &trace_record, int trace) {
 
     // Get the address
     if ((status = ComputeEffectiveAddress(address, in_register_flag,
-                                          ea_description, opcode & 0x3f, size,
-                                          trace)) != EXECUTE_OK) {
+                                          opcode & 0x3f, size)) != EXECUTE_OK) {
       return (status);
     }
 
@@ -1396,8 +1087,8 @@ int cpu32::ExecuteASL(int opcode, std::string &trace_record, int trace) {
     if ((status = Poke(address, data, size)) != EXECUTE_OK)
       return (status);
 
-    SetConditionCodes(0, 0, data, size, OTHER,
-                      N_FLAG | Z_FLAG | X_FLAG | C_FLAG | V_FLAG);
+    ComputeConditionCodes(0, 0, data, size, OTHER,
+                          N_FLAG | Z_FLAG | X_FLAG | C_FLAG | V_FLAG);
     if (data & 0x00010000) {
       register_value[SR_INDEX] |= C_FLAG;
       register_value[SR_INDEX] |= X_FLAG;
@@ -1409,23 +1100,11 @@ int cpu32::ExecuteASL(int opcode, std::string &trace_record, int trace) {
     // Compute the shift count
     if (opcode & 32) {
       shift_count = register_value[D0_INDEX + ((opcode & 0x0e00) >> 9)] & 0x3f;
-      if (trace)
-        ea_description =
-            ourRegisterData[D0_INDEX + ((opcode & 0x0e00) >> 9)].name;
     } else {
       if ((shift_count = (opcode & 0x0e00) >> 9) == 0)
         shift_count = 8;
-
-      if (trace) {
-        ea_description = "#$";
-        ea_description += IntToString(shift_count, 1);
-      }
-    }
-
-    if (trace) {
-      ea_description += ",";
-      ea_description += ourRegisterData[D0_INDEX + (opcode & 7)].name;
     }
+    myCycles += 2 * shift_count;
 
     unsigned int carry = 0, overflow = 0;
     unsigned int carry_mask, overflow_mask;
@@ -1455,8 +1134,8 @@ int cpu32::ExecuteASL(int opcode, std::string &trace_record, int trace) {
 
     SetRegister(D0_INDEX + (opcode & 7), data, size);
 
-    SetConditionCodes(0, 0, data, size, OTHER,
-                      N_FLAG | Z_FLAG | X_FLAG | C_FLAG | V_FLAG);
+    ComputeConditionCodes(0, 0, data, size, OTHER,
+                          N_FLAG | Z_FLAG | X_FLAG | C_FLAG | V_FLAG);
     if (overflow)
       register_value[SR_INDEX] |= V_FLAG;
     if (carry) {
@@ -1465,26 +1144,15 @@ int cpu32::ExecuteASL(int opcode, std::string &trace_record, int trace) {
     }
   }
 
-  if (trace) {
-    trace_record += "{Mnemonic {ASL";
-    if (size == BYTE)
-      trace_record += ".B ";
-    else if (size == WORD)
-      trace_record += ".W ";
-    else if (size == LONG)
-      trace_record += ".L ";
-    trace_record += ea_description;
-    trace_record += "}} ";
-  }
   return (EXECUTE_OK);
 }
 
-int cpu32::ExecuteASR(int opcode, std::string &trace_record, int trace) {
+int cpu32::ExecuteASR(int opcode) {
   int status, size, in_register_flag, shift_count;
   unsigned long address;
   unsigned int data;
-  std::string ea_description;
 
+  EvaluateConditionCodes();
   size = (opcode & 0x00c0) >> 6;
 
   // Check to see if this is a memory or register shift
@@ -1493,8 +1161,7 @@ int cpu32::ExecuteASR(int opcode, std::string &trace_record, int trace) {
 
     // Get the address
     if ((status = ComputeEffectiveAddress(address, in_register_flag,
-                                          ea_description, opcode & 0x3f, size,
-                                          trace)) != EXECUTE_OK) {
+                                          opcode & 0x3f, size)) != EXECUTE_OK) {
       return (status);
     }
 
@@ -1503,8 +1170,8 @@ int cpu32::ExecuteASR(int opcode, std::string &trace_record, int trace) {
       return (status);
 
     // Set the condition codes
-    SetConditionCodes(0, 0, data >> 1, size, OTHER,
-                      N_FLAG | Z_FLAG | X_FLAG | C_FLAG | V_FLAG);
+    ComputeConditionCodes(0, 0, data >> 1, size, OTHER,
+                          N_FLAG | Z_FLAG | X_FLAG | C_FLAG | V_FLAG);
     if (data & 0x0001) {
       register_value[SR_INDEX] |= C_FLAG;
       register_value[SR_INDEX] |= X_FLAG;
@@ -1526,23 +1193,11 @@ int cpu32::ExecuteASR(int opcode, std::string &trace_record, int trace) {
     // Compute the shift count
     if (opcode & 32) {
       shift_count = register_value[D0_INDEX + ((opcode & 0x0e00) >> 9)] & 0x3f;
-      if (trace)
-        ea_description =
-            ourRegisterData[D0_INDEX + ((opcode & 0x0e00) >> 9)].name;
     } else {
       if ((shift_count = (opcode & 0x0e00) >> 9) == 0)
         shift_count = 8;
-
-      if (trace) {
-        ea_description = "#$";
-        ea_description += IntToString(shift_count, 1);
-      }
-    }
-
-    if (trace) {
-      ea_description += ",";
-      ea_description += ourRegisterData[D0_INDEX + (opcode & 7)].name;
     }
+    myCycles += 2 * shift_count;
 
     unsigned int carry = 0, replicate_mask, msb;
 
@@ -1573,47 +1228,34 @@ int cpu32::ExecuteASR(int opcode, std::string &trace_record, int trace) {
 
     SetRegister(D0_INDEX + (opcode & 7), data, size);
 
-    SetConditionCodes(0, 0, data, size, OTHER,
-                      N_FLAG | Z_FLAG | X_FLAG | C_FLAG | V_FLAG);
+    ComputeConditionCodes(0, 0, data, size, OTHER,
+                          N_FLAG | Z_FLAG | X_FLAG | C_FLAG | V_FLAG);
     if (carry) {
       register_value[SR_INDEX] |= C_FLAG;
       register_value[SR_INDEX] |= X_FLAG;
     }
   }
 
-  if (trace) {
-    trace_record += "{Mnemonic {ASR";
-    if (size == BYTE)
-      trace_record += ".B ";
-    else if (size == WORD)
-      trace_record += ".W ";
-    else if (size == LONG)
-      trace_record += ".L ";
-    trace_record += ea_description;
-    trace_record += "}} ";
-  }
   return (EXECUTE_OK);
 }
 
-int cpu32::ExecuteBit(int opcode, std::string &trace_record, int trace) {
+int cpu32::ExecuteBit(int opcode) {
   int status, size, in_register_flag;
   unsigned long ea_address, register_number;
   unsigned int ea_data, bit_number;
-  std::string mnemonic, ea_description;
+
+  EvaluateConditionCodes();
 
   // Get the bit number we're supposed to be checking
   if (opcode & 256) {
     register_number = D0_INDEX + ((opcode & 0x0e00) >> 9);
     bit_number = register_value[register_number];
-    if (trace)
-      ea_description = ourRegisterData[register_number].name;
   } else {
     unsigned long address;
 
     // Get the immediate data pointer
-    if ((status = ComputeEffectiveAddress(address, in_register_flag,
-                                          ea_description, 0x3c, WORD, trace)) !=
-        EXECUTE_OK) {
+    if ((status = ComputeEffectiveAddress(address, in_register_flag, 0x3c,
+                                          WORD)) != EXECUTE_OK) {
       return (status);
     }
 
@@ -1622,9 +1264,6 @@ int cpu32::ExecuteBit(int opcode, std::string &trace_record, int trace) {
       return (status);
   }
 
-  if (trace)
-    ea_description += ",";
-
   // Determine the size of the operation (BYTE or LONG)
   if ((opcode & 0x38) == 0)
     size = LONG;
@@ -1632,9 +1271,8 @@ int cpu32::ExecuteBit(int opcode, std::string &trace_record, int trace) {
     size = BYTE;
 
   // Get the <ea> data address
-  if ((status =
-           ComputeEffectiveAddress(ea_address, in_register_flag, ea_description,
-                                   opcode & 0x3f, size, trace)) != EXECUTE_OK) {
+  if ((status = ComputeEffectiveAddress(ea_address, in_register_flag,
+                                        opcode & 0x3f, size)) != EXECUTE_OK) {
     return (status);
   }
 
@@ -1656,13 +1294,9 @@ int cpu32::ExecuteBit(int opcode, std::string &trace_record, int trace) {
 
   switch ((opcode & 0x00c0) >> 6) {
   case 0: // BTST
-    if (trace)
-      mnemonic += "{Mnemonic {BTST";
     break;
 
   case 1: // BCHG
-    if (trace)
-      mnemonic += "{Mnemonic {BCHG";
     if (ea_data & bit_number)
       ea_data &= ~bit_number;
     else
@@ -1670,14 +1304,10 @@ int cpu32::ExecuteBit(int opcode, std::string &trace_record, int trace) {
     break;
 
   case 2: // BCLR
-    if (trace)
-      mnemonic += "{Mnemonic {BCLR";
     ea_data &= ~bit_number;
     break;
 
   case 3: // BSET
-    if (trace)
-      mnemonic += "{Mnemonic {BSET";
     ea_data |= bit_number;
     break;
   }
@@ -1690,25 +1320,12 @@ int cpu32::ExecuteBit(int opcode, std::string &trace_record, int trace) {
       return (status);
   }
 
-  if (trace) {
-    if (size == BYTE)
-      mnemonic += ".B ";
-    else
-      mnemonic += ".L ";
-    trace_record += mnemonic;
-    trace_record += ea_description;
-    trace_record += "}} ";
-  }
   return (EXECUTE_OK);
 }
 
-int cpu32::ExecuteBRA(int opcode, std::string &trace_record, int trace) {
+int cpu32::ExecuteBRA(int opcode) {
   unsigned int displacement;
   int status;
-  std::string mnemonic;
-
-  if (trace)
-    mnemonic = "{Mnemonic {BRA";
 
   // Compute the displacement
   if ((displacement = opcode & 0xff) == 0xFF) {
@@ -1718,12 +1335,6 @@ int cpu32::ExecuteBRA(int opcode, std::string &trace_record, int trace) {
       return (status);
 
     displacement = SignExtend(displacement, LONG);
-    if (trace) {
-      mnemonic += ".L $";
-      mnemonic += IntToString(displacement, 8);
-      mnemonic += "}} ";
-      trace_record += mnemonic;
-    }
   } else if ((displacement = opcode & 0xff) == 0) {
     // Fetch the 16-bit displacement data
     status = Peek(register_value[PC_INDEX], displacement, WORD);
@@ -1731,34 +1342,18 @@ int cpu32::ExecuteBRA(int opcode, std::string &trace_record, int trace) {
       return (status);
 
     displacement = SignExtend(displacement, WORD);
-    if (trace) {
-      mnemonic += ".W $";
-      mnemonic += IntToString(displacement, 4);
-      mnemonic += "}} ";
-      trace_record += mnemonic;
-    }
   } else {
     displacement = SignExtend(displacement, BYTE);
-    if (trace) {
-      mnemonic += ".B $";
-      mnemonic += IntToString(displacement, 2);
-      mnemonic += "}} ";
-      trace_record += mnemonic;
-    }
   }
 
   SetRegister(PC_INDEX, register_value[PC_INDEX] + displacement, LONG);
   return (EXECUTE_OK);
 }
 
-int cpu32::ExecuteBSR(int opcode, std::string &trace_record, int trace) {
+int cpu32::ExecuteBSR(int opcode) {
   unsigned int displacement;
   int status;
   unsigned long addr;
-  std::string mnemonic;
-
-  if (trace)
-    mnemonic = "{Mnemonic {BSR";
 
   // Compute the displacement
   if ((displacement = opcode & 0xff) == 0xFF) {
@@ -1768,12 +1363,6 @@ int cpu32::ExecuteBSR(int opcode, std::string &trace_record, int trace) {
       return (status);
 
     displacement = SignExtend(displacement, LONG);
-    if (trace) {
-      mnemonic += ".L $";
-      mnemonic += IntToString(displacement, 8);
-      mnemonic += "}} ";
-      trace_record += mnemonic;
-    }
   } else if ((displacement = opcode & 0xff) == 0) {
     // Fetch the 16-bit displacement data
     status = Peek(register_value[PC_INDEX], displacement, WORD);
@@ -1781,18 +1370,8 @@ int cpu32::ExecuteBSR(int opcode, std::string &trace_record, int trace) {
       return (status);
 
     displacement = SignExtend(displacement, WORD);
-    if (trace) {
-      mnemonic += ".W $";
-      mnemonic += IntToString(displacement, 4);
-      mnemonic += "}} ";
-    }
   } else {
     displacement = SignExtend(displacement, BYTE);
-    if (trace) {
-      mnemonic += ".B $";
-      mnemonic += IntToString(displacement, 2);
-      mnemonic += "}}  ";
-    }
   }
 
   // Push the PC onto the stack
@@ -1817,16 +1396,12 @@ int cpu32::ExecuteBSR(int opcode, std::string &trace_record, int trace) {
 
   SetRegister(PC_INDEX, register_value[PC_INDEX] + displacement, LONG);
 
-  if (trace)
-    trace_record += mnemonic;
-
   return (EXECUTE_OK);
 }
 
-int cpu32::ExecuteBcc(int opcode, std::string &trace_record, int trace) {
+int cpu32::ExecuteBcc(int opcode) {
   unsigned int displacement, branch;
   int status;
-  std::string mnemonic;
 
   // Compute the displacement
   if ((opcode & 0xff) == 0xFF) {
@@ -1834,7 +1409,6 @@ int cpu32::ExecuteBcc(int opcode, std::string &trace_record, int trace) {
     status = Peek(register_value[PC_INDEX], displacement, LONG);
     if (status != EXECUTE_OK)
       return (status);
-
   } else if ((opcode & 0xff) == 0) {
     // Fetch the 16-bit displacement data
     status = Peek(register_value[PC_INDEX], displacement, WORD);
@@ -1844,32 +1418,21 @@ int cpu32::ExecuteBcc(int opcode, std::string &trace_record, int trace) {
     displacement = opcode & 0xff;
   }
 
-  if (trace)
-    mnemonic = "{Mnemonic {B";
-
   // See if the branch should occur
-  branch = CheckConditionCodes((opcode & 0x0f00) >> 8, mnemonic, trace);
+  branch = CheckConditionCodes((opcode & 0x0f00) >> 8);
 
   if ((opcode & 0xff) == 0xff) {
-    if (trace) {
-      mnemonic += ".L $";
-      mnemonic += IntToString(displacement, 8);
-    }
     // displacement=SignExtend(displacement,LONG);
   } else if ((opcode & 0xff) == 0) {
-    if (trace) {
-      mnemonic += ".W $";
-      mnemonic += IntToString(displacement, 4);
-    }
     displacement = SignExtend(displacement, WORD);
   } else {
-    if (trace) {
-      mnemonic += ".B $";
-      mnemonic += IntToString(displacement, 2);
-    }
     displacement = SignExtend(displacement, BYTE);
   }
 
+  // A taken short branch or an untaken long one takes longer
+  if (branch != ((opcode & 0xff) == 0 || (opcode & 0xff) == 0xff))
+    myCycles += 2;
+
   if (branch)
     SetRegister(PC_INDEX, register_value[PC_INDEX] + displacement, LONG);
   else if ((opcode & 0xff) == 0xff)
@@ -1877,38 +1440,22 @@ int cpu32::ExecuteBcc(int opcode, std::string &trace_record, int trace) {
   else if ((opcode & 0xff) == 0)
     SetRegister(PC_INDEX, register_value[PC_INDEX] + 2, LONG);
 
-  if (trace) {
-    mnemonic += "}} ";
-    trace_record += mnemonic;
-  }
   return (EXECUTE_OK);
 }
 
-int cpu32::ExecuteCHK(int opcode, std::string &trace_record, int trace) {
-  return (ExecuteInvalid(opcode, trace_record, trace));
+int cpu32::ExecuteCHK(int opcode) {
+  return (ExecuteInvalid(opcode));
 }
 
-int cpu32::ExecuteCLR(int opcode, std::string &trace_record, int trace) {
+int cpu32::ExecuteCLR(int opcode) {
   int status, size, in_register;
   unsigned long address;
-  std::string mnemonic;
 
   size = (opcode & 0x00c0) >> 6;
 
-  if (trace) {
-    mnemonic += "{Mnemonic {CLR";
-    if (size == BYTE)
-      mnemonic += ".B ";
-    else if (size == WORD)
-      mnemonic += ".W ";
-    else if (size == LONG)
-      mnemonic += ".L ";
-  }
-
   // Get the destination data pointer
-  if ((status = ComputeEffectiveAddress(address, in_register, mnemonic,
-                                        opcode & 0x3f, size, trace)) !=
-      EXECUTE_OK) {
+  if ((status = ComputeEffectiveAddress(address, in_register, opcode & 0x3f,
+                                        size)) != EXECUTE_OK) {
     return (status);
   }
 
@@ -1921,25 +1468,19 @@ int cpu32::ExecuteCLR(int opcode, std::string &trace_record, int trace) {
       return (status);
   }
 
-  if (trace) {
-    mnemonic += "}} ";
-    trace_record += mnemonic;
-  }
   return (EXECUTE_OK);
 }
 
-int cpu32::ExecuteCMP(int opcode, std::string &trace_record, int trace) {
+int cpu32::ExecuteCMP(int opcode) {
   int status, size, in_register_flag;
   unsigned long ea_address, register_number;
   unsigned int result, ea_data;
-  std::string mnemonic, ea_description;
 
   size = (opcode & 0x00c0) >> 6;
 
   // Get the <ea> data address
-  if ((status =
-           ComputeEffectiveAddress(ea_address, in_register_flag, ea_description,
-                                   opcode & 0x3f, size, trace)) != EXECUTE_OK) {
+  if ((status = ComputeEffectiveAddress(ea_address, in_register_flag,
+                                        opcode & 0x3f, size)) != EXECUTE_OK) {
     return (status);
   }
 
@@ -1956,28 +1497,13 @@ int cpu32::ExecuteCMP(int opcode, std::string &trace_record, int trace) {
   SetConditionCodes(ea_data, register_value[register_number], result, size,
                     SUBTRACTION, C_FLAG | V_FLAG | Z_FLAG | N_FLAG);
 
-  if (trace) {
-    mnemonic += "{Mnemonic {CMP";
-    if (size == BYTE)
-      mnemonic += ".B ";
-    else if (size == WORD)
-      mnemonic += ".W ";
-    else if (size == LONG)
-      mnemonic += ".L ";
-    mnemonic += ea_description;
-    mnemonic += ",";
-    mnemonic += ourRegisterData[register_number].name;
-    mnemonic += "}} ";
-    trace_record += mnemonic;
-  }
   return (EXECUTE_OK);
 }
 
-int cpu32::ExecuteCMPA(int opcode, std::string &trace_record, int trace) {
+int cpu32::ExecuteCMPA(int opcode) {
   int status, size, in_register_flag;
   unsigned long ea_address, register_number;
   unsigned int result, ea_data;
-  std::string mnemonic, ea_description;
 
   if (opcode & 0x0100)
     size = LONG;
@@ -1985,9 +1511,8 @@ int cpu32::ExecuteCMPA(int opcode, std::string &trace_record, int trace) {
     size = WORD;
 
   // Get the <ea> data address
-  if ((status =
-           ComputeEffectiveAddress(ea_address, in_register_flag, ea_description,
-                                   opcode & 0x3f, size, trace)) != EXECUTE_OK) {
+  if ((status = ComputeEffectiveAddress(ea_address, in_register_flag,
+                                        opcode & 0x3f, size)) != EXECUTE_OK) {
     return (status);
   }
 
@@ -2009,42 +1534,19 @@ int cpu32::ExecuteCMPA(int opcode, std::string &trace_record, int trace) {
   result = register_value[register_number] - ea_data;
   SetConditionCodes(ea_data, register_value[register_number], result, size,
                     SUBTRACTION, C_FLAG | V_FLAG | Z_FLAG | N_FLAG);
-  if (trace) {
-    mnemonic += "{Mnemonic {CMPA";
-    if (size == WORD)
-      mnemonic += ".W ";
-    else if (size == LONG)
-      mnemonic += ".L ";
-    mnemonic += ea_description;
-    mnemonic += ",";
-    mnemonic += ourRegisterData[register_number].name;
-    mnemonic += "}} ";
-    trace_record += mnemonic;
-  }
   return (EXECUTE_OK);
 }
 
-int cpu32::ExecuteCMPI(int opcode, std::string &trace_record, int trace) {
+int cpu32::ExecuteCMPI(int opcode) {
   int status, size, in_register;
   unsigned long dest_addr, src_addr;
   unsigned int result, src, dest;
-  std::string mnemonic;
 
   size = (opcode & 0x00c0) >> 6;
 
-  if (trace) {
-    mnemonic += "{Mnemonic {CMPI";
-    if (size == BYTE)
-      mnemonic += ".B ";
-    else if (size == WORD)
-      mnemonic += ".W ";
-    else if (size == LONG)
-      mnemonic += ".L ";
-  }
-
   // Get the immediate data pointer
-  if ((status = ComputeEffectiveAddress(src_addr, in_register, mnemonic, 0x3c,
-                                        size, trace)) != EXECUTE_OK) {
+  if ((status = ComputeEffectiveAddress(src_addr, in_register, 0x3c, size)) !=
+      EXECUTE_OK) {
     return (status);
   }
 
@@ -2052,13 +1554,9 @@ int cpu32::ExecuteCMPI(int opcode, std::string &trace_record, int trace) {
   if ((status = Peek(src_addr, src, size)) != EXECUTE_OK)
     return (status);
 
-  if (trace)
-    mnemonic += ",";
-
   // Get the destination data pointer
-  if ((status = ComputeEffectiveAddress(dest_addr, in_register, mnemonic,
-                                        opcode & 0x3f, size, trace)) !=
-      EXECUTE_OK) {
+  if ((status = ComputeEffectiveAddress(dest_addr, in_register, opcode & 0x3f,
+                                        size)) != EXECUTE_OK) {
     return (status);
   }
 
@@ -2075,44 +1573,26 @@ int cpu32::ExecuteCMPI(int opcode, std::string &trace_record, int trace) {
                       C_FLAG | V_FLAG | Z_FLAG | N_FLAG);
   }
 
-  if (trace) {
-    mnemonic += "}} ";
-    trace_record += mnemonic;
-  }
   return (EXECUTE_OK);
 }
 
-int cpu32::ExecuteCMPM(int opcode, std::string &trace_record, int trace) {
+int cpu32::ExecuteCMPM(int opcode) {
   int status, size, in_register_flag;
   unsigned long src_address, dest_address;
   unsigned int result, src, dest;
-  std::string mnemonic;
 
   size = (opcode & 0x00c0) >> 6;
 
-  if (trace) {
-    mnemonic += "{Mnemonic {CMPM";
-    if (size == BYTE)
-      mnemonic += ".B ";
-    else if (size == WORD)
-      mnemonic += ".W ";
-    else if (size == LONG)
-      mnemonic += ".L ";
-  }
-
   // Get the addresses
-  if ((status = ComputeEffectiveAddress(src_address, in_register_flag, mnemonic,
-                                        0x18 | (opcode & 7), size, trace)) !=
+  if ((status = ComputeEffectiveAddress(src_address, in_register_flag,
+                                        0x18 | (opcode & 7), size)) !=
       EXECUTE_OK) {
     return (status);
   }
 
-  if (trace)
-    mnemonic += ",";
-
-  if ((status = ComputeEffectiveAddress(
-           dest_address, in_register_flag, mnemonic,
-           0x18 | ((opcode & 0x0e00) >> 9), size, trace)) != EXECUTE_OK) {
+  if ((status = ComputeEffectiveAddress(dest_address, in_register_flag,
+                                        0x18 | ((opcode & 0x0e00) >> 9),
+                                        size)) != EXECUTE_OK) {
     return (status);
   }
 
@@ -2125,20 +1605,12 @@ int cpu32::ExecuteCMPM(int opcode, std::string &trace_record, int trace) {
   SetConditionCodes(src, dest, result, size, SUBTRACTION,
                     C_FLAG | V_FLAG | N_FLAG | Z_FLAG);
 
-  if (trace) {
-    mnemonic += "}} ";
-    trace_record += mnemonic;
-  }
   return (EXECUTE_OK);
 }
 
-int cpu32::ExecuteDBcc(int opcode, std::string &trace_record, int trace) {
+int cpu32::ExecuteDBcc(int opcode) {
   unsigned int displacement, register_number, condition_code;
   int status;
-  std::string mnemonic;
-
-  if (trace)
-    mnemonic = "{Mnemonic {DB";
 
   // Fetch the 16-bit displacement data
   if ((status = Peek(register_value[PC_INDEX], displacement, WORD)) !=
@@ -2148,46 +1620,38 @@ int cpu32::ExecuteDBcc(int opcode, std::string &trace_record, int trace) {
   displacement = SignExtend(displacement, WORD);
 
   // Check the condition code
-  condition_code = CheckConditionCodes((opcode & 0x0f00) >> 8, mnemonic, trace);
+  condition_code = CheckConditionCodes((opcode & 0x0f00) >> 8);
 
   // Get the register number that we are counting with
   register_number = D0_INDEX + (opcode & 7);
 
-  if (trace) {
-    mnemonic += ".W ";
-    mnemonic += ourRegisterData[register_number].name;
-    mnemonic += ",$";
-    mnemonic += IntToString(displacement, 4);
-  }
-
   // If condition code is not true then preform Decrement and Branch
   if (!condition_code) {
     SetRegister(register_number, register_value[register_number] - 1, WORD);
-    if ((register_value[register_number] & 0xffff) == 0xffff)
+    if ((register_value[register_number] & 0xffff) == 0xffff) {
+      myCycles += 4;
       SetRegister(PC_INDEX, register_value[PC_INDEX] + 2, LONG);
-    else
+    } else {
       SetRegister(PC_INDEX, register_value[PC_INDEX] + displacement, LONG);
+    }
   } else {
+    myCycles += 2;
     SetRegister(PC_INDEX, register_value[PC_INDEX] + 2, LONG);
   }
 
-  if (trace) {
-    mnemonic += "}} ";
-    trace_record += mnemonic;
-  }
   return (EXECUTE_OK);
 }
 
-int cpu32::ExecuteDIVS(int opcode, std::string &trace_record, int trace) {
+int cpu32::ExecuteDIVS(int opcode) {
   int status, in_register_flag, positive_result;
   unsigned long ea_address, register_number;
   int ea_data, high_result, low_result, data;
-  std::string ea_description;
+
+  EvaluateConditionCodes();
 
   // Get the <ea> data address
-  if ((status =
-           ComputeEffectiveAddress(ea_address, in_register_flag, ea_description,
-                                   opcode & 0x3f, WORD, trace)) != EXECUTE_OK) {
+  if ((status = ComputeEffectiveAddress(ea_address, in_register_flag,
+                                        opcode & 0x3f, WORD)) != EXECUTE_OK) {
     return (status);
   }
 
@@ -2207,11 +1671,10 @@ int cpu32::ExecuteDIVS(int opcode, std::string &trace_record, int trace) {
   if (ea_data == 0) {
     if ((status = ProcessException(5)) != EXECUTE_OK)
       return (status);
-    if (trace)
-      ;
-    trace_record += "{Mnemonic {Divide by Zero Exception}} ";
+    myExceptionMnemonic = "Divide by Zero Exception";
     return (EXECUTE_OK);
   }
+  myCycles += 158;
 
   // Get the register number
   register_number = D0_INDEX + ((opcode & 0x0e00) >> 9);
@@ -2233,7 +1696,8 @@ int cpu32::ExecuteDIVS(int opcode, std::string &trace_record, int trace) {
   low_result = data / ea_data;
 
   SetRegister(register_number, high_result | (low_result & 0xffff), LONG);
-  SetConditionCodes(0, 0, low_result, WORD, OTHER, C_FLAG | Z_FLAG | N_FLAG);
+  ComputeConditionCodes(0, 0, low_result, WORD, OTHER,
+                        C_FLAG | Z_FLAG | N_FLAG);
 
   // Set the overflow flag
   if ((positive_result && (low_result & 0xffff8000)) ||
@@ -2242,26 +1706,19 @@ int cpu32::ExecuteDIVS(int opcode, std::string &trace_record, int trace) {
   else
     register_value[SR_INDEX] &= ~V_FLAG;
 
-  if (trace) {
-    trace_record += "{Mnemonic {DIVS.W ";
-    trace_record += ea_description;
-    trace_record += ",";
-    trace_record += ourRegisterData[register_number].name;
-    trace_record += "}} ";
-  }
   return (EXECUTE_OK);
 }
 
-int cpu32::ExecuteDIVU(int opcode, std::string &trace_record, int trace) {
+int cpu32::ExecuteDIVU(int opcode) {
   int status, in_register_flag;
   unsigned long ea_address, register_number;
   unsigned int high_result, low_result, ea_data;
-  std::string ea_description;
+
+  EvaluateConditionCodes();
 
   // Get the <ea> data address
-  if ((status =
-           ComputeEffectiveAddress(ea_address, in_register_flag, ea_description,
-                                   opcode & 0x3f, WORD, trace)) != EXECUTE_OK) {
+  if ((status = ComputeEffectiveAddress(ea_address, in_register_flag,
+                                        opcode & 0x3f, WORD)) != EXECUTE_OK) {
     return (status);
   }
 
@@ -2275,11 +1732,10 @@ int cpu32::ExecuteDIVU(int opcode, std::string &trace_record, int trace) {
   if (ea_data == 0) {
     if ((status = ProcessException(5)) != EXECUTE_OK)
       return (status);
-    if (trace)
-      ;
-    trace_record += "{Mnemonic {Divide by Zero Exception}} ";
+    myExceptionMnemonic = "Divide by Zero Exception";
     return (EXECUTE_OK);
   }
+  myCycles += 140;
 
   // Get the register number
   register_number = D0_INDEX + ((opcode & 0x0e00) >> 9);
@@ -2289,7 +1745,8 @@ int cpu32::ExecuteDIVU(int opcode, std::string &trace_record, int trace) {
   low_result = register_value[register_number] / ea_data;
 
   SetRegister(register_number, high_result | (low_result & 0xffff), LONG);
-  SetConditionCodes(0, 0, low_result, WORD, OTHER, C_FLAG | Z_FLAG | N_FLAG);
+  ComputeConditionCodes(0, 0, low_result, WORD, OTHER,
+                        C_FLAG | Z_FLAG | N_FLAG);
 
   // Set the overflow flag
   if (low_result & 0xffff0000)
@@ -2297,24 +1754,16 @@ int cpu32::ExecuteDIVU(int opcode, std::string &trace_record, int trace) {
   else
     register_value[SR_INDEX] &= ~V_FLAG;
 
-  if (trace) {
-    trace_record += "{Mnemonic {DIVU.W ";
-    trace_record += ea_description;
-    trace_record += ",";
-    trace_record += ourRegisterData[register_number].name;
-    trace_record += "}} ";
-  }
   return (EXECUTE_OK);
 }
 
-int cpu32::ExecuteDIVL(int opcode, std::string &trace_record, int trace) {
+int cpu32::ExecuteDIVL(int opcode) {
   // Note: check update of condition codes!
 
   int status, in_register_flag;
   unsigned long ea_address;
   unsigned int ea_data;
   unsigned int data;
-  std::string ea_description;
   unsigned long address;
   unsigned int opcode2;
 
@@ -2336,9 +1785,8 @@ int cpu32::ExecuteDIVL(int opcode, std::string &trace_record, int trace) {
   }
 
   // Get the <ea> data address
-  if ((status =
-           ComputeEffectiveAddress(ea_address, in_register_flag, ea_description,
-                                   opcode & 0x3f, LONG, trace)) != EXECUTE_OK) {
+  if ((status = ComputeEffectiveAddress(ea_address, in_register_flag,
+                                        opcode & 0x3f, LONG)) != EXECUTE_OK) {
     //**CPU_DEBUG_PRINT1(this, "[DIVL] Bad <ea_address>", (opcode&0x3F));
     return (status);
   }
@@ -2359,10 +1807,10 @@ int cpu32::ExecuteDIVL(int opcode, std::string &trace_record, int trace) {
   if (ea_data == 0) {
     if ((status = ProcessException(5)) != EXECUTE_OK)
       return (status);
-    if (trace)
-      trace_record += "{Mnemonic {Divide by Zero Exception}} ";
+    myExceptionMnemonic = "Divide by Zero Exception";
     return (EXECUTE_OK);
   }
+  myCycles += 140;
 
   // 64 bits or 32 bits registers for result
   if (opcode2 & (1 << 10)) {
@@ -2398,16 +1846,6 @@ int cpu32::ExecuteDIVL(int opcode, std::string &trace_record, int trace) {
       SetConditionCodes(0, 0, quo, LONG, OTHER, C_FLAG | Z_FLAG | N_FLAG);
       SetRegister(dh_number, mod, LONG);
       SetRegister(di_number, quo, LONG);
-
-      if (trace) {
-        trace_record += "{Mnemonic {DIVSL.L ";
-        trace_record += ea_description;
-        trace_record += ",";
-        trace_record += ourRegisterData[dh_number].name;
-        trace_record += ":";
-        trace_record += ourRegisterData[di_number].name;
-        trace_record += "}} ";
-      }
     } else {
       // unsigned
       unsigned long quo, mod;
@@ -2419,16 +1857,6 @@ int cpu32::ExecuteDIVL(int opcode, std::string &trace_record, int trace) {
                         V_FLAG | C_FLAG | Z_FLAG | N_FLAG);
       SetRegister(dh_number, mod, LONG);
       SetRegister(di_number, quo, LONG);
-
-      if (trace) {
-        trace_record += "{Mnemonic {DIVUL.L ";
-        trace_record += ea_description;
-        trace_record += ",";
-        trace_record += ourRegisterData[dh_number].name;
-        trace_record += ":";
-        trace_record += ourRegisterData[di_number].name;
-        trace_record += "}} ";
-      }
     }
   } else {
     // 32 bits division
@@ -2457,16 +1885,6 @@ int cpu32::ExecuteDIVL(int opcode, std::string &trace_record, int trace) {
       SetConditionCodes(0, 0, quo, LONG, OTHER, C_FLAG | Z_FLAG | N_FLAG);
       SetRegister(dh_number, mod, LONG);
       SetRegister(di_number, quo, LONG);
-
-      if (trace) {
-        trace_record += "{Mnemonic {DIVS.L ";
-        trace_record += ea_description;
-        trace_record += ",";
-        trace_record += ourRegisterData[dh_number].name;
-        trace_record += ":";
-        trace_record += ourRegisterData[di_number].name;
-        trace_record += "}} ";
-      }
     } else {
       // unsigned
       unsigned long quo, mod;
@@ -2477,33 +1895,21 @@ int cpu32::ExecuteDIVL(int opcode, std::string &trace_record, int trace) {
       SetConditionCodes(0, 0, quo, LONG, OTHER, C_FLAG | Z_FLAG | N_FLAG);
       SetRegister(dh_number, mod, LONG);
       SetRegister(di_number, quo, LONG);
-
-      if (trace) {
-        trace_record += "{Mnemonic {DIVU.L ";
-        trace_record += ea_description;
-        trace_record += ",";
-        trace_record += ourRegisterData[dh_number].name;
-        trace_record += ":";
-        trace_record += ourRegisterData[di_number].name;
-        trace_record += "}} ";
-      }
     }
   }
   return (EXECUTE_OK);
 }
 
-int cpu32::ExecuteEOR(int opcode, std::string &trace_record, int trace) {
+int cpu32::ExecuteEOR(int opcode) {
   int status, size, in_register_flag;
   unsigned long ea_address, register_number;
   unsigned int result, ea_data;
-  std::string mnemonic, ea_description;
 
   size = (opcode & 0x00c0) >> 6;
 
   // Get the <ea> data address
-  if ((status =
-           ComputeEffectiveAddress(ea_address, in_register_flag, ea_description,
-                                   opcode & 0x3f, size, trace)) != EXECUTE_OK) {
+  if ((status = ComputeEffectiveAddress(ea_address, in_register_flag,
+                                        opcode & 0x3f, size)) != EXECUTE_OK) {
     return (status);
   }
 
@@ -2524,44 +1930,19 @@ int cpu32::ExecuteEOR(int opcode, std::string &trace_record, int trace) {
   else if ((status = Poke(ea_address, result, size)) != EXECUTE_OK)
     return (status);
 
-  if (trace) {
-    mnemonic += "{Mnemonic {EOR";
-    if (size == BYTE)
-      mnemonic += ".B ";
-    else if (size == WORD)
-      mnemonic += ".W ";
-    else if (size == LONG)
-      mnemonic += ".L ";
-    mnemonic += ourRegisterData[register_number].name;
-    mnemonic += ",";
-    mnemonic += ea_description;
-    mnemonic += "}} ";
-    trace_record += mnemonic;
-  }
   return (EXECUTE_OK);
 }
 
-int cpu32::ExecuteEORI(int opcode, std::string &trace_record, int trace) {
+int cpu32::ExecuteEORI(int opcode) {
   int status, size, in_register;
   unsigned long dest_addr, src_addr;
   unsigned int result, src, dest;
-  std::string mnemonic;
 
   size = (opcode & 0x00c0) >> 6;
 
-  if (trace) {
-    mnemonic += "{Mnemonic {EORI";
-    if (size == BYTE)
-      mnemonic += ".B ";
-    else if (size == WORD)
-      mnemonic += ".W ";
-    else if (size == LONG)
-      mnemonic += ".L ";
-  }
-
   // Get the immediate data pointer
-  if ((status = ComputeEffectiveAddress(src_addr, in_register, mnemonic, 0x3c,
-                                        size, trace)) != EXECUTE_OK) {
+  if ((status = ComputeEffectiveAddress(src_addr, in_register, 0x3c, size)) !=
+      EXECUTE_OK) {
     return (status);
   }
 
@@ -2569,13 +1950,9 @@ int cpu32::ExecuteEORI(int opcode, std::string &trace_record, int trace) {
   if ((status = Peek(src_addr, src, size)) != EXECUTE_OK)
     return (status);
 
-  if (trace)
-    mnemonic += ",";
-
   // Get the destination data pointer
-  if ((status = ComputeEffectiveAddress(dest_addr, in_register, mnemonic,
-                                        opcode & 0x3f, size, trace)) !=
-      EXECUTE_OK) {
+  if ((status = ComputeEffectiveAddress(dest_addr, in_register, opcode & 0x3f,
+                                        size)) != EXECUTE_OK) {
     return (status);
   }
 
@@ -2595,23 +1972,19 @@ int cpu32::ExecuteEORI(int opcode, std::string &trace_record, int trace) {
       return (status);
   }
 
-  if (trace) {
-    mnemonic += "}} ";
-    trace_record += mnemonic;
-  }
   return (EXECUTE_OK);
 }
 
-int cpu32::ExecuteEORItoCCR(int, std::string &trace_record, int trace) {
+int cpu32::ExecuteEORItoCCR(int) {
   int status, in_register_flag;
   unsigned long src_addr;
   unsigned int src;
-  std::string ea_description;
+
+  EvaluateConditionCodes();
 
   // Get the immediate data pointer
-  if ((status = ComputeEffectiveAddress(src_addr, in_register_flag,
-                                        ea_description, 0x3c, BYTE, trace)) !=
-      EXECUTE_OK) {
+  if ((status = ComputeEffectiveAddress(src_addr, in_register_flag, 0x3c,
+                                        BYTE)) != EXECUTE_OK) {
     return (status);
   }
 
@@ -2620,35 +1993,28 @@ int cpu32::ExecuteEORItoCCR(int, std::string &trace_record, int trace) {
     return (status);
 
   SetRegister(SR_INDEX, register_value[SR_INDEX] ^ src, BYTE);
-  if (trace) {
-    trace_record += "{Mnemonic {EORI.B ";
-    trace_record += ea_description;
-    trace_record += ",CCR}} ";
-  }
   return (EXECUTE_OK);
 }
 
-int cpu32::ExecuteEORItoSR(int, std::string &trace_record, int trace) {
+int cpu32::ExecuteEORItoSR(int) {
   int status, in_register_flag;
   unsigned long src_addr;
   unsigned int src;
-  std::string ea_description;
+
+  EvaluateConditionCodes();
 
   // Make sure we're in supervisor mode or trap
   if (!(register_value[SR_INDEX] & S_FLAG)) {
     SetRegister(PC_INDEX, register_value[PC_INDEX] - 2, LONG);
     if ((status = ProcessException(8)) != EXECUTE_OK)
       return (status);
-    if (trace)
-      ;
-    trace_record += "{Mnemonic {Privilege Violation Exception}} ";
+    myExceptionMnemonic = "Privilege Violation Exception";
     return (EXECUTE_PRIVILEGED_OK);
   }
 
   // Get the immediate data pointer
-  if ((status = ComputeEffectiveAddress(src_addr, in_register_flag,
-                                        ea_description, 0x3c, WORD, trace)) !=
-      EXECUTE_OK) {
+  if ((status = ComputeEffectiveAddress(src_addr, in_register_flag, 0x3c,
+                                        WORD)) != EXECUTE_OK) {
     return (status);
   }
 
@@ -2658,15 +2024,10 @@ int cpu32::ExecuteEORItoSR(int, std::string &trace_record, int trace) {
 
   SetRegister(SR_INDEX, register_value[SR_INDEX] ^ src, WORD);
 
-  if (trace) {
-    trace_record += "{Mnemonic {EORI.W ";
-    trace_record += ea_description;
-    trace_record += ",SR}} ";
-  }
   return (EXECUTE_PRIVILEGED_OK);
 }
 
-int cpu32::ExecuteEXG(int opcode, std::string &trace_record, int trace) {
+int cpu32::ExecuteEXG(int opcode) {
   unsigned long tmp;
   unsigned int src_register, dest_register;
 
@@ -2703,23 +2064,13 @@ int cpu32::ExecuteEXG(int opcode, std::string &trace_record, int trace) {
   SetRegister(src_register, register_value[dest_register], LONG);
   SetRegister(dest_register, tmp, LONG);
 
-  if (trace) {
-    trace_record += "{Mnemonic {EXG.L ";
-    trace_record += ourRegisterData[src_register].name;
-    trace_record += ",";
-    trace_record += ourRegisterData[dest_register].name;
-    trace_record += "}} ";
-  }
   return (EXECUTE_OK);
 }
 
-int cpu32::ExecuteEXT(int opcode, std::string &trace_record, int trace) {
+int cpu32::ExecuteEXT(int opcode) {
   unsigned int register_number;
   unsigned long data;
 
-  if (trace)
-    trace_record += "{Mnemonic {EXT";
-
   // Get the data register number
   register_number = D0_INDEX + (opcode & 0x0007);
   data = register_value[register_number];
@@ -2730,32 +2081,22 @@ int cpu32::ExecuteEXT(int opcode, std::string &trace_record, int trace) {
     SetRegister(register_number, data, WORD);
     SetConditionCodes(0, 0, data, WORD, OTHER,
                       V_FLAG | C_FLAG | Z_FLAG | N_FLAG);
-    if (trace)
-      trace_record += ".W ";
   } else if (((opcode & 0x01c0) >> 6) == 3) {
     data = SignExtend(data, WORD);
     SetRegister(register_number, data, LONG);
     SetConditionCodes(0, 0, data, LONG, OTHER,
                       V_FLAG | C_FLAG | Z_FLAG | N_FLAG);
-    if (trace)
-      trace_record += ".L ";
   } else if (((opcode & 0x01c0) >> 6) == 7) {
     data = SignExtend(data, BYTE);
     SetRegister(register_number, data, LONG);
     SetConditionCodes(0, 0, data, LONG, OTHER,
                       V_FLAG | C_FLAG | Z_FLAG | N_FLAG);
-    if (trace)
-      trace_record += "B.L ";
   }
 
-  if (trace) {
-    trace_record += ourRegisterData[register_number].name;
-    trace_record += "}} ";
-  }
   return (EXECUTE_OK);
 }
 
-int cpu32::ExecuteILLEGAL(int, std::string &trace_record, int trace) {
+int cpu32::ExecuteILLEGAL(int) {
   int status;
 
   // Move the PC back to the start of the illegal instruction opcode
@@ -2765,43 +2106,31 @@ int cpu32::ExecuteILLEGAL(int, std::string &trace_record, int trace) {
   if ((status = ProcessException(4)) != EXECUTE_OK)
     return (status);
 
-  if (trace)
-    trace_record += "{Mnemonic {ILLEGAL}} ";
-
   return (EXECUTE_OK);
 }
 
-int cpu32::ExecuteJMP(int opcode, std::string &trace_record, int trace) {
+int cpu32::ExecuteJMP(int opcode) {
   int status, in_register_flag;
   unsigned long address;
-  std::string ea_description;
 
   // Get the effective address
-  if ((status =
-           ComputeEffectiveAddress(address, in_register_flag, ea_description,
-                                   opcode & 0x3f, LONG, trace)) != EXECUTE_OK) {
+  if ((status = ComputeEffectiveAddress(address, in_register_flag,
+                                        opcode & 0x3f, LONG)) != EXECUTE_OK) {
     return (status);
   }
 
   SetRegister(PC_INDEX, address, LONG);
 
-  if (trace) {
-    trace_record += "{Mnemonic {JMP ";
-    trace_record += ea_description;
-    trace_record += "}} ";
-  }
   return (EXECUTE_OK);
 }
 
-int cpu32::ExecuteJSR(int opcode, std::string &trace_record, int trace) {
+int cpu32::ExecuteJSR(int opcode) {
   int status, in_register_flag;
   unsigned long address, stack_address;
-  std::string ea_description;
 
   // Get the effective address
-  if ((status =
-           ComputeEffectiveAddress(address, in_register_flag, ea_description,
-                                   opcode & 0x3f, LONG, trace)) != EXECUTE_OK) {
+  if ((status = ComputeEffectiveAddress(address, in_register_flag,
+                                        opcode & 0x3f, LONG)) != EXECUTE_OK) {
     return (status);
   }
 
@@ -2819,29 +2148,22 @@ int cpu32::ExecuteJSR(int opcode, std::string &trace_record, int trace) {
 
   SetRegister(PC_INDEX, address, LONG);
 
-  if (trace) {
-    trace_record += "{Mnemonic {JSR ";
-    trace_record += ea_description;
-    trace_record += "}} ";
-  }
   return (EXECUTE_OK);
 }
 
-int cpu32::ExecuteLEA(int opcode, std::string &trace_record, int trace) {
+int cpu32::ExecuteLEA(int opcode) {
   int status, in_register_flag;
   unsigned long address, register_number;
-  std::string ea_description;
 
   // for EXTB instruction, if mode (bit 3 to 5) is 0 then
   // it is not a LEA but an EXTB!
   if ((opcode & 0x38) == 0) {
-    return ExecuteEXT(opcode, trace_record, trace);
+    return ExecuteEXT(opcode);
   }
 
   // Get the effective address
-  if ((status =
-           ComputeEffectiveAddress(address, in_register_flag, ea_description,
-                                   opcode & 0x3f, LONG, trace)) != EXECUTE_OK) {
+  if ((status = ComputeEffectiveAddress(address, in_register_flag,
+                                        opcode & 0x3f, LONG)) != EXECUTE_OK) {
     return (status);
   }
 
@@ -2854,21 +2176,13 @@ int cpu32::ExecuteLEA(int opcode, std::string &trace_record, int trace) {
 
   SetRegister(register_number, address, LONG);
 
-  if (trace) {
-    trace_record += "{Mnemonic {LEA.L ";
-    trace_record += ea_description;
-    trace_record += ",";
-    trace_record += ourRegisterData[register_number].name;
-    trace_record += "}} ";
-  }
   return (EXECUTE_OK);
 }
 
-int cpu32::ExecuteLINK(int opcode, std::string &trace_record, int trace) {
+int cpu32::ExecuteLINK(int opcode) {
   int status, in_register_flag, stack_index;
   unsigned int register_number, displacement;
   unsigned long address;
-  std::string ea_description;
 
   // Long operation
   if ((opcode & 0x8)) {
@@ -2879,9 +2193,8 @@ int cpu32::ExecuteLINK(int opcode, std::string &trace_record, int trace) {
   }
 
   // Get the displacement data pointer
-  if ((status = ComputeEffectiveAddress(address, in_register_flag,
-                                        ea_description, 0x3c, WORD, trace)) !=
-      EXECUTE_OK) {
+  if ((status = ComputeEffectiveAddress(address, in_register_flag, 0x3c,
+                                        WORD)) != EXECUTE_OK) {
     return (status);
   }
 
@@ -2916,22 +2229,15 @@ int cpu32::ExecuteLINK(int opcode, std::string &trace_record, int trace) {
   // Add displacement to the stack pointer
   SetRegister(stack_index, register_value[stack_index] + displacement, LONG);
 
-  if (trace) {
-    trace_record += "{Mnemonic {LINK ";
-    trace_record += ourRegisterData[register_number].name;
-    trace_record += ",";
-    trace_record += ea_description;
-    trace_record += "}} ";
-  }
   return (EXECUTE_OK);
 }
 
-int cpu32::ExecuteLSL(int opcode, std::string &trace_record, int trace) {
+int cpu32::ExecuteLSL(int opcode) {
   int status, size, in_register_flag, shift_count;
   unsigned long address;
   unsigned int data;
-  std::string ea_description;
 
+  EvaluateConditionCodes();
   size = (opcode & 0x00c0) >> 6;
 
   // Check to see if this is a memory or register shift
@@ -2940,8 +2246,7 @@ int cpu32::ExecuteLSL(int opcode, std::string &trace_record, int trace) {
 
     // Get the address
     if ((status = ComputeEffectiveAddress(address, in_register_flag,
-                                          ea_description, opcode & 0x3f, size,
-                                          trace)) != EXECUTE_OK) {
+                                          opcode & 0x3f, size)) != EXECUTE_OK) {
       return (status);
     }
 
@@ -2956,8 +2261,8 @@ int cpu32::ExecuteLSL(int opcode, std::string &trace_record, int trace) {
     if ((status = Poke(address, data, size)) != EXECUTE_OK)
       return (status);
 
-    SetConditionCodes(0, 0, data, size, OTHER,
-                      N_FLAG | Z_FLAG | X_FLAG | C_FLAG | V_FLAG);
+    ComputeConditionCodes(0, 0, data, size, OTHER,
+                          N_FLAG | Z_FLAG | X_FLAG | C_FLAG | V_FLAG);
     if (data & 0x00010000) {
       register_value[SR_INDEX] |= C_FLAG;
       register_value[SR_INDEX] |= X_FLAG;
@@ -2966,23 +2271,11 @@ int cpu32::ExecuteLSL(int opcode, std::string &trace_record, int trace) {
     // Compute the shift count
     if (opcode & 32) {
       shift_count = register_value[D0_INDEX + ((opcode & 0x0e00) >> 9)] & 0x3f;
-      if (trace)
-        ea_description =
-            ourRegisterData[D0_INDEX + ((opcode & 0x0e00) >> 9)].name;
     } else {
       if ((shift_count = (opcode & 0x0e00) >> 9) == 0)
         shift_count = 8;
-
-      if (trace) {
-        ea_description = "#$";
-        ea_description += IntToString(shift_count, 1);
-      }
-    }
-
-    if (trace) {
-      ea_description += ",";
-      ea_description += ourRegisterData[D0_INDEX + (opcode & 7)].name;
     }
+    myCycles += 2 * shift_count;
 
     unsigned int carry = 0;
     unsigned int carry_mask;
@@ -3004,34 +2297,23 @@ int cpu32::ExecuteLSL(int opcode, std::string &trace_record, int trace) {
 
     SetRegister(D0_INDEX + (opcode & 7), data, size);
 
-    SetConditionCodes(0, 0, data, size, OTHER,
-                      N_FLAG | Z_FLAG | X_FLAG | C_FLAG | V_FLAG);
+    ComputeConditionCodes(0, 0, data, size, OTHER,
+                          N_FLAG | Z_FLAG | X_FLAG | C_FLAG | V_FLAG);
     if (carry) {
       register_value[SR_INDEX] |= C_FLAG;
       register_value[SR_INDEX] |= X_FLAG;
     }
   }
 
-  if (trace) {
-    trace_record += "{Mnemonic {LSL";
-    if (size == BYTE)
-      trace_record += ".B ";
-    else if (size == WORD)
-      trace_record += ".W ";
-    else if (size == LONG)
-      trace_record += ".L ";
-    trace_record += ea_description;
-    trace_record += "}} ";
-  }
   return (EXECUTE_OK);
 }
 
-int cpu32::ExecuteLSR(int opcode, std::string &trace_record, int trace) {
+int cpu32::ExecuteLSR(int opcode) {
   int status, size, in_register_flag, shift_count;
   unsigned long address;
   unsigned int data;
-  std::string ea_description;
 
+  EvaluateConditionCodes();
   size = (opcode & 0x00c0) >> 6;
 
   // Check to see if this is a memory or register shift
@@ -3040,8 +2322,7 @@ int cpu32::ExecuteLSR(int opcode, std::string &trace_record, int trace) {
 
     // Get the address
     if ((status = ComputeEffectiveAddress(address, in_register_flag,
-                                          ea_description, opcode & 0x3f, size,
-                                          trace)) != EXECUTE_OK) {
+                                          opcode & 0x3f, size)) != EXECUTE_OK) {
       return (status);
     }
 
@@ -3050,8 +2331,8 @@ int cpu32::ExecuteLSR(int opcode, std::string &trace_record, int trace) {
       return (status);
 
     // Set the condition codes
-    SetConditionCodes(0, 0, (data >> 1) & 0x7fff, size, OTHER,
-                      N_FLAG | Z_FLAG | X_FLAG | C_FLAG | V_FLAG);
+    ComputeConditionCodes(0, 0, (data >> 1) & 0x7fff, size, OTHER,
+                          N_FLAG | Z_FLAG | X_FLAG | C_FLAG | V_FLAG);
     if (data & 0x0001) {
       register_value[SR_INDEX] |= C_FLAG;
       register_value[SR_INDEX] |= X_FLAG;
@@ -3067,23 +2348,11 @@ int cpu32::ExecuteLSR(int opcode, std::string &trace_record, int trace) {
     // Compute the shift count
     if (opcode & 32) {
       shift_count = register_value[D0_INDEX + ((opcode & 0x0e00) >> 9)] & 0x3f;
-      if (trace)
-        ea_description =
-            ourRegisterData[D0_INDEX + ((opcode & 0x0e00) >> 9)].name;
     } else {
       if ((shift_count = (opcode & 0x0e00) >> 9) == 0)
         shift_count = 8;
-
-      if (trace) {
-        ea_description = "#$";
-        ea_description += IntToString(shift_count, 1);
-      }
-    }
-
-    if (trace) {
-      ea_description += ",";
-      ea_description += ourRegisterData[D0_INDEX + (opcode & 7)].name;
     }
+    myCycles += 2 * shift_count;
 
     unsigned int carry = 0, clear_mask;
 
@@ -3104,33 +2373,21 @@ int cpu32::ExecuteLSR(int opcode, std::string &trace_record, int trace) {
 
     SetRegister(D0_INDEX + (opcode & 7), data, size);
 
-    SetConditionCodes(0, 0, data, size, OTHER,
-                      N_FLAG | Z_FLAG | X_FLAG | C_FLAG | V_FLAG);
+    ComputeConditionCodes(0, 0, data, size, OTHER,
+                          N_FLAG | Z_FLAG | X_FLAG | C_FLAG | V_FLAG);
     if (carry) {
       register_value[SR_INDEX] |= C_FLAG;
       register_value[SR_INDEX] |= X_FLAG;
     }
   }
 
-  if (trace) {
-    trace_record += "{Mnemonic {LSR";
-    if (size == BYTE)
-      trace_record += ".B ";
-    else if (size == WORD)
-      trace_record += ".W ";
-    else if (size == LONG)
-      trace_record += ".L ";
-    trace_record += ea_description;
-    trace_record += "}} ";
-  }
   return (EXECUTE_OK);
 }
 
-int cpu32::ExecuteMOVE(int opcode, std::string &trace_record, int trace) {
+int cpu32::ExecuteMOVE(int opcode) {
   int status, in_register_flag, size;
   unsigned long src_address, dest_address;
   unsigned int src;
-  std::string ea_description;
 
   switch ((opcode & 0x3000) >> 12) {
   case 1:
@@ -3148,8 +2405,7 @@ int cpu32::ExecuteMOVE(int opcode, std::string &trace_record, int trace) {
 
   // Get the source effective address
   if ((status = ComputeEffectiveAddress(src_address, in_register_flag,
-                                        ea_description, opcode & 0x3f, size,
-                                        trace)) != EXECUTE_OK) {
+                                        opcode & 0x3f, size)) != EXECUTE_OK) {
     return (status);
   }
 
@@ -3158,13 +2414,10 @@ int cpu32::ExecuteMOVE(int opcode, std::string &trace_record, int trace) {
   else if ((status = Peek(src_address, src, size)) != EXECUTE_OK)
     return (status);
 
-  if (trace)
-    ea_description += ",";
-
   // Get the destination effective address
   if ((status = ComputeEffectiveAddress(
-           dest_address, in_register_flag, ea_description,
-           ((opcode & 0x01c0) >> 3) | ((opcode & 0x0e00) >> 9), size, trace)) !=
+           dest_address, in_register_flag,
+           ((opcode & 0x01c0) >> 3) | ((opcode & 0x0e00) >> 9), size)) !=
       EXECUTE_OK) {
     return (status);
   }
@@ -3175,25 +2428,13 @@ int cpu32::ExecuteMOVE(int opcode, std::string &trace_record, int trace) {
     return (status);
 
   SetConditionCodes(0, 0, src, size, OTHER, N_FLAG | Z_FLAG | V_FLAG | C_FLAG);
-  if (trace) {
-    trace_record += "{Mnemonic {MOVE";
-    if (size == BYTE)
-      trace_record += ".B ";
-    else if (size == WORD)
-      trace_record += ".W ";
-    else if (size == LONG)
-      trace_record += ".L ";
-    trace_record += ea_description;
-    trace_record += "}} ";
-  }
   return (EXECUTE_OK);
 }
 
-int cpu32::ExecuteMOVEA(int opcode, std::string &trace_record, int trace) {
+int cpu32::ExecuteMOVEA(int opcode) {
   int status, in_register_flag, size;
   unsigned long src_address, dest_address;
   unsigned int src;
-  std::string ea_description;
 
   switch ((opcode & 0x3000) >> 12) {
   case 3:
@@ -3208,8 +2449,7 @@ int cpu32::ExecuteMOVEA(int opcode, std::string &trace_record, int trace) {
 
   // Get the source effective address
   if ((status = ComputeEffectiveAddress(src_address, in_register_flag,
-                                        ea_description, opcode & 0x3f, size,
-                                        trace)) != EXECUTE_OK) {
+                                        opcode & 0x3f, size)) != EXECUTE_OK) {
     return (status);
   }
 
@@ -3221,13 +2461,10 @@ int cpu32::ExecuteMOVEA(int opcode, std::string &trace_record, int trace) {
   if (size == WORD)
     src = SignExtend(src, WORD);
 
-  if (trace)
-    ea_description += ",";
-
   // Get the destination effective address
   if ((status = ComputeEffectiveAddress(
-           dest_address, in_register_flag, ea_description,
-           ((opcode & 0x01c0) >> 3) | ((opcode & 0x0e00) >> 9), LONG, trace)) !=
+           dest_address, in_register_flag,
+           ((opcode & 0x01c0) >> 3) | ((opcode & 0x0e00) >> 9), LONG)) !=
       EXECUTE_OK) {
     return (status);
   }
@@ -3237,19 +2474,10 @@ int cpu32::ExecuteMOVEA(int opcode, std::string &trace_record, int trace) {
   else if ((status = Poke(dest_address, src, LONG)) != EXECUTE_OK)
     return (status);
 
-  if (trace) {
-    trace_record += "{Mnemonic {MOVEA";
-    if (size == WORD)
-      trace_record += ".W ";
-    else if (size == LONG)
-      trace_record += ".L ";
-    trace_record += ea_description;
-    trace_record += "}} ";
-  }
   return (EXECUTE_OK);
 }
 
-int cpu32::ExecuteMOVEC(int opcode, std::string &trace_record, int trace) {
+int cpu32::ExecuteMOVEC(int opcode) {
   int status;
   unsigned long address;
   unsigned int opcode2;
@@ -3261,9 +2489,7 @@ int cpu32::ExecuteMOVEC(int opcode, std::string &trace_record, int trace) {
     SetRegister(PC_INDEX, register_value[PC_INDEX] - 2, LONG);
     if ((status = ProcessException(8)) != EXECUTE_OK)
       return (status);
-    if (trace)
-      ;
-    trace_record += "{Mnemonic {Privilege Violation Exception}} ";
+    myExceptionMnemonic = "Privilege Violation Exception";
     return (EXECUTE_PRIVILEGED_OK);
   }
 
@@ -3301,29 +2527,14 @@ int cpu32::ExecuteMOVEC(int opcode, std::string &trace_record, int trace) {
   if (opcode & 1) // bit 0 gives the direction of the transfert
   {
     register_value[special_index] = register_value[general_index];
-    if (trace) {
-      trace_record += "{Mnemonic {MOVEC ";
-      trace_record += ourRegisterData[general_index].name;
-      trace_record += ",";
-      trace_record += ourRegisterData[special_index].name;
-      trace_record += "}} ";
-    }
-
   } else {
     register_value[general_index] = register_value[special_index];
-    if (trace) {
-      trace_record += "{Mnemonic {MOVEC ";
-      trace_record += ourRegisterData[special_index].name;
-      trace_record += ",";
-      trace_record += ourRegisterData[general_index].name;
-      trace_record += "}} ";
-    }
   }
 
   return (EXECUTE_OK);
 }
 
-int cpu32::ExecuteMOVES(int opcode, std::string &trace_record, int trace) {
+int cpu32::ExecuteMOVES(int opcode) {
   int status;
   int size;
   int in_register_flag;
@@ -3331,16 +2542,13 @@ int cpu32::ExecuteMOVES(int opcode, std::string &trace_record, int trace) {
   unsigned int opcode2;
   unsigned int src;
   int general_index; // index of the general purpose register
-  std::string ea_description;
 
   // Make sure we are in supervisor mode or trap
   if (!(register_value[SR_INDEX] & S_FLAG)) {
     SetRegister(PC_INDEX, register_value[PC_INDEX] - 2, LONG);
     if ((status = ProcessException(8)) != EXECUTE_OK)
       return (status);
-    if (trace)
-      ;
-    trace_record += "{Mnemonic {Privilege Violation Exception}} ";
+    myExceptionMnemonic = "Privilege Violation Exception";
     return (EXECUTE_PRIVILEGED_OK);
   }
 
@@ -3365,9 +2573,8 @@ int cpu32::ExecuteMOVES(int opcode, std::string &trace_record, int trace) {
 
   // Get the effective address (either source or destination
   // depending on the transfert direction)
-  if ((status =
-           ComputeEffectiveAddress(address, in_register_flag, ea_description,
-                                   opcode & 0x3f, size, trace)) != EXECUTE_OK) {
+  if ((status = ComputeEffectiveAddress(address, in_register_flag,
+                                        opcode & 0x3f, size)) != EXECUTE_OK) {
     return (status);
   }
 
@@ -3386,19 +2593,6 @@ int cpu32::ExecuteMOVES(int opcode, std::string &trace_record, int trace) {
     else if ((status = Poke(address, register_value[general_index], size)) !=
              EXECUTE_OK)
       return (status);
-    if (trace) {
-      trace_record += "{Mnemonic {MOVES";
-      if (size == BYTE)
-        trace_record += ".B ";
-      else if (size == WORD)
-        trace_record += ".W ";
-      else if (size == LONG)
-        trace_record += ".L ";
-      trace_record += ourRegisterData[general_index].name;
-      trace_record += ",";
-      trace_record += ea_description;
-      trace_record += "}} ";
-    }
   } else {
     // from ea to general_register
     if (in_register_flag) {
@@ -3408,30 +2602,15 @@ int cpu32::ExecuteMOVES(int opcode, std::string &trace_record, int trace) {
         return (status);
       register_value[general_index] = src;
     }
-
-    if (trace) {
-      trace_record += "{Mnemonic {MOVES ";
-      if (size == BYTE)
-        trace_record += ".B ";
-      else if (size == WORD)
-        trace_record += ".W ";
-      else if (size == LONG)
-        trace_record += ".L ";
-      trace_record += ea_description;
-      trace_record += ",";
-      trace_record += ourRegisterData[general_index].name;
-      trace_record += "}} ";
-    }
   }
 
   return (EXECUTE_OK);
 }
 
-int cpu32::ExecuteMOVEM(int opcode, std::string &trace_record, int trace) {
+int cpu32::ExecuteMOVEM(int opcode) {
   int status, in_register_flag, size;
   unsigned long address, offset, reg;
   unsigned int list, data;
-  std::string ea_description, mnemonic;
 
   // Determine size and offset
   if (opcode & 64) {
@@ -3442,24 +2621,27 @@ int cpu32::ExecuteMOVEM(int opcode, std::string &trace_record, int trace) {
     size = WORD;
   }
 
-  if (trace) {
-    mnemonic += "{Mnemonic {MOVEM";
-    if (size == WORD)
-      mnemonic += ".W ";
-    else if (size == LONG)
-      mnemonic += ".L ";
-  }
-
   // Get the register list mask
   if ((status = Peek(register_value[PC_INDEX], list, WORD)) != EXECUTE_OK)
     return (status);
   SetRegister(PC_INDEX, register_value[PC_INDEX] + 2, LONG);
 
+  // Each register transferred takes a bus cycle per word
+  int count = 0;
+  for (unsigned int bits = list & 0xffff; bits != 0; bits &= bits - 1)
+    ++count;
+  myCycles += 2 * offset * count;
+
+  // Registers are moved straight to or from host memory when the block
+  // lies in a single memory page
+  AddressSpace &space = *myAddressSpaces[0];
+  const Byte *source = nullptr;
+  Byte *destination = nullptr;
+
   // Get the effective address (if this isn't predecrement)
   if ((opcode & 0x38) != 32) {
     if ((status = ComputeEffectiveAddress(address, in_register_flag,
-                                          ea_description, opcode & 0x3f, size,
-                                          trace)) != EXECUTE_OK) {
+                                          opcode & 0x3f, size)) != EXECUTE_OK) {
       return (status);
     }
   }
@@ -3472,10 +2654,11 @@ int cpu32::ExecuteMOVEM(int opcode, std::string &trace_record, int trace) {
     else
       reg = A0_INDEX + (opcode & 7);
     address = register_value[reg];
-    if (trace) {
-      ea_description += "-(";
-      ea_description += ourRegisterData[reg].name;
-      ea_description += ")";
+    if (count != 0) {
+      destination = space.FindWriteMemory(address - count * offset,
+                                          count * offset);
+      if (destination != nullptr)
+        destination += count * offset;
     }
 
     for (unsigned int t = A0_INDEX + 7;;) {
@@ -3486,12 +2669,12 @@ int cpu32::ExecuteMOVEM(int opcode, std::string &trace_record, int trace) {
           reg = t;
 
         address -= offset;
-        if ((status = Poke(address, register_value[reg], size)) != EXECUTE_OK)
+        if (destination != nullptr) {
+          destination -= offset;
+          WriteBigEndian(destination, register_value[reg], offset);
+        } else if ((status = Poke(address, register_value[reg], size)) !=
+                   EXECUTE_OK) {
           return (status);
-
-        if (trace) {
-          mnemonic += ourRegisterData[reg].name;
-          mnemonic += " ";
         }
       }
 
@@ -3500,16 +2683,15 @@ int cpu32::ExecuteMOVEM(int opcode, std::string &trace_record, int trace) {
       else
         --t;
     }
-    if (trace) {
-      mnemonic += ",";
-      mnemonic += ea_description;
-    }
   } else // Postincrement or Control mode
   {
-    if (trace) {
-      mnemonic += ea_description;
-      mnemonic += ",";
+    if (count != 0) {
+      if (opcode & 1024)
+        source = space.FindReadMemory(address, count * offset);
+      else
+        destination = space.FindWriteMemory(address, count * offset);
     }
+
     for (unsigned int t = D0_INDEX; t <= A0_INDEX + 7; ++t) {
       if (list & (1 << (t - D0_INDEX))) {
         if ((register_value[SR_INDEX] & S_FLAG) && (t == USP_INDEX))
@@ -3518,19 +2700,23 @@ int cpu32::ExecuteMOVEM(int opcode, std::string &trace_record, int trace) {
           reg = t;
 
         if (opcode & 1024) {
-          if ((status = Peek(address, data, size)) != EXECUTE_OK)
+          if (source != nullptr) {
+            data = ReadBigEndian(source, offset);
+            source += offset;
+          } else if ((status = Peek(address, data, size)) != EXECUTE_OK) {
             return (status);
+          }
           SetRegister(reg, data, size);
         } else {
-          if ((status = Poke(address, register_value[reg], size)) != EXECUTE_OK)
+          if (destination != nullptr) {
+            WriteBigEndian(destination, register_value[reg], offset);
+            destination += offset;
+          } else if ((status = Poke(address, register_value[reg], size)) !=
+                     EXECUTE_OK) {
             return (status);
+          }
         }
         address += offset;
-
-        if (trace) {
-          mnemonic += ourRegisterData[reg].name;
-          mnemonic += " ";
-        }
       }
     }
   }
@@ -3542,18 +2728,13 @@ int cpu32::ExecuteMOVEM(int opcode, std::string &trace_record, int trace) {
       SetRegister(A0_INDEX + (opcode & 7), address, LONG);
   }
 
-  if (trace) {
-    mnemonic += "}} ";
-    trace_record += mnemonic;
-  }
   return (EXECUTE_OK);
 }
 
-int cpu32::ExecuteMOVEP(int opcode, std::string &trace_record, int trace) {
+int cpu32::ExecuteMOVEP(int opcode) {
   unsigned long Dn;
   int in_register_flag;
   unsigned long src_address, dest_address;
-  std::string ea_description;
   int status;
 
   // Get the data register we're working with
@@ -3563,9 +2744,9 @@ int cpu32::ExecuteMOVEP(int opcode, std::string &trace_record, int trace) {
   case 4: // WORD from Memory to Register
   {
     // Get the source effective address
-    if ((status = ComputeEffectiveAddress(
-             src_address, in_register_flag, ea_description,
-             (0x28 | (opcode & 0x7)), WORD, trace)) != EXECUTE_OK) {
+    if ((status = ComputeEffectiveAddress(src_address, in_register_flag,
+                                          (0x28 | (opcode & 0x7)), WORD)) !=
+        EXECUTE_OK) {
       return status;
     }
 
@@ -3578,22 +2759,15 @@ int cpu32::ExecuteMOVEP(int opcode, std::string &trace_record, int trace) {
 
     SetRegister(Dn, (b1 << 8) | b0, WORD);
 
-    if (trace) {
-      trace_record += "{Mnemonic {MOVEP.W ";
-      trace_record += ea_description;
-      trace_record += ",D";
-      trace_record += IntToString(Dn, 1);
-      trace_record += "}} ";
-    }
     break;
   }
 
   case 5: // LONG from Memory to Register
   {
     // Get the source effective address
-    if ((status = ComputeEffectiveAddress(
-             src_address, in_register_flag, ea_description,
-             (0x28 | (opcode & 0x7)), LONG, trace)) != EXECUTE_OK) {
+    if ((status = ComputeEffectiveAddress(src_address, in_register_flag,
+                                          (0x28 | (opcode & 0x7)), LONG)) !=
+        EXECUTE_OK) {
       return (status);
     }
 
@@ -3610,22 +2784,15 @@ int cpu32::ExecuteMOVEP(int opcode, std::string &trace_record, int trace) {
 
     SetRegister(Dn, (b3 << 24) | (b2 << 16) | (b1 << 8) | b0, LONG);
 
-    if (trace) {
-      trace_record += "{Mnemonic {MOVEP.L ";
-      trace_record += ea_description;
-      trace_record += ",D";
-      trace_record += IntToString(Dn, 1);
-      trace_record += "}} ";
-    }
     break;
   }
 
   case 6: // WORD from Register to Memory
   {
     // Get the destination address
-    if ((status = ComputeEffectiveAddress(
-             dest_address, in_register_flag, ea_description,
-             (0x28 | (opcode & 0x7)), WORD, trace)) != EXECUTE_OK) {
+    if ((status = ComputeEffectiveAddress(dest_address, in_register_flag,
+                                          (0x28 | (opcode & 0x7)), WORD)) !=
+        EXECUTE_OK) {
       return status;
     }
 
@@ -3636,22 +2803,15 @@ int cpu32::ExecuteMOVEP(int opcode, std::string &trace_record, int trace) {
     if ((status = Poke((dest_address + 2), value, BYTE)) != EXECUTE_OK)
       return status;
 
-    if (trace) {
-      trace_record += "{Mnemonic {MOVEP.W D";
-      trace_record += IntToString(Dn, 1);
-      trace_record += ",";
-      trace_record += ea_description;
-      trace_record += "}} ";
-    }
     break;
   }
 
   case 7: // LONG from Register to Memory
   {
     // Get the destination address
-    if ((status = ComputeEffectiveAddress(
-             dest_address, in_register_flag, ea_description,
-             (0x28 | (opcode & 0x7)), LONG, trace)) != EXECUTE_OK) {
+    if ((status = ComputeEffectiveAddress(dest_address, in_register_flag,
+                                          (0x28 | (opcode & 0x7)), LONG)) !=
+        EXECUTE_OK) {
       return (status);
     }
 
@@ -3666,13 +2826,6 @@ int cpu32::ExecuteMOVEP(int opcode, std::string &trace_record, int trace) {
     if ((status = Poke((dest_address + 6), value, BYTE)) != EXECUTE_OK)
       return status;
 
-    if (trace) {
-      trace_record += "{Mnemonic {MOVEP.L D";
-      trace_record += IntToString(Dn, 1);
-      trace_record += ",";
-      trace_record += ea_description;
-      trace_record += "}} ";
-    }
     break;
   }
   }
@@ -3680,7 +2833,7 @@ int cpu32::ExecuteMOVEP(int opcode, std::string &trace_record, int trace) {
   return EXECUTE_OK;
 }
 
-int cpu32::ExecuteMOVEQ(int opcode, std::string &trace_record, int trace) {
+int cpu32::ExecuteMOVEQ(int opcode) {
   unsigned long register_number;
   unsigned int data;
 
@@ -3693,25 +2846,18 @@ int cpu32::ExecuteMOVEQ(int opcode, std::string &trace_record, int trace) {
   SetConditionCodes(0, 0, data, LONG, OTHER, C_FLAG | V_FLAG | Z_FLAG | N_FLAG);
   SetRegister(register_number, data, LONG);
 
-  if (trace) {
-    trace_record += "{Mnemonic {MOVEQ.L #$";
-    trace_record += IntToString(data, 2);
-    trace_record += ",";
-    trace_record += ourRegisterData[register_number].name;
-    trace_record += "}} ";
-  }
   return (EXECUTE_OK);
 }
 
-int cpu32::ExecuteMOVEfromSR(int opcode, std::string &trace_record, int trace) {
+int cpu32::ExecuteMOVEfromSR(int opcode) {
   int status, in_register;
   unsigned long address;
-  std::string ea_description;
+
+  EvaluateConditionCodes();
 
   // Get the destination data pointer
-  if ((status = ComputeEffectiveAddress(address, in_register, ea_description,
-                                        opcode & 0x3f, WORD, trace)) !=
-      EXECUTE_OK) {
+  if ((status = ComputeEffectiveAddress(address, in_register, opcode & 0x3f,
+                                        WORD)) != EXECUTE_OK) {
     return (status);
   }
 
@@ -3721,26 +2867,18 @@ int cpu32::ExecuteMOVEfromSR(int opcode, std::string &trace_record, int trace) {
            EXECUTE_OK)
     return (status);
 
-  if (trace) {
-    trace_record += "{Mnemonic {MOVE.W SR,";
-    trace_record += ea_description;
-    trace_record += "}} ";
-  }
   return (EXECUTE_OK);
 }
 
-int cpu32::ExecuteMOVEUSP(int opcode, std::string &trace_record, int trace) {
+int cpu32::ExecuteMOVEUSP(int opcode) {
   int status, register_number;
-  std::string ea_description;
 
   // Make sure we're in supervisor mode or trap
   if (!(register_value[SR_INDEX] & S_FLAG)) {
     SetRegister(PC_INDEX, register_value[PC_INDEX] - 2, LONG);
     if ((status = ProcessException(8)) != EXECUTE_OK)
       return (status);
-    if (trace)
-      ;
-    trace_record += "{Mnemonic {Privilege Violation Exception}} ";
+    myExceptionMnemonic = "Privilege Violation Exception";
     return (EXECUTE_PRIVILEGED_OK);
   }
 
@@ -3753,36 +2891,23 @@ int cpu32::ExecuteMOVEUSP(int opcode, std::string &trace_record, int trace) {
   // Move from or to the USP
   if (opcode & 8) {
     SetRegister(register_number, register_value[USP_INDEX], LONG);
-    if (trace) {
-      ea_description = "USP,";
-      ea_description += ourRegisterData[register_number].name;
-    }
   } else {
     SetRegister(USP_INDEX, register_value[register_number], LONG);
-    if (trace) {
-      ea_description = ourRegisterData[register_number].name;
-      ea_description += ",USP";
-    }
   }
 
-  if (trace) {
-    trace_record += "{Mnemonic {MOVE.L ";
-    trace_record += ea_description;
-    trace_record += "}} ";
-  }
   return (EXECUTE_PRIVILEGED_OK);
 }
 
-int cpu32::ExecuteMOVEtoCCR(int opcode, std::string &trace_record, int trace) {
+int cpu32::ExecuteMOVEtoCCR(int opcode) {
   int status, in_register;
   unsigned long address;
   unsigned int data;
-  std::string ea_description;
+
+  EvaluateConditionCodes();
 
   // Get the destination data pointer
-  if ((status = ComputeEffectiveAddress(address, in_register, ea_description,
-                                        opcode & 0x3f, WORD, trace)) !=
-      EXECUTE_OK) {
+  if ((status = ComputeEffectiveAddress(address, in_register, opcode & 0x3f,
+                                        WORD)) != EXECUTE_OK) {
     return (status);
   }
 
@@ -3793,35 +2918,28 @@ int cpu32::ExecuteMOVEtoCCR(int opcode, std::string &trace_record, int trace) {
 
   SetRegister(SR_INDEX, data, BYTE);
 
-  if (trace) {
-    trace_record += "{Mnemonic {MOVE.W ";
-    trace_record += ea_description;
-    trace_record += ",CCR}} ";
-  }
   return (EXECUTE_OK);
 }
 
-int cpu32::ExecuteMOVEtoSR(int opcode, std::string &trace_record, int trace) {
+int cpu32::ExecuteMOVEtoSR(int opcode) {
   int status, in_register;
   unsigned long address;
   unsigned int data;
-  std::string ea_description;
+
+  EvaluateConditionCodes();
 
   // Make sure we're in supervisor mode or trap
   if (!(register_value[SR_INDEX] & S_FLAG)) {
     SetRegister(PC_INDEX, register_value[PC_INDEX] - 2, LONG);
     if ((status = ProcessException(8)) != EXECUTE_OK)
       return (status);
-    if (trace)
-      ;
-    trace_record += "{Mnemonic {Privilege Violation Exception}} ";
+    myExceptionMnemonic = "Privilege Violation Exception";
     return (EXECUTE_PRIVILEGED_OK);
   }
 
   // Get the destination data pointer
-  if ((status = ComputeEffectiveAddress(address, in_register, ea_description,
-                                        opcode & 0x3f, WORD, trace)) !=
-      EXECUTE_OK) {
+  if ((status = ComputeEffectiveAddress(address, in_register, opcode & 0x3f,
+                                        WORD)) != EXECUTE_OK) {
     return (status);
   }
 
@@ -3832,25 +2950,18 @@ int cpu32::ExecuteMOVEtoSR(int opcode, std::string &trace_record, int trace) {
 
   SetRegister(SR_INDEX, data, WORD);
 
-  if (trace) {
-    trace_record += "{Mnemonic {MOVE.W ";
-    trace_record += ea_description;
-    trace_record += ",SR}} ";
-  }
   return (EXECUTE_PRIVILEGED_OK);
 }
 
-int cpu32::ExecuteMULS(int opcode, std::string &trace_record, int trace) {
+int cpu32::ExecuteMULS(int opcode) {
   int status, in_register_flag;
   unsigned long ea_address, register_number;
   unsigned int ea_data;
   int result, data;
-  std::string ea_description;
 
   // Get the <ea> data address
-  if ((status =
-           ComputeEffectiveAddress(ea_address, in_register_flag, ea_description,
-                                   opcode & 0x3f, WORD, trace)) != EXECUTE_OK) {
+  if ((status = ComputeEffectiveAddress(ea_address, in_register_flag,
+                                        opcode & 0x3f, WORD)) != EXECUTE_OK) {
     return (status);
   }
 
@@ -3864,6 +2975,11 @@ int cpu32::ExecuteMULS(int opcode, std::string &trace_record, int trace) {
   register_number = D0_INDEX + ((opcode & 0x0e00) >> 9);
   data = register_value[register_number];
 
+  // Each change between adjacent bits of the multiplier takes two cycles
+  for (unsigned int bits = (ea_data ^ (ea_data << 1)) & 0xffff; bits != 0;
+       bits &= bits - 1)
+    myCycles += 2;
+
   // Sign extend operands
   data = SignExtend(data, WORD);
   ea_data = SignExtend(ea_data, WORD);
@@ -3873,26 +2989,17 @@ int cpu32::ExecuteMULS(int opcode, std::string &trace_record, int trace) {
                     V_FLAG | C_FLAG | Z_FLAG | N_FLAG);
   SetRegister(register_number, result, LONG);
 
-  if (trace) {
-    trace_record += "{Mnemonic {MULS.W ";
-    trace_record += ea_description;
-    trace_record += ",";
-    trace_record += ourRegisterData[register_number].name;
-    trace_record += "}} ";
-  }
   return (EXECUTE_OK);
 }
 
-int cpu32::ExecuteMULU(int opcode, std::string &trace_record, int trace) {
+int cpu32::ExecuteMULU(int opcode) {
   int status, in_register_flag;
   unsigned long ea_address, register_number;
   unsigned int result, ea_data;
-  std::string ea_description;
 
   // Get the <ea> data address
-  if ((status =
-           ComputeEffectiveAddress(ea_address, in_register_flag, ea_description,
-                                   opcode & 0x3f, WORD, trace)) != EXECUTE_OK) {
+  if ((status = ComputeEffectiveAddress(ea_address, in_register_flag,
+                                        opcode & 0x3f, WORD)) != EXECUTE_OK) {
     return (status);
   }
 
@@ -3902,6 +3009,10 @@ int cpu32::ExecuteMULU(int opcode, std::string &trace_record, int trace) {
   else if ((status = Peek(ea_address, ea_data, WORD)) != EXECUTE_OK)
     return (status);
 
+  // Each one bit of the multiplier takes two cycles
+  for (unsigned int bits = ea_data; bits != 0; bits &= bits - 1)
+    myCycles += 2;
+
   // Get the register number
   register_number = D0_INDEX + ((opcode & 0x0e00) >> 9);
 
@@ -3910,23 +3021,15 @@ int cpu32::ExecuteMULU(int opcode, std::string &trace_record, int trace) {
                     V_FLAG | C_FLAG | Z_FLAG | N_FLAG);
   SetRegister(register_number, result, LONG);
 
-  if (trace) {
-    trace_record += "{Mnemonic {MULU.W ";
-    trace_record += ea_description;
-    trace_record += ",";
-    trace_record += ourRegisterData[register_number].name;
-    trace_record += "}} ";
-  }
   return (EXECUTE_OK);
 }
 
-int cpu32::ExecuteMULL(int opcode, std::string &trace_record, int trace) {
+int cpu32::ExecuteMULL(int opcode) {
   // Note: check update of condition codes!
   int status, in_register_flag;
   unsigned long ea_address;
   unsigned int ea_data;
   unsigned int data;
-  std::string ea_description;
   unsigned long address;
   unsigned int opcode2;
   unsigned long l1 = 0, l2 = 0, w3 = 0, w4 = 0;
@@ -3950,9 +3053,8 @@ int cpu32::ExecuteMULL(int opcode, std::string &trace_record, int trace) {
   }
 
   // Get the <ea> data address
-  if ((status =
-           ComputeEffectiveAddress(ea_address, in_register_flag, ea_description,
-                                   opcode & 0x3f, LONG, trace)) != EXECUTE_OK) {
+  if ((status = ComputeEffectiveAddress(ea_address, in_register_flag,
+                                        opcode & 0x3f, LONG)) != EXECUTE_OK) {
     //**CPU_DEBUG_PRINT1(this, "[MULL] Bad <ea_address>", (opcode&0x3F));
     return (status);
   }
@@ -4016,32 +3118,12 @@ int cpu32::ExecuteMULL(int opcode, std::string &trace_record, int trace) {
                         V_FLAG | C_FLAG | Z_FLAG | N_FLAG);
       SetRegister(dh_number, l1, LONG);
       SetRegister(di_number, l2, LONG);
-
-      if (trace) {
-        trace_record += "{Mnemonic {MULS.L ";
-        trace_record += ea_description;
-        trace_record += ",";
-        trace_record += ourRegisterData[dh_number].name;
-        trace_record += ":";
-        trace_record += ourRegisterData[di_number].name;
-        trace_record += "}} ";
-      }
     } else {
       // unsigned
       SetConditionCodes(0, 0, l1, LONG, OTHER,
                         V_FLAG | C_FLAG | Z_FLAG | N_FLAG);
       SetRegister(dh_number, l1, LONG);
       SetRegister(di_number, l2, LONG);
-
-      if (trace) {
-        trace_record += "{Mnemonic {MULU.L ";
-        trace_record += ea_description;
-        trace_record += ",";
-        trace_record += ourRegisterData[dh_number].name;
-        trace_record += ":";
-        trace_record += ourRegisterData[di_number].name;
-        trace_record += "}} ";
-      }
     }
   } else {
     // 32bits
@@ -4052,53 +3134,35 @@ int cpu32::ExecuteMULL(int opcode, std::string &trace_record, int trace) {
       SetConditionCodes(0, 0, l2, LONG, OTHER,
                         V_FLAG | C_FLAG | Z_FLAG | N_FLAG);
       SetRegister(di_number, l2, LONG);
-
-      if (trace) {
-        trace_record += "{Mnemonic {MULS.L ";
-        trace_record += ea_description;
-        trace_record += ",";
-        trace_record += ourRegisterData[di_number].name;
-        trace_record += "}} ";
-      }
     } else {
       // unsigned
       SetConditionCodes(0, 0, l2, LONG, OTHER,
                         V_FLAG | C_FLAG | Z_FLAG | N_FLAG);
       SetRegister(di_number, l2, LONG);
-
-      if (trace) {
-        trace_record += "{Mnemonic {MULU.L ";
-        trace_record += ea_description;
-        trace_record += ",";
-        trace_record += ourRegisterData[di_number].name;
-        trace_record += "}} ";
-      }
     }
   }
   return (EXECUTE_OK);
 }
 
-int cpu32::ExecuteNBCD(int opcode, std::string &trace_record, int trace) {
+int cpu32::ExecuteNBCD(int opcode) {
   // Long Link
   if (((opcode >> 3) & 0x7) == 1) {
-    return ExecuteLINK(opcode, trace_record, trace);
+    return ExecuteLINK(opcode);
   }
 
-  return (ExecuteInvalid(opcode, trace_record, trace));
+  return (ExecuteInvalid(opcode));
 }
 
-int cpu32::ExecuteNEG(int opcode, std::string &trace_record, int trace) {
+int cpu32::ExecuteNEG(int opcode) {
   int status, size, in_register_flag;
   unsigned long address;
   unsigned int data, result;
-  std::string ea_description;
 
   size = ((opcode & 0x00c0) >> 6);
 
   // Get the effective address
-  if ((status =
-           ComputeEffectiveAddress(address, in_register_flag, ea_description,
-                                   opcode & 0x3f, size, trace)) != EXECUTE_OK) {
+  if ((status = ComputeEffectiveAddress(address, in_register_flag,
+                                        opcode & 0x3f, size)) != EXECUTE_OK) {
     return (status);
   }
 
@@ -4119,32 +3183,20 @@ int cpu32::ExecuteNEG(int opcode, std::string &trace_record, int trace) {
   else if ((status = Poke(address, result, size)) != EXECUTE_OK)
     return (status);
 
-  if (trace) {
-    trace_record += "{Mnemonic {NEG";
-    if (size == BYTE)
-      trace_record += ".B ";
-    else if (size == WORD)
-      trace_record += ".W ";
-    else if (size == LONG)
-      trace_record += ".L ";
-    trace_record += ea_description;
-    trace_record += "}} ";
-  }
   return (EXECUTE_OK);
 }
 
-int cpu32::ExecuteNEGX(int opcode, std::string &trace_record, int trace) {
+int cpu32::ExecuteNEGX(int opcode) {
   int status, size, in_register_flag;
   unsigned long address;
   unsigned int data, result;
-  std::string ea_description;
 
+  EvaluateConditionCodes();
   size = ((opcode & 0x00c0) >> 6);
 
   // Get the effective address
-  if ((status =
-           ComputeEffectiveAddress(address, in_register_flag, ea_description,
-                                   opcode & 0x3f, size, trace)) != EXECUTE_OK) {
+  if ((status = ComputeEffectiveAddress(address, in_register_flag,
+                                        opcode & 0x3f, size)) != EXECUTE_OK) {
     return (status);
   }
 
@@ -4161,8 +3213,8 @@ int cpu32::ExecuteNEGX(int opcode, std::string &trace_record, int trace) {
   else
     result = 0 - data;
 
-  SetConditionCodes(data, 0, result, size, SUBTRACTION,
-                    C_FLAG | X_FLAG | V_FLAG | N_FLAG);
+  ComputeConditionCodes(data, 0, result, size, SUBTRACTION,
+                        C_FLAG | X_FLAG | V_FLAG | N_FLAG);
   if (size == BYTE)
     result = result & 0xff;
   else if (size == WORD)
@@ -4179,39 +3231,23 @@ int cpu32::ExecuteNEGX(int opcode, std::string &trace_record, int trace) {
   else if ((status = Poke(address, result, size)) != EXECUTE_OK)
     return (status);
 
-  if (trace) {
-    trace_record += "{Mnemonic {NEGX";
-    if (size == BYTE)
-      trace_record += ".B ";
-    else if (size == WORD)
-      trace_record += ".W ";
-    else if (size == LONG)
-      trace_record += ".L ";
-    trace_record += ea_description;
-    trace_record += "}} ";
-  }
   return (EXECUTE_OK);
 }
 
-int cpu32::ExecuteNOP(int, std::string &trace_record, int trace) {
-  if (trace)
-    trace_record += "{Mnemonic {NOP}}";
-
+int cpu32::ExecuteNOP(int) {
   return (EXECUTE_OK);
 }
 
-int cpu32::ExecuteNOT(int opcode, std::string &trace_record, int trace) {
+int cpu32::ExecuteNOT(int opcode) {
   int status, size, in_register_flag;
   unsigned long address;
   unsigned int data, result;
-  std::string ea_description;
 
   size = ((opcode & 0x00c0) >> 6);
 
   // Get the effective address
-  if ((status =
-           ComputeEffectiveAddress(address, in_register_flag, ea_description,
-                                   opcode & 0x3f, size, trace)) != EXECUTE_OK) {
+  if ((status = ComputeEffectiveAddress(address, in_register_flag,
+                                        opcode & 0x3f, size)) != EXECUTE_OK) {
     return (status);
   }
 
@@ -4231,32 +3267,19 @@ int cpu32::ExecuteNOT(int opcode, std::string &trace_record, int trace) {
   else if ((status = Poke(address, result, size)) != EXECUTE_OK)
     return (status);
 
-  if (trace) {
-    trace_record += "{Mnemonic {NOT";
-    if (size == BYTE)
-      trace_record += ".B ";
-    else if (size == WORD)
-      trace_record += ".W ";
-    else if (size == LONG)
-      trace_record += ".L ";
-    trace_record += ea_description;
-    trace_record += "}} ";
-  }
   return (EXECUTE_OK);
 }
 
-int cpu32::ExecuteOR(int opcode, std::string &trace_record, int trace) {
+int cpu32::ExecuteOR(int opcode) {
   int status, size, in_register_flag;
   unsigned long ea_address, register_number;
   unsigned int result, ea_data;
-  std::string mnemonic, ea_description;
 
   size = (opcode & 0x00c0) >> 6;
 
   // Get the <ea> data address
-  if ((status =
-           ComputeEffectiveAddress(ea_address, in_register_flag, ea_description,
-                                   opcode & 0x3f, size, trace)) != EXECUTE_OK) {
+  if ((status = ComputeEffectiveAddress(ea_address, in_register_flag,
+                                        opcode & 0x3f, size)) != EXECUTE_OK) {
     return (status);
   }
 
@@ -4269,23 +3292,8 @@ int cpu32::ExecuteOR(int opcode, std::string &trace_record, int trace) {
   // Get the register number
   register_number = D0_INDEX + ((opcode & 0x0e00) >> 9);
 
-  if (trace) {
-    mnemonic += "{Mnemonic {OR";
-    if (size == BYTE)
-      mnemonic += ".B ";
-    else if (size == WORD)
-      mnemonic += ".W ";
-    else if (size == LONG)
-      mnemonic += ".L ";
-  }
-
   if (opcode & 0x0100) // <Dn> | <ea> -> <ea>
   {
-    if (trace) {
-      mnemonic += ourRegisterData[register_number].name;
-      mnemonic += ",";
-      mnemonic += ea_description;
-    }
     result = register_value[register_number] | ea_data;
     SetConditionCodes(register_value[register_number], ea_data, result, size,
                       OTHER, V_FLAG | C_FLAG | Z_FLAG | N_FLAG);
@@ -4293,45 +3301,25 @@ int cpu32::ExecuteOR(int opcode, std::string &trace_record, int trace) {
       return (status);
   } else // <ea> | <Dn> -> <Dn>
   {
-    if (trace) {
-      mnemonic += ea_description;
-      mnemonic += ",";
-      mnemonic += ourRegisterData[register_number].name;
-    }
     result = ea_data | register_value[register_number];
     SetConditionCodes(ea_data, register_value[register_number], result, size,
                       OTHER, V_FLAG | C_FLAG | Z_FLAG | N_FLAG);
     SetRegister(register_number, result, size);
   }
 
-  if (trace) {
-    mnemonic += "}} ";
-    trace_record += mnemonic;
-  }
   return (EXECUTE_OK);
 }
 
-int cpu32::ExecuteORI(int opcode, std::string &trace_record, int trace) {
+int cpu32::ExecuteORI(int opcode) {
   int status, size, in_register;
   unsigned long dest_addr, src_addr;
   unsigned int result, src, dest;
-  std::string mnemonic;
 
   size = (opcode & 0x00c0) >> 6;
 
-  if (trace) {
-    mnemonic += "{Mnemonic {ORI";
-    if (size == BYTE)
-      mnemonic += ".B ";
-    else if (size == WORD)
-      mnemonic += ".W ";
-    else if (size == LONG)
-      mnemonic += ".L ";
-  }
-
   // Get the immediate data pointer
-  if ((status = ComputeEffectiveAddress(src_addr, in_register, mnemonic, 0x3c,
-                                        size, trace)) != EXECUTE_OK) {
+  if ((status = ComputeEffectiveAddress(src_addr, in_register, 0x3c, size)) !=
+      EXECUTE_OK) {
     return (status);
   }
 
@@ -4339,13 +3327,9 @@ int cpu32::ExecuteORI(int opcode, std::string &trace_record, int trace) {
   if ((status = Peek(src_addr, src, size)) != EXECUTE_OK)
     return (status);
 
-  if (trace)
-    mnemonic += ",";
-
   // Get the destination data pointer
-  if ((status = ComputeEffectiveAddress(dest_addr, in_register, mnemonic,
-                                        opcode & 0x3f, size, trace)) !=
-      EXECUTE_OK) {
+  if ((status = ComputeEffectiveAddress(dest_addr, in_register, opcode & 0x3f,
+                                        size)) != EXECUTE_OK) {
     return (status);
   }
 
@@ -4365,25 +3349,19 @@ int cpu32::ExecuteORI(int opcode, std::string &trace_record, int trace) {
       return (status);
   }
 
-  if (trace) {
-    mnemonic += "}} ";
-    trace_record += mnemonic;
-  }
   return (EXECUTE_OK);
 }
 
-int cpu32::ExecuteORItoCCR(int, std::string &trace_record, int trace) {
+int cpu32::ExecuteORItoCCR(int) {
   int status, in_register_flag;
   unsigned long src_addr;
   unsigned int src;
-  std::string mnemonic;
 
-  if (trace)
-    mnemonic += "{Mnemonic {ORI.B ";
+  EvaluateConditionCodes();
 
   // Get the immediate data pointer
-  if ((status = ComputeEffectiveAddress(src_addr, in_register_flag, mnemonic,
-                                        0x3c, BYTE, trace)) != EXECUTE_OK) {
+  if ((status = ComputeEffectiveAddress(src_addr, in_register_flag, 0x3c,
+                                        BYTE)) != EXECUTE_OK) {
     return (status);
   }
 
@@ -4392,36 +3370,28 @@ int cpu32::ExecuteORItoCCR(int, std::string &trace_record, int trace) {
     return (status);
 
   SetRegister(SR_INDEX, register_value[SR_INDEX] | src, BYTE);
-  if (trace) {
-    mnemonic += ",CCR}} ";
-    trace_record += mnemonic;
-  }
   return (EXECUTE_OK);
 }
 
-int cpu32::ExecuteORItoSR(int, std::string &trace_record, int trace) {
+int cpu32::ExecuteORItoSR(int) {
   int status, in_register_flag;
   unsigned long src_addr;
   unsigned int src;
-  std::string mnemonic;
+
+  EvaluateConditionCodes();
 
   // Make sure we're in supervisor mode or trap
   if (!(register_value[SR_INDEX] & S_FLAG)) {
     SetRegister(PC_INDEX, register_value[PC_INDEX] - 2, LONG);
     if ((status = ProcessException(8)) != EXECUTE_OK)
       return (status);
-    if (trace)
-      ;
-    trace_record += "{Mnemonic {Privilege Violation Exception}} ";
+    myExceptionMnemonic = "Privilege Violation Exception";
     return (EXECUTE_PRIVILEGED_OK);
   }
 
-  if (trace)
-    mnemonic += "{Mnemonic {ORI.W ";
-
   // Get the immediate data pointer
-  if ((status = ComputeEffectiveAddress(src_addr, in_register_flag, mnemonic,
-                                        0x3c, WORD, trace)) != EXECUTE_OK) {
+  if ((status = ComputeEffectiveAddress(src_addr, in_register_flag, 0x3c,
+                                        WORD)) != EXECUTE_OK) {
     return (status);
   }
 
@@ -4431,22 +3401,16 @@ int cpu32::ExecuteORItoSR(int, std::string &trace_record, int trace) {
 
   SetRegister(SR_INDEX, register_value[SR_INDEX] | src, WORD);
 
-  if (trace) {
-    mnemonic += ",SR}} ";
-    trace_record += mnemonic;
-  }
   return (EXECUTE_PRIVILEGED_OK);
 }
 
-int cpu32::ExecutePEA(int opcode, std::string &trace_record, int trace) {
+int cpu32::ExecutePEA(int opcode) {
   int status, in_register_flag, stack_index;
   unsigned long address;
-  std::string ea_description;
 
   // Get the effective address
-  if ((status =
-           ComputeEffectiveAddress(address, in_register_flag, ea_description,
-                                   opcode & 0x3f, LONG, trace)) != EXECUTE_OK) {
+  if ((status = ComputeEffectiveAddress(address, in_register_flag,
+                                        opcode & 0x3f, LONG)) != EXECUTE_OK) {
     return (status);
   }
 
@@ -4461,15 +3425,10 @@ int cpu32::ExecutePEA(int opcode, std::string &trace_record, int trace) {
   if ((status = Poke(register_value[stack_index], address, LONG)) != EXECUTE_OK)
     return (status);
 
-  if (trace) {
-    trace_record += "{Mnemonic {PEA.L ";
-    trace_record += ea_description;
-    trace_record += "}} ";
-  }
   return (EXECUTE_OK);
 }
 
-int cpu32::ExecuteRESET(int, std::string &trace_record, int trace) {
+int cpu32::ExecuteRESET(int) {
   int status;
 
   // Make sure we're in supervisor mode or trap
@@ -4477,27 +3436,22 @@ int cpu32::ExecuteRESET(int, std::string &trace_record, int trace) {
     SetRegister(PC_INDEX, register_value[PC_INDEX] - 2, LONG);
     if ((status = ProcessException(8)) != EXECUTE_OK)
       return (status);
-    if (trace)
-      ;
-    trace_record += "{Mnemonic {Privilege Violation Exception}} ";
+    myExceptionMnemonic = "Privilege Violation Exception";
     return (EXECUTE_PRIVILEGED_OK);
   }
 
   // Tell the AddressSpace to reset all of the attached devices
   myAddressSpaces[0]->Reset();
 
-  if (trace)
-    trace_record += "{Mnemonic {RESET}} ";
-
   return (EXECUTE_PRIVILEGED_OK);
 }
 
-int cpu32::ExecuteROL(int opcode, std::string &trace_record, int trace) {
+int cpu32::ExecuteROL(int opcode) {
   int status, size, in_register_flag, shift_count;
   unsigned long address;
   unsigned int data;
-  std::string ea_description;
 
+  EvaluateConditionCodes();
   size = (opcode & 0x00c0) >> 6;
 
   // Check to see if this is a memory or register rotate
@@ -4506,8 +3460,7 @@ int cpu32::ExecuteROL(int opcode, std::string &trace_record, int trace) {
 
     // Get the address
     if ((status = ComputeEffectiveAddress(address, in_register_flag,
-                                          ea_description, opcode & 0x3f, size,
-                                          trace)) != EXECUTE_OK) {
+                                          opcode & 0x3f, size)) != EXECUTE_OK) {
       return (status);
     }
 
@@ -4525,31 +3478,19 @@ int cpu32::ExecuteROL(int opcode, std::string &trace_record, int trace) {
     if ((status = Poke(address, data, size)) != EXECUTE_OK)
       return (status);
 
-    SetConditionCodes(0, 0, data, size, OTHER,
-                      N_FLAG | Z_FLAG | C_FLAG | V_FLAG);
+    ComputeConditionCodes(0, 0, data, size, OTHER,
+                          N_FLAG | Z_FLAG | C_FLAG | V_FLAG);
     if (data & 0x0001)
       register_value[SR_INDEX] |= C_FLAG;
   } else {
     // Compute the shift count
     if (opcode & 32) {
       shift_count = register_value[D0_INDEX + ((opcode & 0x0e00) >> 9)] & 0x3f;
-      if (trace)
-        ea_description =
-            ourRegisterData[D0_INDEX + ((opcode & 0x0e00) >> 9)].name;
     } else {
       if ((shift_count = (opcode & 0x0e00) >> 9) == 0)
         shift_count = 8;
-
-      if (trace) {
-        ea_description = "#$";
-        ea_description += IntToString(shift_count, 1);
-      }
-    }
-
-    if (trace) {
-      ea_description += ",";
-      ea_description += ourRegisterData[D0_INDEX + (opcode & 7)].name;
     }
+    myCycles += 2 * shift_count;
 
     unsigned int msb;
 
@@ -4572,32 +3513,21 @@ int cpu32::ExecuteROL(int opcode, std::string &trace_record, int trace) {
 
     SetRegister(D0_INDEX + (opcode & 7), data, size);
 
-    SetConditionCodes(0, 0, data, size, OTHER,
-                      N_FLAG | Z_FLAG | C_FLAG | V_FLAG);
+    ComputeConditionCodes(0, 0, data, size, OTHER,
+                          N_FLAG | Z_FLAG | C_FLAG | V_FLAG);
     if (data & 1)
       register_value[SR_INDEX] |= C_FLAG;
   }
 
-  if (trace) {
-    trace_record += "{Mnemonic {ROL";
-    if (size == BYTE)
-      trace_record += ".B ";
-    else if (size == WORD)
-      trace_record += ".W ";
-    else if (size == LONG)
-      trace_record += ".L ";
-    trace_record += ea_description;
-    trace_record += "}} ";
-  }
   return (EXECUTE_OK);
 }
 
-int cpu32::ExecuteROR(int opcode, std::string &trace_record, int trace) {
+int cpu32::ExecuteROR(int opcode) {
   int status, size, in_register_flag, shift_count;
   unsigned long address;
   unsigned int data;
-  std::string ea_description;
 
+  EvaluateConditionCodes();
   size = (opcode & 0x00c0) >> 6;
 
   // Check to see if this is a memory or register rotate
@@ -4606,8 +3536,7 @@ int cpu32::ExecuteROR(int opcode, std::string &trace_record, int trace) {
 
     // Get the address
     if ((status = ComputeEffectiveAddress(address, in_register_flag,
-                                          ea_description, opcode & 0x3f, size,
-                                          trace)) != EXECUTE_OK) {
+                                          opcode & 0x3f, size)) != EXECUTE_OK) {
       return (status);
     }
 
@@ -4626,31 +3555,19 @@ int cpu32::ExecuteROR(int opcode, std::string &trace_record, int trace) {
       return (status);
 
     // Set the condition codes
-    SetConditionCodes(0, 0, data, size, OTHER,
-                      N_FLAG | Z_FLAG | C_FLAG | V_FLAG);
+    ComputeConditionCodes(0, 0, data, size, OTHER,
+                          N_FLAG | Z_FLAG | C_FLAG | V_FLAG);
     if (data & 0x8000)
       register_value[SR_INDEX] |= C_FLAG;
   } else {
     // Compute the shift count
     if (opcode & 32) {
       shift_count = register_value[D0_INDEX + ((opcode & 0x0e00) >> 9)] & 0x3f;
-      if (trace)
-        ea_description =
-            ourRegisterData[D0_INDEX + ((opcode & 0x0e00) >> 9)].name;
     } else {
       if ((shift_count = (opcode & 0x0e00) >> 9) == 0)
         shift_count = 8;
-
-      if (trace) {
-        ea_description = "#$";
-        ea_description += IntToString(shift_count, 1);
-      }
-    }
-
-    if (trace) {
-      ea_description += ",";
-      ea_description += ourRegisterData[D0_INDEX + (opcode & 7)].name;
     }
+    myCycles += 2 * shift_count;
 
     unsigned int msb;
 
@@ -4673,32 +3590,21 @@ int cpu32::ExecuteROR(int opcode, std::string &trace_record, int trace) {
 
     SetRegister(D0_INDEX + (opcode & 7), data, size);
 
-    SetConditionCodes(0, 0, data, size, OTHER,
-                      N_FLAG | Z_FLAG | C_FLAG | V_FLAG);
+    ComputeConditionCodes(0, 0, data, size, OTHER,
+                          N_FLAG | Z_FLAG | C_FLAG | V_FLAG);
     if (data & msb)
       register_value[SR_INDEX] |= C_FLAG;
   }
 
-  if (trace) {
-    trace_record += "{Mnemonic {ROR";
-    if (size == BYTE)
-      trace_record += ".B ";
-    else if (size == WORD)
-      trace_record += ".W ";
-    else if (size == LONG)
-      trace_record += ".L ";
-    trace_record += ea_description;
-    trace_record += "}} ";
-  }
   return (EXECUTE_OK);
 }
 
-int cpu32::ExecuteROXL(int opcode, std::string &trace_record, int trace) {
+int cpu32::ExecuteROXL(int opcode) {
   int status, size, in_register_flag, shift_count;
   unsigned long address;
   unsigned int data;
-  std::string ea_description;
 
+  EvaluateConditionCodes();
   size = (opcode & 0x00c0) >> 6;
 
   // Check to see if this is a memory or register rotate
@@ -4707,8 +3613,7 @@ int cpu32::ExecuteROXL(int opcode, std::string &trace_record, int trace) {
 
     // Get the address
     if ((status = ComputeEffectiveAddress(address, in_register_flag,
-                                          ea_description, opcode & 0x3f, size,
-                                          trace)) != EXECUTE_OK) {
+                                          opcode & 0x3f, size)) != EXECUTE_OK) {
       return (status);
     }
 
@@ -4726,8 +3631,8 @@ int cpu32::ExecuteROXL(int opcode, std::string &trace_record, int trace) {
     if ((status = Poke(address, data, size)) != EXECUTE_OK)
       return (status);
 
-    SetConditionCodes(0, 0, data, size, OTHER,
-                      N_FLAG | Z_FLAG | C_FLAG | X_FLAG | V_FLAG);
+    ComputeConditionCodes(0, 0, data, size, OTHER,
+                          N_FLAG | Z_FLAG | C_FLAG | X_FLAG | V_FLAG);
     if (data & 0x00010000) {
       register_value[SR_INDEX] |= C_FLAG;
       register_value[SR_INDEX] |= X_FLAG;
@@ -4736,23 +3641,11 @@ int cpu32::ExecuteROXL(int opcode, std::string &trace_record, int trace) {
     // Compute the shift count
     if (opcode & 32) {
       shift_count = register_value[D0_INDEX + ((opcode & 0x0e00) >> 9)] & 0x3f;
-      if (trace)
-        ea_description =
-            ourRegisterData[D0_INDEX + ((opcode & 0x0e00) >> 9)].name;
     } else {
       if ((shift_count = (opcode & 0x0e00) >> 9) == 0)
         shift_count = 8;
-
-      if (trace) {
-        ea_description = "#$";
-        ea_description += IntToString(shift_count, 1);
-      }
-    }
-
-    if (trace) {
-      ea_description += ",";
-      ea_description += ourRegisterData[D0_INDEX + (opcode & 7)].name;
     }
+    myCycles += 2 * shift_count;
 
     unsigned int msb, extend;
 
@@ -4781,34 +3674,23 @@ int cpu32::ExecuteROXL(int opcode, std::string &trace_record, int trace) {
 
     SetRegister(D0_INDEX + (opcode & 7), data, size);
 
-    SetConditionCodes(0, 0, data, size, OTHER,
-                      N_FLAG | Z_FLAG | X_FLAG | C_FLAG | V_FLAG);
+    ComputeConditionCodes(0, 0, data, size, OTHER,
+                          N_FLAG | Z_FLAG | X_FLAG | C_FLAG | V_FLAG);
     if (extend) {
       register_value[SR_INDEX] |= C_FLAG;
       register_value[SR_INDEX] |= X_FLAG;
     }
   }
 
-  if (trace) {
-    trace_record += "{Mnemonic {ROXL";
-    if (size == BYTE)
-      trace_record += ".B ";
-    else if (size == WORD)
-      trace_record += ".W ";
-    else if (size == LONG)
-      trace_record += ".L ";
-    trace_record += ea_description;
-    trace_record += "}} ";
-  }
   return (EXECUTE_OK);
 }
 
-int cpu32::ExecuteROXR(int opcode, std::string &trace_record, int trace) {
+int cpu32::ExecuteROXR(int opcode) {
   int status, size, in_register_flag, shift_count;
   unsigned long address;
   unsigned int data;
-  std::string ea_description;
 
+  EvaluateConditionCodes();
   size = (opcode & 0x00c0) >> 6;
 
   // Check to see if this is a memory or register rotate
@@ -4817,8 +3699,7 @@ int cpu32::ExecuteROXR(int opcode, std::string &trace_record, int trace) {
 
     // Get the address
     if ((status = ComputeEffectiveAddress(address, in_register_flag,
-                                          ea_description, opcode & 0x3f, size,
-                                          trace)) != EXECUTE_OK) {
+                                          opcode & 0x3f, size)) != EXECUTE_OK) {
       return (status);
     }
 
@@ -4840,8 +3721,8 @@ int cpu32::ExecuteROXR(int opcode, std::string &trace_record, int trace) {
       return (status);
 
     // Set the condition codes
-    SetConditionCodes(0, 0, data, size, OTHER,
-                      N_FLAG | Z_FLAG | X_FLAG | C_FLAG | V_FLAG);
+    ComputeConditionCodes(0, 0, data, size, OTHER,
+                          N_FLAG | Z_FLAG | X_FLAG | C_FLAG | V_FLAG);
     if (carry) {
       register_value[SR_INDEX] |= C_FLAG;
       register_value[SR_INDEX] |= X_FLAG;
@@ -4850,23 +3731,11 @@ int cpu32::ExecuteROXR(int opcode, std::string &trace_record, int trace) {
     // Compute the shift count
     if (opcode & 32) {
       shift_count = register_value[D0_INDEX + ((opcode & 0x0e00) >> 9)] & 0x3f;
-      if (trace)
-        ea_description =
-            ourRegisterData[D0_INDEX + ((opcode & 0x0e00) >> 9)].name;
     } else {
       if ((shift_count = (opcode & 0x0e00) >> 9) == 0)
         shift_count = 8;
-
-      if (trace) {
-        ea_description = "#$";
-        ea_description += IntToString(shift_count, 1);
-      }
-    }
-
-    if (trace) {
-      ea_description += ",";
-      ea_description += ourRegisterData[D0_INDEX + (opcode & 7)].name;
     }
+    myCycles += 2 * shift_count;
 
     unsigned int msb, extend;
 
@@ -4894,41 +3763,30 @@ int cpu32::ExecuteROXR(int opcode, std::string &trace_record, int trace) {
 
     SetRegister(D0_INDEX + (opcode & 7), data, size);
 
-    SetConditionCodes(0, 0, data, size, OTHER,
-                      N_FLAG | Z_FLAG | X_FLAG | C_FLAG | V_FLAG);
+    ComputeConditionCodes(0, 0, data, size, OTHER,
+                          N_FLAG | Z_FLAG | X_FLAG | C_FLAG | V_FLAG);
     if (extend) {
       register_value[SR_INDEX] |= C_FLAG;
       register_value[SR_INDEX] |= X_FLAG;
     }
   }
 
-  if (trace) {
-    trace_record += "{Mnemonic {ROXR";
-    if (size == BYTE)
-      trace_record += ".B ";
-    else if (size == WORD)
-      trace_record += ".W ";
-    else if (size == LONG)
-      trace_record += ".L ";
-    trace_record += ea_description;
-    trace_record += "}} ";
-  }
   return (EXECUTE_OK);
 }
 
-int cpu32::ExecuteRTE(int, std::string &trace_record, int trace) {
+int cpu32::ExecuteRTE(int) {
   int status;
   unsigned int sr, pc;
   unsigned int offset;
 
+  EvaluateConditionCodes();
+
   // Make sure we're in supervisor mode or trap
   if (!(register_value[SR_INDEX] & S_FLAG)) {
     SetRegister(PC_INDEX, register_value[PC_INDEX] - 2, LONG);
     if ((status = ProcessException(8)) != EXECUTE_OK)
       return (status);
-    if (trace)
-      ;
-    trace_record += "{Mnemonic {Privilege Violation Exception}} ";
+    myExceptionMnemonic = "Privilege Violation Exception";
     return (EXECUTE_PRIVILEGED_OK);
   }
 
@@ -4953,13 +3811,10 @@ int cpu32::ExecuteRTE(int, std::string &trace_record, int trace) {
   // should I consider the format of the offset (bit 12-15) ?
   SetRegister(SSP_INDEX, register_value[SSP_INDEX] + 2, LONG);
 
-  if (trace)
-    trace_record += "{Mnemonic {RTE}} ";
-
   return (EXECUTE_PRIVILEGED_OK);
 }
 
-int cpu32::ExecuteRTD(int opcode, std::string &trace_record, int trace) {
+int cpu32::ExecuteRTD(int opcode) {
   // Return And Deallocate
   int status;
   unsigned int pc;
@@ -4991,20 +3846,16 @@ int cpu32::ExecuteRTD(int opcode, std::string &trace_record, int trace) {
               LONG);
   SetRegister(PC_INDEX, pc, LONG);
 
-  if (trace) {
-    trace_record += "{Mnemonic {RTD #";
-    trace_record += IntToString(extend_word, 4);
-    trace_record += "}} ";
-  }
-
   return (EXECUTE_OK);
 }
 
-int cpu32::ExecuteRTR(int, std::string &trace_record, int trace) {
+int cpu32::ExecuteRTR(int) {
   int status;
   unsigned int ccr, pc;
   int stackRegister;
 
+  EvaluateConditionCodes();
+
   // Determine which stack pointer to use
   if (register_value[SR_INDEX] & S_FLAG)
     stackRegister = SSP_INDEX;
@@ -5025,13 +3876,10 @@ int cpu32::ExecuteRTR(int, std::string &trace_record, int trace) {
   SetRegister(stackRegister, register_value[stackRegister] + 4, LONG);
   SetRegister(PC_INDEX, pc, LONG);
 
-  if (trace)
-    trace_record += "{Mnemonic {RTR}} ";
-
   return (EXECUTE_OK);
 }
 
-int cpu32::ExecuteRTS(int, std::string &trace_record, int trace) {
+int cpu32::ExecuteRTS(int) {
   int status;
   unsigned int pc;
   int stackRegister;
@@ -5049,20 +3897,18 @@ int cpu32::ExecuteRTS(int, std::string &trace_record, int trace) {
   SetRegister(stackRegister, register_value[stackRegister] + 4, LONG);
   SetRegister(PC_INDEX, pc, LONG);
 
-  if (trace)
-    trace_record += "{Mnemonic {RTS}} ";
-
   return (EXECUTE_OK);
 }
 
-int cpu32::ExecuteSBCD(int opcode, std::string &trace_record, int trace) {
-  return (ExecuteInvalid(opcode, trace_record, trace));
+int cpu32::ExecuteSBCD(int opcode) {
+  return (ExecuteInvalid(opcode));
 }
 
-int cpu32::ExecuteSTOP(int, std::string &trace_record, int trace) {
+int cpu32::ExecuteSTOP(int) {
   unsigned int newStatusRegister;
   int status;
-  std::string mnemonic;
+
+  EvaluateConditionCodes();
 
   // Fetch the 16-bit immediate data
   status = Peek(register_value[PC_INDEX], newStatusRegister, WORD);
@@ -5079,46 +3925,35 @@ int cpu32::ExecuteSTOP(int, std::string &trace_record, int trace) {
   if (!(register_value[SR_INDEX] & S_FLAG)) {
     if ((status = ProcessException(8)) != EXECUTE_OK)
       return (status);
-    if (trace)
-      trace_record += "{Mnemonic {Privilege Violation Exception}} ";
+    myExceptionMnemonic = "Privilege Violation Exception";
     return (EXECUTE_PRIVILEGED_OK);
   }
 
   // Stop the processor
   myState = STOP_STATE;
 
-  if (trace) {
-    trace_record += "{Mnemonic {STOP #$";
-    trace_record += IntToString(newStatusRegister, 4);
-    trace_record += "}} ";
-  }
   return (EXECUTE_PRIVILEGED_OK);
 }
 
-int cpu32::ExecuteBREAK(int, std::string &trace_record, int trace) {
+int cpu32::ExecuteBREAK(int) {
 
   // Put the processor in our "fake" break state so the simulator will
   // stop running a program.
   myState = BREAK_STATE;
 
-  if (trace)
-    trace_record += "{Mnemonic {BREAK}} ";
-
   return (EXECUTE_OK);
 }
 
-int cpu32::ExecuteSUB(int opcode, std::string &trace_record, int trace) {
+int cpu32::ExecuteSUB(int opcode) {
   int status, size, in_register_flag;
   unsigned long ea_address, register_number;
   unsigned int result, ea_data;
-  std::string mnemonic, ea_description;
 
   size = (opcode & 0x00c0) >> 6;
 
   // Get the <ea> data address
-  if ((status =
-           ComputeEffectiveAddress(ea_address, in_register_flag, ea_description,
-                                   opcode & 0x3f, size, trace)) != EXECUTE_OK) {
+  if ((status = ComputeEffectiveAddress(ea_address, in_register_flag,
+                                        opcode & 0x3f, size)) != EXECUTE_OK) {
     return (status);
   }
 
@@ -5131,23 +3966,8 @@ int cpu32::ExecuteSUB(int opcode, std::string &trace_record, int trace) {
   // Get the register number
   register_number = D0_INDEX + ((opcode & 0x0e00) >> 9);
 
-  if (trace) {
-    mnemonic += "{Mnemonic {SUB";
-    if (size == BYTE)
-      mnemonic += ".B ";
-    else if (size == WORD)
-      mnemonic += ".W ";
-    else if (size == LONG)
-      mnemonic += ".L ";
-  }
-
   if (opcode & 0x0100) // <ea> - <Dn> -> <ea>
   {
-    if (trace) {
-      mnemonic += ourRegisterData[register_number].name;
-      mnemonic += ",";
-      mnemonic += ea_description;
-    }
     result = ea_data - register_value[register_number];
     SetConditionCodes(register_value[register_number], ea_data, result, size,
                       SUBTRACTION, C_FLAG | V_FLAG | Z_FLAG | N_FLAG | X_FLAG);
@@ -5155,29 +3975,19 @@ int cpu32::ExecuteSUB(int opcode, std::string &trace_record, int trace) {
       return (status);
   } else // <Dn> - <ea> -> <Dn>
   {
-    if (trace) {
-      mnemonic += ea_description;
-      mnemonic += ",";
-      mnemonic += ourRegisterData[register_number].name;
-    }
     result = register_value[register_number] - ea_data;
     SetConditionCodes(ea_data, register_value[register_number], result, size,
                       SUBTRACTION, C_FLAG | V_FLAG | Z_FLAG | N_FLAG | X_FLAG);
     SetRegister(register_number, result, size);
   }
 
-  if (trace) {
-    mnemonic += "}} ";
-    trace_record += mnemonic;
-  }
   return (EXECUTE_OK);
 }
 
-int cpu32::ExecuteSUBA(int opcode, std::string &trace_record, int trace) {
+int cpu32::ExecuteSUBA(int opcode) {
   int status, size, in_register_flag;
   unsigned long ea_address, register_number;
   unsigned int result, ea_data;
-  std::string ea_description;
 
   if (opcode & 0x0100)
     size = LONG;
@@ -5185,9 +3995,8 @@ int cpu32::ExecuteSUBA(int opcode, std::string &trace_record, int trace) {
     size = WORD;
 
   // Get the <ea> data address
-  if ((status =
-           ComputeEffectiveAddress(ea_address, in_register_flag, ea_description,
-                                   opcode & 0x3f, size, trace)) != EXECUTE_OK) {
+  if ((status = ComputeEffectiveAddress(ea_address, in_register_flag,
+                                        opcode & 0x3f, size)) != EXECUTE_OK) {
     return (status);
   }
 
@@ -5209,41 +4018,19 @@ int cpu32::ExecuteSUBA(int opcode, std::string &trace_record, int trace) {
   result = register_value[register_number] - ea_data;
   SetRegister(register_number, result, LONG);
 
-  if (trace) {
-    trace_record += "{Mnemonic {SUBA";
-    if (size == WORD)
-      trace_record += ".W ";
-    else if (size == LONG)
-      trace_record += ".L ";
-    trace_record += ea_description;
-    trace_record += ",";
-    trace_record += ourRegisterData[register_number].name;
-    trace_record += "}} ";
-  }
   return (EXECUTE_OK);
 }
 
-int cpu32::ExecuteSUBI(int opcode, std::string &trace_record, int trace) {
+int cpu32::ExecuteSUBI(int opcode) {
   int status, size, in_register;
   unsigned long dest_addr, src_addr;
   unsigned int result, src, dest;
-  std::string mnemonic;
 
   size = (opcode & 0x00c0) >> 6;
 
-  if (trace) {
-    mnemonic += "{Mnemonic {SUBI";
-    if (size == BYTE)
-      mnemonic += ".B ";
-    else if (size == WORD)
-      mnemonic += ".W ";
-    else if (size == LONG)
-      mnemonic += ".L ";
-  }
-
   // Get the immediate data pointer
-  if ((status = ComputeEffectiveAddress(src_addr, in_register, mnemonic, 0x3c,
-                                        size, trace)) != EXECUTE_OK) {
+  if ((status = ComputeEffectiveAddress(src_addr, in_register, 0x3c, size)) !=
+      EXECUTE_OK) {
     return (status);
   }
 
@@ -5251,13 +4038,9 @@ int cpu32::ExecuteSUBI(int opcode, std::string &trace_record, int trace) {
   if ((status = Peek(src_addr, src, size)) != EXECUTE_OK)
     return (status);
 
-  if (trace)
-    mnemonic += ",";
-
   // Get the destination data pointer
-  if ((status = ComputeEffectiveAddress(dest_addr, in_register, mnemonic,
-                                        opcode & 0x3f, size, trace)) !=
-      EXECUTE_OK) {
+  if ((status = ComputeEffectiveAddress(dest_addr, in_register, opcode & 0x3f,
+                                        size)) != EXECUTE_OK) {
     return (status);
   }
 
@@ -5277,18 +4060,13 @@ int cpu32::ExecuteSUBI(int opcode, std::string &trace_record, int trace) {
       return (status);
   }
 
-  if (trace) {
-    mnemonic += "}} ";
-    trace_record += mnemonic;
-  }
   return (EXECUTE_OK);
 }
 
-int cpu32::ExecuteSUBQ(int opcode, std::string &trace_record, int trace) {
+int cpu32::ExecuteSUBQ(int opcode) {
   int status, size, in_register_flag;
   unsigned long ea_address, immediate_data;
   unsigned int result, ea_data;
-  std::string ea_description;
 
   size = (opcode & 0x00c0) >> 6;
 
@@ -5297,9 +4075,8 @@ int cpu32::ExecuteSUBQ(int opcode, std::string &trace_record, int trace) {
     immediate_data = 8;
 
   // Get the <ea> data address
-  if ((status =
-           ComputeEffectiveAddress(ea_address, in_register_flag, ea_description,
-                                   opcode & 0x3f, size, trace)) != EXECUTE_OK) {
+  if ((status = ComputeEffectiveAddress(ea_address, in_register_flag,
+                                        opcode & 0x3f, size)) != EXECUTE_OK) {
     return (status);
   }
 
@@ -5326,55 +4103,28 @@ int cpu32::ExecuteSUBQ(int opcode, std::string &trace_record, int trace) {
       return (status);
   }
 
-  if (trace) {
-    trace_record += "{Mnemonic {SUBQ";
-    if (size == BYTE)
-      trace_record += ".B ";
-    else if (size == WORD)
-      trace_record += ".W ";
-    else if (size == LONG)
-      trace_record += ".L ";
-    trace_record += "#$";
-    trace_record += IntToString(immediate_data, 1);
-    trace_record += ",";
-    trace_record += ea_description;
-    trace_record += "}} ";
-  }
   return (EXECUTE_OK);
 }
 
-int cpu32::ExecuteSUBX(int opcode, std::string &trace_record, int trace) {
+int cpu32::ExecuteSUBX(int opcode) {
   int status, size, in_register_flag;
   unsigned long src_address, dest_address;
   unsigned int result, src, dest;
-  std::string mnemonic;
 
+  EvaluateConditionCodes();
   size = (opcode & 0x00c0) >> 6;
 
-  if (trace) {
-    mnemonic += "{Mnemonic {SUBX";
-    if (size == BYTE)
-      mnemonic += ".B ";
-    else if (size == WORD)
-      mnemonic += ".W ";
-    else if (size == LONG)
-      mnemonic += ".L ";
-  }
-
   // Get the addresses
   if (opcode & 8) {
     if ((status = ComputeEffectiveAddress(src_address, in_register_flag,
-                                          mnemonic, 0x20 | (opcode & 7), size,
-                                          trace)) != EXECUTE_OK) {
+                                          0x20 | (opcode & 7), size)) !=
+        EXECUTE_OK) {
       return (status);
     }
 
-    if (trace)
-      mnemonic += ",";
-
-    if ((status = ComputeEffectiveAddress(
-             dest_address, in_register_flag, mnemonic,
-             0x20 | ((opcode & 0x0e00) >> 9), size, trace)) != EXECUTE_OK) {
+    if ((status = ComputeEffectiveAddress(dest_address, in_register_flag,
+                                          0x20 | ((opcode & 0x0e00) >> 9),
+                                          size)) != EXECUTE_OK) {
       return (status);
     }
 
@@ -5387,11 +4137,6 @@ int cpu32::ExecuteSUBX(int opcode, std::string &trace_record, int trace) {
     src = register_value[src_address];
     dest_address = D0_INDEX + ((opcode & 0x0e00) >> 9);
     dest = register_value[dest_address];
-    if (trace) {
-      mnemonic += ourRegisterData[src_address].name;
-      mnemonic += ",";
-      mnemonic += ourRegisterData[dest_address].name;
-    }
   }
 
   if (register_value[SR_INDEX] & X_FLAG)
@@ -5406,8 +4151,8 @@ int cpu32::ExecuteSUBX(int opcode, std::string &trace_record, int trace) {
   else if (size == LONG)
     result = result & 0xffffffff;
 
-  SetConditionCodes(src, dest, result, size, SUBTRACTION,
-                    C_FLAG | V_FLAG | N_FLAG | X_FLAG);
+  ComputeConditionCodes(src, dest, result, size, SUBTRACTION,
+                        C_FLAG | V_FLAG | N_FLAG | X_FLAG);
   if (result)
     register_value[SR_INDEX] &= ~Z_FLAG;
 
@@ -5418,14 +4163,10 @@ int cpu32::ExecuteSUBX(int opcode, std::string &trace_record, int trace) {
     SetRegister(dest_address, result, size);
   }
 
-  if (trace) {
-    mnemonic += "}} ";
-    trace_record += mnemonic;
-  }
   return (EXECUTE_OK);
 }
 
-int cpu32::ExecuteSWAP(int opcode, std::string &trace_record, int trace) {
+int cpu32::ExecuteSWAP(int opcode) {
   int register_number;
   unsigned int data;
 
@@ -5434,61 +4175,46 @@ int cpu32::ExecuteSWAP(int opcode, std::string &trace_record, int trace) {
   data = ((data >> 16) & 0xffff) | ((data << 16) & 0xffff0000);
   SetRegister(register_number, data, LONG);
   SetConditionCodes(0, 0, data, LONG, OTHER, C_FLAG | V_FLAG | Z_FLAG | N_FLAG);
-  if (trace) {
-    trace_record += "{Mnemonic {SWAP.W ";
-    trace_record += ourRegisterData[register_number].name;
-    trace_record += "}} ";
-  }
   return (EXECUTE_OK);
 }
 
-int cpu32::ExecuteScc(int opcode, std::string &trace_record, int trace) {
+int cpu32::ExecuteScc(int opcode) {
   int status, in_register_flag;
   unsigned long address;
   unsigned int result;
-  std::string mnemonic, ea_description;
-
-  if (trace)
-    trace_record += "{Mnemonic {S";
 
   // Get the effective address
-  if ((status =
-           ComputeEffectiveAddress(address, in_register_flag, ea_description,
-                                   opcode & 0x3f, BYTE, trace)) != EXECUTE_OK) {
+  if ((status = ComputeEffectiveAddress(address, in_register_flag,
+                                        opcode & 0x3f, BYTE)) != EXECUTE_OK) {
     return (status);
   }
 
   // Check to see if the result should be all 1's or 0's
-  if (CheckConditionCodes((opcode & 0x0f00) >> 8, mnemonic, trace))
+  if (CheckConditionCodes((opcode & 0x0f00) >> 8))
     result = 0xff;
   else
     result = 0;
 
-  // Store the result
-  if (in_register_flag)
+  // Store the result, setting a register takes longer
+  if (in_register_flag) {
+    if (result)
+      myCycles += 2;
     SetRegister(address, result, BYTE);
-  else if ((status = Poke(address, result, BYTE)) != EXECUTE_OK)
+  } else if ((status = Poke(address, result, BYTE)) != EXECUTE_OK) {
     return (status);
-
-  if (trace) {
-    mnemonic += ".B ";
-    mnemonic += ea_description;
-    mnemonic += "}} ";
-    trace_record += mnemonic;
   }
+
   return (EXECUTE_OK);
 }
 
-int cpu32::ExecuteTAS(int opcode, std::string &trace_record, int trace) {
+int cpu32::ExecuteTAS(int opcode) {
   int status, in_register_flag;
   unsigned long address;
   unsigned int data;
-  std::string ea_description;
 
   // Get the effective address
-  if ((status =
-           ComputeEffectiveAddress(address, in_register_flag, ea_description,
-                                   opcode & 0x3f, BYTE, trace)) != EXECUTE_OK) {
+  if ((status = ComputeEffectiveAddress(address, in_register_flag,
+                                        opcode & 0x3f, BYTE)) != EXECUTE_OK) {
     return (status);
   }
 
@@ -5509,32 +4235,24 @@ int cpu32::ExecuteTAS(int opcode, std::string &trace_record, int trace) {
   else if ((status = Poke(address, data, BYTE)) != EXECUTE_OK)
     return (status);
 
-  if (trace) {
-    trace_record += "{Mnemonic {TAS.B ";
-    trace_record += ea_description;
-    trace_record += "}} ";
-  }
   return (EXECUTE_OK);
 }
 
-int cpu32::ExecuteTRAP(int opcode, std::string &trace_record, int trace) {
+int cpu32::ExecuteTRAP(int opcode) {
   int status;
 
   // Process the exception
   if ((status = ProcessException(32 + (opcode & 0xf))) != EXECUTE_OK)
     return (status);
 
-  if (trace) {
-    trace_record += "{Mnemonic {TRAP #$";
-    trace_record += IntToString(32 + (opcode & 0xf), 1);
-    trace_record += "}} ";
-  }
   return (EXECUTE_OK);
 }
 
-int cpu32::ExecuteTRAPV(int, std::string &trace_record, int trace) {
+int cpu32::ExecuteTRAPV(int) {
   int status;
 
+  EvaluateConditionCodes();
+
   // If the overflow bit is set then trap
   if (register_value[SR_INDEX] & V_FLAG) {
     // Process the exception
@@ -5542,24 +4260,19 @@ int cpu32::ExecuteTRAPV(int, std::string &trace_record, int trace) {
       return (status);
   }
 
-  if (trace)
-    trace_record += "{Mnemonic {TRAPV}} ";
-
   return (EXECUTE_OK);
 }
 
-int cpu32::ExecuteTST(int opcode, std::string &trace_record, int trace) {
+int cpu32::ExecuteTST(int opcode) {
   int status, size, in_register_flag;
   unsigned long address;
   unsigned int data;
-  std::string ea_description;
 
   size = ((opcode & 0x00c0) >> 6);
 
   // Get the effective address
-  if ((status =
-           ComputeEffectiveAddress(address, in_register_flag, ea_description,
-                                   opcode & 0x3f, size, trace)) != EXECUTE_OK) {
+  if ((status = ComputeEffectiveAddress(address, in_register_flag,
+                                        opcode & 0x3f, size)) != EXECUTE_OK) {
     return (status);
   }
 
@@ -5571,21 +4284,10 @@ int cpu32::ExecuteTST(int opcode, std::string &trace_record, int trace) {
 
   SetConditionCodes(0, 0, data, size, OTHER, C_FLAG | V_FLAG | Z_FLAG | N_FLAG);
 
-  if (trace) {
-    trace_record += "{Mnemonic {TST";
-    if (size == BYTE)
-      trace_record += ".B ";
-    else if (size == WORD)
-      trace_record += ".W ";
-    else if (size == LONG)
-      trace_record += ".L ";
-    trace_record += ea_description;
-    trace_record += "}} ";
-  }
   return (EXECUTE_OK);
 }
 
-int cpu32::ExecuteUNLK(int opcode, std::string &trace_record, int trace) {
+int cpu32::ExecuteUNLK(int opcode) {
   int status, stack_index;
   unsigned int register_number, fp;
 
@@ -5612,15 +4314,10 @@ int cpu32::ExecuteUNLK(int opcode, std::string &trace_record, int trace) {
   SetRegister(register_number, fp, LONG);
   SetRegister(stack_index, register_value[stack_index] + 4, LONG);
 
-  if (trace) {
-    trace_record += "{Mnemonic {UNLK ";
-    trace_record += ourRegisterData[register_number].name;
-    trace_record += "}} ";
-  }
   return (EXECUTE_OK);
 }
 
-int cpu32::ExecuteInvalid(int, std::string &trace_record, int trace) {
+int cpu32::ExecuteInvalid(int) {
   int status;
 
   // Move the PC back to the start of the illegal instruction opcode
@@ -5630,15 +4327,16 @@ int cpu32::ExecuteInvalid(int, std::string &trace_record, int trace) {
   if ((status = ProcessException(4)) != EXECUTE_OK)
     return (status);
 
-  if (trace)
-    trace_record += "{Mnemonic {Illegal Instruction Exception}} ";
-
   return (EXECUTE_OK);
 }
 
 int cpu32::ProcessException(int vector) {
   int status;
 
+  EvaluateConditionCodes();
+  myCycles += ExceptionCycles(vector);
+  myStatistics.CountException();
+
   // Copy the SR to a temp
   unsigned long sr = register_value[SR_INDEX];
 
@@ -5677,9 +4375,13 @@ int cpu32::ProcessException(int vector) {
   return (EXECUTE_OK);
 }
 
-int cpu32::ExecuteAddressError(int opcode, std::string &trace_record, int trace) {
+int cpu32::ExecuteAddressError(int opcode) {
   int status;
 
+  EvaluateConditionCodes();
+  myCycles += ExceptionCycles(3);
+  myStatistics.CountAddressError();
+
   // Copy the SR to a temp
   unsigned long sr = register_value[SR_INDEX];
 
@@ -5731,15 +4433,16 @@ int cpu32::ExecuteAddressError(int opcode, std::string &trace_record, int trace)
   // Change the program counter to the service routine's address
   SetRegister(PC_INDEX, service_address, LONG);
 
-  if (trace)
-    trace_record += "{Mnemonic {Address Error Exception}} ";
-
   return (EXECUTE_OK);
 }
 
-int cpu32::ExecuteBusError(int opcode, std::string &trace_record, int trace) {
+int cpu32::ExecuteBusError(int opcode) {
   int status;
 
+  EvaluateConditionCodes();
+  myCycles += ExceptionCycles(2);
+  myStatistics.CountBusError();
+
   // Copy the SR to a temp
   unsigned long sr = register_value[SR_INDEX];
 
@@ -5791,8 +4494,5 @@ int cpu32::ExecuteBusError(int opcode, std::string &trace_record, int trace) {
   // Change the program counter to the service routine's address
   SetRegister(PC_INDEX, service_address, LONG);
 
-  if (trace)
-    trace_record += "{Mnemonic {Bus Error Exception}} ";
-
   return (EXECUTE_OK);
 }
@@ -1,16 +1,134 @@
 // Instantiates all of the objects and starts the user interface command parser.
 
+#include <iostream>
 #include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
 
+#include "Framework/BatchRunner.hpp"
+#include "Framework/Engine.hpp"
 #include "Framework/Interface.hpp"
+#include "Framework/TraceReader.hpp"
 #include "M68k/sim68360/cpu32.hpp"
 #include "M68k/devices/DeviceRegistry.hpp"
 #include "M68k/loader/Loader.hpp"
 
-int main() {
-  auto processor = std::unique_ptr<BasicCPU>(new cpu32);
-  auto loader = std::unique_ptr<BasicLoader>(new Loader(*processor));
+namespace {
+// Gets a limit given on the command line, returns false if it's invalid
+template <class T>
+bool ParseLimit(const char *arg, T &limit) {
+  std::istringstream in(arg);
+  char c;
+  return (in >> limit) && limit > 0 && !(in >> c);
+}
+
+// Prints the trace records of count instructions of the trace file, starting
+// at the first (counting from 1) and stopping early at the end of the trace.
+// Returns false after printing the error if something goes wrong.
+bool PrintTrace(BasicCPU &cpu, BasicDeviceRegistry &registry,
+                const std::string &filename, uint64_t first, uint64_t count) {
+  TraceReader reader(cpu, registry);
+  std::string message = reader.Open(filename);
+  for (uint64_t n = first - 1; message.empty() && n < first - 1 + count; ++n) {
+    if (n > first - 1 && n == reader.Instructions())
+      break;
+    std::string record;
+    message = reader.Render(n, record);
+    if (message.empty())
+      std::cout << record << '\n';
+  }
+  std::cout.flush();
+  if (!message.empty()) {
+    std::cerr << message << std::endl;
+    return false;
+  }
+  return true;
+}
+}  // namespace
+
+int main(int argc, char *argv[]) {
+  // The -realtime option keeps devices from running faster than they would
+  // for real.  The -run option runs a program from the setup without the
+  // user interface, within the limits the other options give.  Given more than
+  // once, or with -jobs, each program runs on a machine of its own on one of
+  // the number of threads -jobs gives, one per core if it isn't given.
+  // The -trace option prints instructions' trace records from a trace file
+  // recorded by the RecordTrace command.
+  bool realtime = false;
+  std::vector<EngineJob> jobs;
+  bool parallel = false;
+  size_t threads = 0;
+  BatchRunner::Limits limits;
+  std::string trace;
+  uint64_t first = 0;
+  uint64_t count = 0;
+  for (int t = 1; t < argc; ++t) {
+    std::string arg = argv[t];
+    bool valid = true;
+    if (arg == "-realtime") {
+      realtime = true;
+    } else if (arg == "-run" && t + 2 < argc) {
+      EngineJob job;
+      job.setup = argv[++t];
+      job.program = argv[++t];
+      jobs.push_back(job);
+    } else if (arg == "-jobs" && t + 1 < argc) {
+      parallel = true;
+      valid = ParseLimit(argv[++t], threads);
+    } else if (arg == "-trace" && t + 3 < argc) {
+      trace = argv[++t];
+      valid = ParseLimit(argv[++t], first) && ParseLimit(argv[++t], count);
+    } else if (arg == "-instructions" && t + 1 < argc) {
+      valid = ParseLimit(argv[++t], limits.instructions);
+    } else if (arg == "-cycles" && t + 1 < argc) {
+      valid = ParseLimit(argv[++t], limits.cycles);
+    } else if (arg == "-seconds" && t + 1 < argc) {
+      valid = ParseLimit(argv[++t], limits.seconds);
+    } else {
+      valid = false;
+    }
+    if (!valid) {
+      std::cerr << "usage: " << argv[0] << " [-realtime]"
+                << " [-run setup program ... [-jobs n] [-instructions n]"
+                << " [-cycles n] [-seconds s]] [-trace file first count]"
+                << std::endl;
+      return BatchRunner::EXIT_ERROR;
+    }
+  }
+
+  // Every machine is made the way the options say
+  auto newCPU = [=]() -> BasicCPU * {
+    auto cpu = new cpu32;
+    if (realtime)
+      cpu->eventHandler().Pace(true);
+    return cpu;
+  };
+  auto newLoader = [](BasicCPU &cpu) -> BasicLoader * {
+    return new Loader(cpu);
+  };
+
   auto registry = std::unique_ptr<BasicDeviceRegistry>(new DeviceRegistry);
+  if (parallel || jobs.size() > 1) {
+    for (auto &job : jobs)
+      job.limits = limits;
+    Engine engine(newCPU, *registry, newLoader, threads);
+    return engine.RunAll(jobs, std::cout);
+  }
+
+  auto processor = std::unique_ptr<BasicCPU>(newCPU());
+  auto loader = std::unique_ptr<BasicLoader>(newLoader(*processor));
+
+  if (!trace.empty()) {
+    return PrintTrace(*processor, *registry, trace, first, count)
+               ? 0
+               : BatchRunner::EXIT_ERROR;
+  }
+
+  if (!jobs.empty()) {
+    BatchRunner runner(*processor, *registry, *loader);
+    return runner.Run(jobs[0].setup, jobs[0].program, limits, std::cout);
+  }
 
   Interface interface(*processor, *registry, *loader);
   interface.CommandLoop();
@@ -0,0 +1,276 @@
+//
+// Instruction timing.  Instructions are charged the clock cycles given in
+// the instruction execution timing tables of the MC68000 User's Manual for
+// their form and effective address.  Costs that depend on the data, such as
+// shift counts, MOVEM register lists and whether a branch is taken, are
+// added by the instructions themselves.
+//
+// The CPU32 overlaps the execution of instructions, which isn't modeled.
+// It's charged the 68000's costs and the instructions it adds are charged
+// like their nearest 68000 relatives.
+//
+
+#include "M68k/sim68360/cpu32.hpp"
+
+namespace {
+
+// Returns the row of the tables below for the mode and register bits of an
+// effective address: Dn, An, (An), (An)+, -(An), d16(An), d8(An,Xn), abs.W,
+// abs.L, d16(PC), d8(PC,Xn) and #<data>
+int AddressingMode(int mode_register) {
+  const int mode = (mode_register >> 3) & 7;
+  const int reg = mode_register & 7;
+
+  if (mode < 7)
+    return mode;
+  return (reg < 4) ? 7 + reg : 11;
+}
+
+// Cycles to calculate the effective address and fetch a byte or word
+const unsigned char ourFetchWordCycles[] = {0, 0, 4, 4, 6, 8,
+                                            10, 8, 12, 8, 10, 4};
+
+// Cycles to calculate the effective address and fetch a long word
+const unsigned char ourFetchLongCycles[] = {0, 0, 8, 8, 10, 12,
+                                            14, 12, 16, 12, 14, 8};
+
+// Cycles to calculate and write the destination of a MOVE
+const unsigned char ourWriteWordCycles[] = {0, 0, 4, 4, 4, 8,
+                                            10, 8, 12, 0, 0, 0};
+const unsigned char ourWriteLongCycles[] = {0, 0, 8, 8, 8, 12,
+                                            14, 12, 16, 0, 0, 0};
+
+// Cycles for the instructions which take control addressing modes
+const unsigned char ourJMPCycles[] = {0, 0, 8, 0, 0, 10, 14, 10, 12, 10, 14, 0};
+const unsigned char ourJSRCycles[] = {0, 0, 16, 0, 0, 18,
+                                      22, 18, 20, 18, 22, 0};
+const unsigned char ourLEACycles[] = {0, 0, 4, 0, 0, 8, 12, 8, 12, 8, 12, 0};
+const unsigned char ourPEACycles[] = {0, 0, 12, 0, 0, 16,
+                                      20, 16, 20, 16, 20, 0};
+
+// Cycles for MOVEM not counting the registers transferred
+const unsigned char ourMOVEMToRegisterCycles[] = {0, 0, 12, 12, 0, 16,
+                                                  18, 16, 20, 16, 18, 0};
+const unsigned char ourMOVEMToMemoryCycles[] = {0, 0, 8, 0, 8, 12,
+                                                14, 12, 16, 0, 0, 0};
+}
+
+// Returns the number of clock cycles the instruction takes, not counting
+// the ones which depend on the data
+unsigned int cpu32::InstructionCycles(unsigned int opcode,
+                                       ExecutionPointer execute) {
+  const int mode = AddressingMode(opcode & 0x3f);
+  const bool register_direct = (mode <= 1);
+  const int size = (opcode & 0x00c0) >> 6;
+  const unsigned int ea = (size == LONG) ? ourFetchLongCycles[mode]
+                                         : ourFetchWordCycles[mode];
+
+  // MOVE and MOVEA have their own size encoding and two addresses
+  if (execute == &cpu32::ExecuteMOVE || execute == &cpu32::ExecuteMOVEA) {
+    const bool long_size = ((opcode & 0x3000) == 0x2000);
+    const int destination =
+        AddressingMode(((opcode >> 3) & 0x38) | ((opcode >> 9) & 7));
+    if (long_size)
+      return 4 + ourFetchLongCycles[mode] + ourWriteLongCycles[destination];
+    return 4 + ourFetchWordCycles[mode] + ourWriteWordCycles[destination];
+  }
+  if (execute == &cpu32::ExecuteMOVEQ)
+    return 4;
+
+  // <ea>,Dn and Dn,<ea> arithmetic and logical instructions
+  if (execute == &cpu32::ExecuteADD || execute == &cpu32::ExecuteSUB ||
+      execute == &cpu32::ExecuteAND || execute == &cpu32::ExecuteOR) {
+    if (opcode & 0x0100)
+      return ((size == LONG) ? 12 : 8) + ea;
+    if (size == LONG)
+      return ((register_direct || mode == 11) ? 8 : 6) + ea;
+    return 4 + ea;
+  }
+  if (execute == &cpu32::ExecuteEOR) {
+    if (register_direct)
+      return (size == LONG) ? 8 : 4;
+    return ((size == LONG) ? 12 : 8) + ea;
+  }
+  if (execute == &cpu32::ExecuteCMP)
+    return ((size == LONG) ? 6 : 4) + ea;
+
+  // Address register destinations
+  if (execute == &cpu32::ExecuteADDA || execute == &cpu32::ExecuteSUBA) {
+    if (!(opcode & 0x0100))
+      return 8 + ourFetchWordCycles[mode];
+    return ((register_direct || mode == 11) ? 8 : 6) + ourFetchLongCycles[mode];
+  }
+  if (execute == &cpu32::ExecuteCMPA) {
+    if (opcode & 0x0100)
+      return 6 + ourFetchLongCycles[mode];
+    return 6 + ourFetchWordCycles[mode];
+  }
+
+  // Immediate instructions
+  if (execute == &cpu32::ExecuteADDI || execute == &cpu32::ExecuteSUBI ||
+      execute == &cpu32::ExecuteANDI || execute == &cpu32::ExecuteORI ||
+      execute == &cpu32::ExecuteEORI) {
+    if (register_direct && size == LONG)
+      return (execute == &cpu32::ExecuteANDI) ? 14 : 16;
+    if (register_direct)
+      return 8;
+    return ((size == LONG) ? 20 : 12) + ea;
+  }
+  if (execute == &cpu32::ExecuteCMPI) {
+    if (register_direct)
+      return (size == LONG) ? 14 : 8;
+    return ((size == LONG) ? 12 : 8) + ea;
+  }
+  if (execute == &cpu32::ExecuteADDQ || execute == &cpu32::ExecuteSUBQ) {
+    if (mode == 1)
+      return 8;
+    if (mode == 0)
+      return (size == LONG) ? 8 : 4;
+    return ((size == LONG) ? 12 : 8) + ea;
+  }
+
+  // Multiprecision instructions
+  if (execute == &cpu32::ExecuteADDX || execute == &cpu32::ExecuteSUBX) {
+    if (opcode & 0x0008)
+      return (size == LONG) ? 30 : 18;
+    return (size == LONG) ? 8 : 4;
+  }
+  if (execute == &cpu32::ExecuteABCD)
+    return (opcode & 0x0008) ? 18 : 6;
+  if (execute == &cpu32::ExecuteCMPM)
+    return (size == LONG) ? 20 : 12;
+
+  // Single operand instructions
+  if (execute == &cpu32::ExecuteCLR || execute == &cpu32::ExecuteNEG ||
+      execute == &cpu32::ExecuteNEGX || execute == &cpu32::ExecuteNOT) {
+    if (register_direct)
+      return (size == LONG) ? 6 : 4;
+    return ((size == LONG) ? 12 : 8) + ea;
+  }
+  if (execute == &cpu32::ExecuteScc)
+    return register_direct ? 4 : 8 + ea;
+  if (execute == &cpu32::ExecuteTAS)
+    return register_direct ? 4 : 14 + ea;
+  if (execute == &cpu32::ExecuteTST)
+    return 4 + ea;
+
+  // Shifts and rotates, register shifts are charged for the count later
+  if (execute == &cpu32::ExecuteASL || execute == &cpu32::ExecuteASR ||
+      execute == &cpu32::ExecuteLSL || execute == &cpu32::ExecuteLSR ||
+      execute == &cpu32::ExecuteROL || execute == &cpu32::ExecuteROR ||
+      execute == &cpu32::ExecuteROXL || execute == &cpu32::ExecuteROXR) {
+    if (size == 3)
+      return 8 + ourFetchWordCycles[mode];
+    return (size == LONG) ? 8 : 6;
+  }
+
+  // Bit manipulation, the register forms take the maximum time
+  if (execute == &cpu32::ExecuteBit) {
+    const bool dynamic = (opcode & 0x0100) != 0;
+    const unsigned int byte_ea = ourFetchWordCycles[mode];
+    switch (size) {
+    case 0:  // BTST
+      if (register_direct)
+        return dynamic ? 6 : 10;
+      return (dynamic ? 4 : 8) + byte_ea;
+    case 2:  // BCLR
+      if (register_direct)
+        return dynamic ? 10 : 14;
+      return (dynamic ? 8 : 12) + byte_ea;
+    default:  // BCHG and BSET
+      if (register_direct)
+        return dynamic ? 8 : 12;
+      return (dynamic ? 8 : 12) + byte_ea;
+    }
+  }
+
+  // Branches, charged for the quicker outcome
+  if (execute == &cpu32::ExecuteBcc)
+    return ((opcode & 0xff) != 0 && (opcode & 0xff) != 0xff) ? 8 : 10;
+  if (execute == &cpu32::ExecuteBRA)
+    return 10;
+  if (execute == &cpu32::ExecuteBSR)
+    return 18;
+  if (execute == &cpu32::ExecuteDBcc)
+    return 10;
+  if (execute == &cpu32::ExecuteJMP)
+    return ourJMPCycles[mode];
+  if (execute == &cpu32::ExecuteJSR)
+    return ourJSRCycles[mode];
+  if (execute == &cpu32::ExecuteLEA)
+    return ourLEACycles[mode];
+  if (execute == &cpu32::ExecutePEA)
+    return ourPEACycles[mode];
+  if (execute == &cpu32::ExecuteRTE || execute == &cpu32::ExecuteRTR)
+    return 20;
+  if (execute == &cpu32::ExecuteRTS || execute == &cpu32::ExecuteRTD)
+    return 16;
+
+  // MOVEM is charged for each register transferred later
+  if (execute == &cpu32::ExecuteMOVEM) {
+    if (opcode & 0x0400)
+      return ourMOVEMToRegisterCycles[mode];
+    return ourMOVEMToMemoryCycles[mode];
+  }
+  if (execute == &cpu32::ExecuteMOVEP)
+    return (opcode & 0x0040) ? 24 : 16;
+
+  // Multiply and divide are charged for the operands later
+  if (execute == &cpu32::ExecuteMULS || execute == &cpu32::ExecuteMULU)
+    return 38 + ourFetchWordCycles[mode];
+  if (execute == &cpu32::ExecuteDIVS || execute == &cpu32::ExecuteDIVU)
+    return ourFetchWordCycles[mode];
+  if (execute == &cpu32::ExecuteMULL)
+    return 70 + ourFetchLongCycles[mode];
+  if (execute == &cpu32::ExecuteDIVL)
+    return ourFetchLongCycles[mode];
+
+  // Status register instructions
+  if (execute == &cpu32::ExecuteANDItoCCR ||
+      execute == &cpu32::ExecuteANDItoSR ||
+      execute == &cpu32::ExecuteEORItoCCR ||
+      execute == &cpu32::ExecuteEORItoSR ||
+      execute == &cpu32::ExecuteORItoCCR || execute == &cpu32::ExecuteORItoSR)
+    return 20;
+  if (execute == &cpu32::ExecuteMOVEfromSR)
+    return register_direct ? 6 : 8 + ea;
+  if (execute == &cpu32::ExecuteMOVEtoCCR ||
+      execute == &cpu32::ExecuteMOVEtoSR)
+    return 12 + ourFetchWordCycles[mode];
+  if (execute == &cpu32::ExecuteMOVEUSP || execute == &cpu32::ExecuteMOVEC)
+    return 4;
+  if (execute == &cpu32::ExecuteMOVES)
+    return 4 + ea;
+
+  // Miscellaneous instructions
+  if (execute == &cpu32::ExecuteEXG)
+    return 6;
+  if (execute == &cpu32::ExecuteEXT || execute == &cpu32::ExecuteSWAP ||
+      execute == &cpu32::ExecuteNOP || execute == &cpu32::ExecuteSTOP ||
+      execute == &cpu32::ExecuteTRAPV)
+    return 4;
+  if (execute == &cpu32::ExecuteLINK)
+    return 16;
+  if (execute == &cpu32::ExecuteUNLK)
+    return 12;
+  if (execute == &cpu32::ExecuteRESET)
+    return 132;
+
+  // Everything else only raises an exception, which is charged for then
+  return 0;
+}
+
+// Returns the number of clock cycles needed to process the exception
+unsigned int cpu32::ExceptionCycles(int vector) {
+  switch (vector) {
+  case 2:  // Bus error
+  case 3:  // Address error
+    return 50;
+  case 5:  // Divide by zero
+    return 38;
+  case 7:  // TRAPV has already been charged for the instruction
+    return 30;
+  default:
+    return 34;
+  }
+}